@@ -25,6 +25,7 @@
 #include <aws/gamekit/core/gamekit_feature.h>
 #include <aws/gamekit/core/logging.h>
 #include <aws/gamekit/core/utils/encoding_utils.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 #include <aws/gamekit/core/utils/sts_utils.h>
 
 // Boost Forward declarations
@@ -53,6 +54,9 @@ namespace GameKit
             Authentication::GameKitSessionManager* m_sessionManager;
             std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
 
+            // Sets the id token as authorization and sends the request. Replays it once with refreshed tokens if it is rejected with 401 Unauthorized.
+            // Requests are recorded into the metrics of the given endpoint.
+            std::shared_ptr<Aws::Http::HttpResponse> makeAuthorizedRequest(const std::shared_ptr<Aws::Http::HttpRequest>& request, Utils::RequestMetrics::Endpoint& metrics) const;
             unsigned int processResponse(const std::shared_ptr<Aws::Http::HttpResponse>& response, const std::string& originMethod, const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback, Aws::Utils::Json::JsonValue& outJsonValue) const;
         public:
             /**
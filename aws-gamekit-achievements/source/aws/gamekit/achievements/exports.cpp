@@ -23,8 +23,9 @@ GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE GameKitAchievementsInstanceCreateWithSessio
     Achievements* achievements = new Achievements(logCb, sessMgr);
 
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(sessMgr->GetClientSettings(), clientConfig);
-    clientConfig.region = sessMgr->GetClientSettings()[GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = sessMgr->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
 
     return (GameKit::GameKitFeature*)achievements;
 }
@@ -47,7 +48,7 @@ unsigned int GameKitGetAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievem
 
 GAMEKIT_API unsigned int GameKitGetAchievementIconsBaseUrl(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback)
 {
-    auto url = ((Achievements*)((GameKit::GameKitFeature*)achievementsInstance))->GetSessionManager()->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_ICONS_BASE_URL];
+    auto url = ((Achievements*)((GameKit::GameKitFeature*)achievementsInstance))->GetSessionManager()->GetClientSettingsSnapshot()->GetAchievementsIconsBaseUrl();
     responseCallback(dispatchReceiver, url.append("/").c_str());
     return GameKit::GAMEKIT_SUCCESS;
 }
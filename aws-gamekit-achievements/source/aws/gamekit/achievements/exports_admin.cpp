@@ -23,8 +23,9 @@ GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE GameKitAdminAchievementsInstanceCreat
     AdminAchievements* achievements = new AdminAchievements(logCb, sessMgr, std::string(cloudResourcesPath), accountInfo, accountCredentials);
 
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(sessMgr->GetClientSettings(), clientConfig);
-    clientConfig.region = sessMgr->GetClientSettings()[GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = sessMgr->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
 
     return (GameKit::GameKitFeature*)achievements;
 }
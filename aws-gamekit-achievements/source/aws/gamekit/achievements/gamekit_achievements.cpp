@@ -7,6 +7,7 @@
 
 // GameKit
 #include <aws/gamekit/achievements/gamekit_achievements.h>
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
@@ -29,13 +30,14 @@ Achievements::Achievements(FuncLogCallback logCb, Authentication::GameKitSession
     static const long TIMEOUT = 5000;
 
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
-    clientConfig.region = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = m_sessionManager->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
     // Extend timeouts to account for cold lambda starts
     clientConfig.connectTimeoutMs = TIMEOUT;
     clientConfig.httpRequestTimeoutMs = TIMEOUT;
     clientConfig.requestTimeoutMs = TIMEOUT;
-    m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    m_httpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 
     Logging::Log(m_logCb, Level::Info, "Achievements instantiated");
 }
@@ -55,8 +57,9 @@ unsigned int Achievements::UpdateAchievementForPlayer(const char* achievementId,
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL] + "/" + achievementId + "/unlock";
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::Achievements) + "/" + achievementId + "/unlock";
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
     if (idToken.empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::UpdateAchievementForPlayer() No ID token in session.");
@@ -64,8 +67,6 @@ unsigned int Achievements::UpdateAchievementForPlayer(const char* achievementId,
     }
 
     const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    request->SetAuthorization(Aws::String(idToken));
-
     Aws::Utils::Json::JsonValue body;
     body.WithInteger("increment_by", incrementBy);
     const Aws::String body_string = body.View().WriteCompact();
@@ -77,7 +78,7 @@ unsigned int Achievements::UpdateAchievementForPlayer(const char* achievementId,
     request->AddContentBody(bodyStream);
     request->SetContentLength(StringUtils::to_string(body_string.length()));
 
-    const std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    const std::shared_ptr<Aws::Http::HttpResponse> response = makeAuthorizedRequest(request, Utils::RequestMetrics::GetEndpoint("Achievements.UpdateAchievementForPlayer"));
     Aws::Utils::Json::JsonValue outJson;
     return processResponse(response, "Achievements::UpdateAchievementForPlayer()", dispatchReceiver, responseCallback, outJson);
 }
@@ -89,8 +90,9 @@ unsigned int Achievements::GetAchievementForPlayer(const char* achievementId, co
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL] + "/" + achievementId;
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::Achievements) + "/" + achievementId;
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
     if (idToken.empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::GetAchievementForPlayer() No ID token in session.");
@@ -105,11 +107,9 @@ unsigned int Achievements::GetAchievementForPlayer(const char* achievementId, co
     }
 
     const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    request->SetAuthorization(ToAwsString(idToken));
-
     // TODO set use_consistent_read as queryStringParam after it's added as a parameter for this.
 
-    const std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    const std::shared_ptr<Aws::Http::HttpResponse> response = makeAuthorizedRequest(request, Utils::RequestMetrics::GetEndpoint("Achievements.GetAchievementForPlayer"));
     Aws::Utils::Json::JsonValue outJson;
     return processResponse(response, "Achievements::GetAchievementForPlayer()", dispatchReceiver, responseCallback, outJson);
 }
@@ -121,8 +121,9 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL];
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::Achievements);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
     if (idToken.empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::ListAchievementsForPlayer() No ID token in session.");
@@ -136,8 +137,6 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
     do
     {
         const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-        request->SetAuthorization(ToAwsString(idToken));
-
         if (startKey != "")
         {
             request->AddQueryStringParameter("start_key", startKey);
@@ -148,7 +147,7 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
         request->AddQueryStringParameter("limit", StringUtils::to_string(pageSize));
         request->AddQueryStringParameter("wait_for_all_pages", StringUtils::to_string(waitForAllPages));
 
-        const std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+        const std::shared_ptr<Aws::Http::HttpResponse> response = makeAuthorizedRequest(request, Utils::RequestMetrics::GetEndpoint("Achievements.ListAchievementsForPlayer"));
         Aws::Utils::Json::JsonValue value;
         status = processResponse(response, "Achievements::ListAchievementsForPlayer()", dispatchReceiver, responseCallback, value);
         if (status != GameKit::GAMEKIT_SUCCESS)
@@ -181,6 +180,34 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
 #pragma endregion
 
 #pragma region Private Methods
+std::shared_ptr<Aws::Http::HttpResponse> Achievements::makeAuthorizedRequest(const std::shared_ptr<Aws::Http::HttpRequest>& request, Utils::RequestMetrics::Endpoint& metrics) const
+{
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    request->SetAuthorization(ToAwsString(sessionTokens->Get(GameKit::TokenType::IdToken)));
+
+    std::shared_ptr<Aws::Http::HttpResponse> response = Utils::RequestMetrics::MakeRequest(*m_httpClient, request, metrics);
+
+    // The id token can expire before its scheduled refresh, refresh it and replay the request once
+    if (response->GetResponseCode() == Aws::Http::HttpResponseCode::UNAUTHORIZED &&
+        m_sessionManager->RefreshTokensNow(sessionTokens->Version) == GAMEKIT_SUCCESS)
+    {
+        Logging::Log(m_logCb, Level::Info, "Achievements: Request was not authorized, retrying with refreshed id token.");
+        request->SetAuthorization(ToAwsString(m_sessionManager->GetTokenSnapshot()->Get(GameKit::TokenType::IdToken)));
+
+        const std::shared_ptr<Aws::IOStream> body = request->GetContentBody();
+        if (body != nullptr)
+        {
+            body->clear();
+            body->seekg(0);
+        }
+
+        metrics.RecordRetry();
+        response = Utils::RequestMetrics::MakeRequest(*m_httpClient, request, metrics);
+    }
+
+    return response;
+}
+
 unsigned int Achievements::processResponse(const std::shared_ptr<Aws::Http::HttpResponse>& response, const std::string& originMethod,
     const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback, Aws::Utils::Json::JsonValue& jsonBody) const
 {
@@ -8,6 +8,7 @@
 
 // GameKit
 #include <aws/gamekit/achievements/gamekit_admin_achievements.h>
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
@@ -42,12 +43,13 @@ AdminAchievements::AdminAchievements(FuncLogCallback logCb, Authentication::Game
     static const long TIMEOUT = 5000;
 
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
-    clientConfig.region = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = m_sessionManager->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
     clientConfig.connectTimeoutMs = TIMEOUT;
     clientConfig.httpRequestTimeoutMs = TIMEOUT;
     clientConfig.requestTimeoutMs = TIMEOUT;
-    m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    m_httpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 
     Logging::Log(m_logCb, Level::Info, "Achievements instantiated");
 }
@@ -448,7 +450,7 @@ unsigned int AdminAchievements::makeAdminRequest(const Aws::Http::HttpMethod met
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL] + "/admin";
+    std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::Achievements) + "/admin";
     unsigned int status = GameKit::GAMEKIT_SUCCESS;
 
     auto assembleAndExecuteRequest = [&](bool forceCredentialRefresh=false) mutable
@@ -4,8 +4,13 @@
 #pragma once
 // Standard Library
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
 
 // AWS SDK
@@ -18,6 +23,7 @@
 #include <aws/gamekit/core/awsclients/api_initializer.h>
 #include <aws/gamekit/core/awsclients/default_clients.h>
 #include <aws/gamekit/core/enums.h>
+#include <aws/gamekit/core/errors.h>
 #include <aws/gamekit/core/logging.h>
 #include <aws/gamekit/core/utils/ticker.h>
 
@@ -51,22 +57,125 @@ namespace GameKit
 
     namespace Authentication
     {
+        /**
+         * @brief Immutable view of the settings loaded from awsGameKitClientConfig.yml.
+         *
+         * @details The session manager publishes a new instance every time the configuration is loaded or reloaded.
+         * Well-known settings are resolved once at load time so request paths can read them by reference
+         * instead of copying and searching the whole settings map.
+         */
+        class GAMEKIT_API ClientSettingsSnapshot
+        {
+        private:
+            std::map<std::string, std::string> m_settings;
+            std::string m_identityRegion;
+            std::string m_userPoolClientId;
+            std::string m_identityBaseUrl;
+            std::string m_achievementsBaseUrl;
+            std::string m_achievementsIconsBaseUrl;
+            std::string m_userGameplayDataBaseUrl;
+            std::string m_gameSavingBaseUrl;
+            bool m_identityLoaded;
+            bool m_achievementsLoaded;
+            bool m_userGameplayDataLoaded;
+            bool m_gameSavingLoaded;
+
+        public:
+            /**
+             * @brief Create a snapshot and resolve the well-known settings.
+             * @param settings Key/value pairs read from awsGameKitClientConfig.yml.
+            */
+            explicit ClientSettingsSnapshot(std::map<std::string, std::string> settings);
+
+            /**
+             * @brief Get all the client settings.
+             * @return Reference to the settings map, valid for as long as this snapshot is held.
+            */
+            inline const std::map<std::string, std::string>& GetSettings() const { return m_settings; }
+
+            /**
+             * @brief Get a setting by key.
+             * @param key The setting key.
+             * @return The setting value, or an empty string if the setting does not exist.
+            */
+            const std::string& GetSetting(const std::string& key) const;
+
+            /**
+             * @brief Check if the settings for a feature are present. See GameKitSessionManager::AreSettingsLoaded().
+             * @param featureType The feature to check.
+             * @return True if all the settings required by the feature are present.
+            */
+            bool AreSettingsLoaded(FeatureType featureType) const;
+
+            /**
+             * @brief Get the API Gateway base url of a feature.
+             * @param featureType One of Identity, Achievements, UserGameplayData or GameStateCloudSaving.
+             * @return The base url, or an empty string if the feature has no base url or it is not loaded.
+            */
+            const std::string& GetBaseUrl(FeatureType featureType) const;
+
+            inline const std::string& GetIdentityRegion() const { return m_identityRegion; }
+            inline const std::string& GetUserPoolClientId() const { return m_userPoolClientId; }
+            inline const std::string& GetAchievementsIconsBaseUrl() const { return m_achievementsIconsBaseUrl; }
+        };
+
         static const int DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION = 120;
-        static const int MAX_REFRESH_RETRY_ATTEMPTS = 5;
+        static const int MAX_REFRESH_RETRY_ATTEMPTS = 5; // Number of times the retry delay is doubled before it stops growing
+
+        /**
+         * @brief Immutable set of session tokens.
+         *
+         * @details The session manager publishes a new instance every time a token changes. A snapshot obtained from
+         * GameKitSessionManager::GetTokenSnapshot() never changes while it is held, so its tokens can be read by reference.
+         */
+        struct SessionTokens
+        {
+            std::array<std::string, (size_t)TokenType::TokenType_COUNT> Tokens; // Indexed by TokenType enum values
+
+            // Incremented every time a token is set or deleted. Can be used to detect that values derived from the tokens are stale.
+            uint64_t Version = 0;
+
+            inline const std::string& Get(TokenType tokenType) const
+            {
+                return Tokens[(size_t)tokenType];
+            }
+        };
 
         class GAMEKIT_API GameKitSessionManager
         {
         private:
+            // Serializes token writers and the token refresher. Readers never take this lock, see GetTokenSnapshot().
             std::mutex m_sessionTokensMutex;
-            std::array<std::string, (size_t)TokenType::TokenType_COUNT> m_sessionTokens; // Indexed by TokenType enum values
+            std::shared_ptr<const SessionTokens> m_sessionTokens; // Only accessed with std::atomic_load/std::atomic_store
             std::shared_ptr<Utils::Ticker> m_tokenRefresher;
             FuncLogCallback m_logCb = nullptr;
-            std::shared_ptr<std::map<std::string, std::string>> m_clientSettings;
+            std::shared_ptr<const ClientSettingsSnapshot> m_clientSettings; // Only accessed with std::atomic_load/std::atomic_store
             Aws::CognitoIdentityProvider::CognitoIdentityProviderClient* m_cognitoClient;
             bool m_awsClientsInitializedInternally;
 
-            void loadConfigFile(const std::string& clientConfigFile) const;
-            void loadConfigContents(const std::string& clientConfigFileContents) const;
+            void loadConfigFile(const std::string& clientConfigFile);
+            void loadConfigContents(const std::string& clientConfigFileContents);
+            void publishClientSettings(std::map<std::string, std::string> settings);
+
+            // Serializes token refreshes so concurrent refresh requests result in a single call to Cognito.
+            // Always acquired before m_sessionTokensMutex, never after.
+            std::mutex m_tokenRefreshMutex;
+            std::chrono::steady_clock::time_point m_nextTokenRefresh; // Guarded by m_tokenRefreshMutex
+            unsigned int m_tokenRefreshFailures = 0; // Consecutive failures, guarded by m_tokenRefreshMutex
+            std::mt19937 m_tokenRefreshJitter; // Guarded by m_tokenRefreshMutex
+
+            // Publishes a modified copy of the current tokens as a single new snapshot. Must be called while holding m_sessionTokensMutex.
+            void publishTokens(const std::function<void(SessionTokens&)>& update);
+
+            // Exchanges the refresh token for new access and id tokens. Must be called while holding m_tokenRefreshMutex.
+            // outRetryable is set to false when Cognito rejected the refresh token itself, retrying will not succeed.
+            unsigned int refreshTokens(bool& outRetryable);
+
+            // Returns the delay before the next refresh attempt after a failure: exponential backoff with jitter, in seconds.
+            int getTokenRefreshRetryDelay();
+
+            // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
+            static int getTokenRefreshInterval(int expiresIn);
 
         protected:
             void executeTokenRefresh();
@@ -95,6 +204,32 @@ namespace GameKit
             */
             std::string GetToken(TokenType tokenType);
 
+            /**
+             * @brief Retrieves an immutable snapshot of all the session tokens.
+             *
+             * @details This method does not lock and does not copy any token. Prefer it over GetToken() in request paths
+             * that read more than one token, or that only need to inspect a token without keeping a copy of it.
+             * @return Shared pointer to the current tokens. Never null.
+            */
+            std::shared_ptr<const SessionTokens> GetTokenSnapshot() const;
+
+            /**
+             * @brief Retrieves the version of the current session tokens.
+             * @return A number that changes every time a token is set or deleted.
+            */
+            uint64_t GetTokenVersion() const;
+
+            /**
+             * @brief Refreshes the access and id tokens now, unless they already changed since a request was authorized.
+             *
+             * @details Feature clients call this when a request is rejected with 401 Unauthorized, then replay the request once.
+             * Concurrent callers are coalesced: a caller arriving while a refresh is in flight waits for it and reuses its result
+             * instead of making another call to Cognito. Successful refreshes also push back the scheduled refresh.
+             * @param staleTokenVersion The token version (see GetTokenVersion()) the rejected request was authorized with.
+             * @return GAMEKIT_SUCCESS if the tokens are newer than staleTokenVersion, GAMEKIT_ERROR_TOKEN_REFRESH_FAILED otherwise.
+            */
+            unsigned int RefreshTokensNow(uint64_t staleTokenVersion);
+
             /**
              * @brief Deletes a token.
              * @param tokenType The type of token to delete.
@@ -121,6 +256,15 @@ namespace GameKit
             */
             std::map<std::string, std::string> GetClientSettings() const;
 
+            /**
+             * @brief Get an immutable snapshot of the current client settings.
+             *
+             * @details This method does not lock and does not copy the settings. Prefer it over GetClientSettings() in request paths.
+             * The snapshot is not updated by ReloadConfigFile(); call this method again to observe a reload.
+             * @return Shared pointer to the current settings. Never null.
+            */
+            std::shared_ptr<const ClientSettingsSnapshot> GetClientSettingsSnapshot() const;
+
             /**
              * @brief Reads and loads the configuration file into SessionManager.
              * @param clientConfigFile The awsGameKitClientConfig.yml file to reload.
@@ -15,14 +15,68 @@ using namespace GameKit::Authentication;
 
 namespace CognitoModel = Aws::CognitoIdentityProvider::Model;
 
+#pragma region ClientSettingsSnapshot
+ClientSettingsSnapshot::ClientSettingsSnapshot(std::map<std::string, std::string> settings)
+    : m_settings(std::move(settings))
+{
+    m_identityRegion = GetSetting(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION);
+    m_userPoolClientId = GetSetting(GameKit::ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID);
+    m_identityBaseUrl = GetSetting(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_API_GATEWAY_BASE_URL);
+    m_achievementsBaseUrl = GetSetting(GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL);
+    m_achievementsIconsBaseUrl = GetSetting(GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_ICONS_BASE_URL);
+    m_userGameplayDataBaseUrl = GetSetting(GameKit::ClientSettings::UserGameplayData::SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL);
+    m_gameSavingBaseUrl = GetSetting(GameKit::ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL);
+
+    m_identityLoaded = m_settings.count(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION) &&
+        m_settings.count(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_API_GATEWAY_BASE_URL) &&
+        m_settings.count(GameKit::ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID);
+    m_achievementsLoaded = m_settings.count(GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL);
+    m_userGameplayDataLoaded = m_settings.count(GameKit::ClientSettings::UserGameplayData::SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL);
+    m_gameSavingLoaded = m_settings.count(GameKit::ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL);
+}
+
+const std::string& ClientSettingsSnapshot::GetSetting(const std::string& key) const
+{
+    static const std::string empty;
+    const auto setting = m_settings.find(key);
+    return setting != m_settings.end() ? setting->second : empty;
+}
+
+bool ClientSettingsSnapshot::AreSettingsLoaded(FeatureType featureType) const
+{
+    switch (featureType)
+    {
+    case FeatureType::Identity: return m_identityLoaded;
+    case FeatureType::UserGameplayData: return m_userGameplayDataLoaded;
+    case FeatureType::Achievements: return m_achievementsLoaded;
+    case FeatureType::GameStateCloudSaving: return m_gameSavingLoaded;
+    default: return false;
+    }
+}
+
+const std::string& ClientSettingsSnapshot::GetBaseUrl(FeatureType featureType) const
+{
+    static const std::string empty;
+    switch (featureType)
+    {
+    case FeatureType::Identity: return m_identityBaseUrl;
+    case FeatureType::UserGameplayData: return m_userGameplayDataBaseUrl;
+    case FeatureType::Achievements: return m_achievementsBaseUrl;
+    case FeatureType::GameStateCloudSaving: return m_gameSavingBaseUrl;
+    default: return empty;
+    }
+}
+#pragma endregion
+
 #pragma region Constructors/Destructor
 GameKitSessionManager::GameKitSessionManager(const std::string& clientConfigFile, FuncLogCallback logCallback)
-    :m_logCb(logCallback)
+    :m_logCb(logCallback), m_tokenRefreshJitter(std::random_device()())
 {
     m_awsClientsInitializedInternally = false;
     m_tokenRefresher = nullptr;
     m_cognitoClient = nullptr;
-    m_clientSettings = std::make_shared<std::map<std::string, std::string>>();
+    publishClientSettings(std::map<std::string, std::string>());
+    std::atomic_store(&m_sessionTokens, std::shared_ptr<const SessionTokens>(std::make_shared<SessionTokens>()));
 
     AwsApiInitializer::Initialize(m_logCb, this);
 
@@ -36,7 +90,7 @@ GameKitSessionManager::GameKitSessionManager(const std::string& clientConfigFile
 
 GameKitSessionManager::~GameKitSessionManager()
 {
-    m_clientSettings = nullptr;
+    std::atomic_store(&m_clientSettings, std::shared_ptr<const ClientSettingsSnapshot>());
     if (m_awsClientsInitializedInternally && m_cognitoClient != nullptr)
     {
         delete(m_cognitoClient);
@@ -59,43 +113,51 @@ GameKitSessionManager::~GameKitSessionManager()
 void GameKitSessionManager::InitializeDefaultAwsClients()
 {
     // if region setting is not loaded or Cognito client is already set, return
-    if (m_clientSettings->operator[](GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION).empty() || m_cognitoClient != nullptr)
+    const std::shared_ptr<const ClientSettingsSnapshot> clientSettings = GetClientSettingsSnapshot();
+    if (clientSettings->GetIdentityRegion().empty() || m_cognitoClient != nullptr)
     {
         return;
     }
 
     m_awsClientsInitializedInternally = true;
     m_cognitoClient = DefaultClients::GetDefaultCognitoIdentityProviderClient(DefaultClients::GetDefaultClientConfigurationWithRegion(
-        GetClientSettings(),
+        clientSettings->GetSettings(),
         ClientSettings::Authentication::SETTINGS_IDENTITY_REGION));
 }
 
 void GameKitSessionManager::SetToken(TokenType tokenType, const std::string& value)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    m_sessionTokens[(size_t)tokenType] = value;
+    publishTokens([&](SessionTokens& tokens) { tokens.Tokens[(size_t)tokenType] = value; });
 }
 
 std::string GameKitSessionManager::GetToken(TokenType tokenType)
 {
-    const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    return m_sessionTokens[(size_t)tokenType];
+    return GetTokenSnapshot()->Get(tokenType);
+}
+
+std::shared_ptr<const SessionTokens> GameKitSessionManager::GetTokenSnapshot() const
+{
+    return std::atomic_load(&m_sessionTokens);
+}
+
+uint64_t GameKitSessionManager::GetTokenVersion() const
+{
+    return GetTokenSnapshot()->Version;
 }
 
 void GameKitSessionManager::DeleteToken(TokenType tokenType)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    m_sessionTokens[(size_t)tokenType] = "";
+    publishTokens([&](SessionTokens& tokens) { tokens.Tokens[(size_t)tokenType].clear(); });
 }
 
 void GameKitSessionManager::SetSessionExpiration(int expirationInSeconds)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    if (!m_sessionTokens[(size_t)TokenType::RefreshToken].empty())
+    if (!GetTokenSnapshot()->Get(TokenType::RefreshToken).empty())
     {
-        // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
-        int interval = std::max<int>(expirationInSeconds - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION,
-            expirationInSeconds / 2);
+        const int interval = getTokenRefreshInterval(expirationInSeconds);
 
         m_tokenRefresher = Aws::MakeShared<Utils::TimestampTicker>("tokenRefresher", interval, std::bind(&GameKitSessionManager::executeTokenRefresh, this), m_logCb);
 
@@ -107,28 +169,33 @@ void GameKitSessionManager::SetSessionExpiration(int expirationInSeconds)
     }
 }
 
-bool GameKitSessionManager::AreSettingsLoaded(FeatureType featureType) const
+unsigned int GameKitSessionManager::RefreshTokensNow(uint64_t staleTokenVersion)
 {
-    switch (featureType)
+    const std::lock_guard<std::mutex> refreshLock(m_tokenRefreshMutex);
+
+    // Another caller, or the scheduled refresh, already replaced the tokens while this caller was waiting for the lock
+    if (GetTokenVersion() != staleTokenVersion)
     {
-    case FeatureType::Identity:
-        return m_clientSettings->count(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION) &&
-            m_clientSettings->count(GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_API_GATEWAY_BASE_URL) &&
-            m_clientSettings->count(GameKit::ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID);
-    case FeatureType::UserGameplayData:
-        return m_clientSettings->count(GameKit::ClientSettings::UserGameplayData::SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL);
-    case FeatureType::Achievements:
-        return m_clientSettings->count(GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL);
-    case FeatureType::GameStateCloudSaving:
-        return m_clientSettings->count(GameKit::ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL);
-    default:
-        return false;
+        return GAMEKIT_SUCCESS;
     }
+
+    bool retryable = true;
+    return refreshTokens(retryable);
+}
+
+bool GameKitSessionManager::AreSettingsLoaded(FeatureType featureType) const
+{
+    return GetClientSettingsSnapshot()->AreSettingsLoaded(featureType);
 }
 
 std::map<std::string, std::string> GameKitSessionManager::GetClientSettings() const
 {
-    return *m_clientSettings;
+    return GetClientSettingsSnapshot()->GetSettings();
+}
+
+std::shared_ptr<const ClientSettingsSnapshot> GameKitSessionManager::GetClientSettingsSnapshot() const
+{
+    return std::atomic_load(&m_clientSettings);
 }
 
 void GameKitSessionManager::ReloadConfigFile(const std::string& clientConfigFile)
@@ -146,7 +213,7 @@ void GameKitSessionManager::ReloadConfigFile(const std::string& clientConfigFile
     // new game, env, or non existent path, unload previous settings
     else
     {
-        m_clientSettings->clear();
+        publishClientSettings(std::map<std::string, std::string>());
     }
 }
 
@@ -155,7 +222,7 @@ void GameKitSessionManager::ReloadConfigFromFileContents(const std::string& clie
     Logger::Logging::Log(m_logCb, Logger::Level::Info, "GameKitSessionManager::ReloadConfigFromFileContents()");
     if (clientConfigFileContents.size() == 0)
     {
-        m_clientSettings->clear();
+        publishClientSettings(std::map<std::string, std::string>());
     }
     else
     {
@@ -166,82 +233,161 @@ void GameKitSessionManager::ReloadConfigFromFileContents(const std::string& clie
 #pragma endregion
 
 #pragma region Private Methods
-void GameKitSessionManager::loadConfigFile(const std::string& clientConfigFile) const
+void GameKitSessionManager::publishTokens(const std::function<void(SessionTokens&)>& update)
+{
+    // Copy-on-write: readers holding the previous snapshot keep seeing consistent values
+    std::shared_ptr<SessionTokens> newTokens = std::make_shared<SessionTokens>(*GetTokenSnapshot());
+    update(*newTokens);
+    newTokens->Version += 1;
+
+    std::atomic_store(&m_sessionTokens, std::shared_ptr<const SessionTokens>(newTokens));
+}
+
+void GameKitSessionManager::loadConfigFile(const std::string& clientConfigFile)
 {
-    m_clientSettings->clear();
+    std::map<std::string, std::string> settings;
     YAML::Node paramsYml;
     Utils::FileUtils::ReadFileAsYAML(clientConfigFile, paramsYml, m_logCb, "GameKitSessionManager: ");
     for (YAML::const_iterator it = paramsYml.begin(); it != paramsYml.end(); ++it)
     {
-        m_clientSettings->insert({ it->first.as<std::string>(), it->second.as<std::string>() });
+        settings.insert({ it->first.as<std::string>(), it->second.as<std::string>() });
     }
+
+    publishClientSettings(std::move(settings));
 }
 
-void GameKitSessionManager::loadConfigContents(const std::string& clientConfigFileContents) const
+void GameKitSessionManager::loadConfigContents(const std::string& clientConfigFileContents)
 {
-    m_clientSettings->clear();
+    std::map<std::string, std::string> settings;
     YAML::Node paramsYml;
     Utils::FileUtils::ReadFileContentsAsYAML(clientConfigFileContents, paramsYml, m_logCb, "GameKitSessionManager: ");
     for (YAML::const_iterator it = paramsYml.begin(); it != paramsYml.end(); ++it)
     {
-        m_clientSettings->insert({ it->first.as<std::string>(), it->second.as<std::string>() });
+        settings.insert({ it->first.as<std::string>(), it->second.as<std::string>() });
     }
+
+    publishClientSettings(std::move(settings));
 }
 
-void GameKitSessionManager::executeTokenRefresh()
+void GameKitSessionManager::publishClientSettings(std::map<std::string, std::string> settings)
 {
-    Logger::Logging::Log(m_logCb, Logger::Level::Info, "GameKitSessionManager::executeTokenRefresh()");
-    if (GetToken(TokenType::RefreshToken).empty())
+    std::atomic_store(&m_clientSettings, std::shared_ptr<const ClientSettingsSnapshot>(std::make_shared<ClientSettingsSnapshot>(std::move(settings))));
+}
+
+unsigned int GameKitSessionManager::refreshTokens(bool& outRetryable)
+{
+    outRetryable = true;
+    const std::shared_ptr<const SessionTokens> sessionTokens = GetTokenSnapshot();
+    if (sessionTokens->Get(TokenType::RefreshToken).empty())
     {
-        Logger::Logging::Log(m_logCb, Logger::Level::Info, "SessionManager::executeTokenRefresh: No refresh token present, stopping token refresh loop.");
-        m_tokenRefresher->AbortLoop();
-        return;
+        Logger::Logging::Log(m_logCb, Logger::Level::Info, "SessionManager::refreshTokens: No refresh token present.", this);
+        outRetryable = false;
+        return GAMEKIT_ERROR_TOKEN_REFRESH_FAILED;
+    }
+
+    if (m_cognitoClient == nullptr)
+    {
+        Logger::Logging::Log(m_logCb, Logger::Level::Error, "Error: SessionManager::refreshTokens: Cognito client is not initialized.", this);
+        return GAMEKIT_ERROR_TOKEN_REFRESH_FAILED;
     }
 
     auto request = CognitoModel::InitiateAuthRequest()
-        .WithClientId(m_clientSettings->operator[](GameKit::ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID).c_str())
+        .WithClientId(GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithAuthFlow(CognitoModel::AuthFlowType::REFRESH_TOKEN)
-        .AddAuthParameters("REFRESH_TOKEN", ToAwsString(GetToken(TokenType::RefreshToken)));
+        .AddAuthParameters("REFRESH_TOKEN", ToAwsString(sessionTokens->Get(TokenType::RefreshToken)));
 
     auto outcome = m_cognitoClient->InitiateAuth(request);
-
-    unsigned int retryAttempt = 1;
-    while(!outcome.IsSuccess() && retryAttempt <= MAX_REFRESH_RETRY_ATTEMPTS)
+    if (!outcome.IsSuccess())
     {
         auto error = outcome.GetError();
-        auto errorMessage = "Error: SessionManager::executeTokenRefresh: " + error.GetExceptionName() + ": " + error.GetMessage();
-        Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str());
+        auto errorMessage = "Error: SessionManager::refreshTokens: " + error.GetExceptionName() + ": " + error.GetMessage();
+        Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str(), this);
 
-        const std::string retryMessage = "SessionManager::executeTokenRefresh: Retry attempt " + std::to_string(retryAttempt) + "/" + std::to_string(MAX_REFRESH_RETRY_ATTEMPTS);
-        Logger::Logging::Log(m_logCb, Logger::Level::Info, retryMessage.c_str());
+        // An expired or revoked refresh token is rejected as NotAuthorized, only a new login can recover from it
+        outRetryable = error.GetErrorType() != Aws::CognitoIdentityProvider::CognitoIdentityProviderErrors::NOT_AUTHORIZED;
+        m_tokenRefreshFailures += 1;
+        return GAMEKIT_ERROR_TOKEN_REFRESH_FAILED;
+    }
 
-        // This must be called within a thread from m_tokenRefresher so it doesn't block.
-        std::chrono::seconds sleepDuration{retryAttempt*retryAttempt};
-        std::this_thread::sleep_for(sleepDuration);
+    Aws::String accessToken = outcome.GetResult().GetAuthenticationResult().GetAccessToken();
+    Aws::String idToken = outcome.GetResult().GetAuthenticationResult().GetIdToken();
+    int expiresIn = outcome.GetResult().GetAuthenticationResult().GetExpiresIn();
 
-        outcome = m_cognitoClient->InitiateAuth(request);
-        retryAttempt += 1;
+    {
+        // Publish both tokens in one snapshot so readers never observe a new access token with a stale id token
+        const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
+        publishTokens([&](SessionTokens& tokens)
+        {
+            tokens.Tokens[(size_t)TokenType::AccessToken] = ToStdString(accessToken);
+            tokens.Tokens[(size_t)TokenType::IdToken] = ToStdString(idToken);
+        });
     }
-    if (!outcome.IsSuccess())
+
+    m_tokenRefreshFailures = 0;
+    m_nextTokenRefresh = std::chrono::steady_clock::now() + std::chrono::seconds(getTokenRefreshInterval(expiresIn));
+
+    return GAMEKIT_SUCCESS;
+}
+
+int GameKitSessionManager::getTokenRefreshRetryDelay()
+{
+    // Exponential backoff with equal jitter: half of the delay is fixed and half is random,
+    // so clients that lost connectivity at the same time don't all retry in lockstep
+    const unsigned int exponent = std::min<unsigned int>(m_tokenRefreshFailures, MAX_REFRESH_RETRY_ATTEMPTS);
+    const int maxDelay = 1 << exponent;
+    std::uniform_int_distribution<int> jitter(0, maxDelay - maxDelay / 2);
+
+    return std::max<int>(1, maxDelay / 2 + jitter(m_tokenRefreshJitter));
+}
+
+int GameKitSessionManager::getTokenRefreshInterval(int expiresIn)
+{
+    return std::max<int>(expiresIn - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION, expiresIn / 2);
+}
+
+void GameKitSessionManager::executeTokenRefresh()
+{
+    // This runs on the m_tokenRefresher thread: it must never sleep, retries are scheduled as later ticks instead
+    Logger::Logging::Log(m_logCb, Logger::Level::Info, "GameKitSessionManager::executeTokenRefresh()");
+    const std::lock_guard<std::mutex> refreshLock(m_tokenRefreshMutex);
+
+    // The tokens were refreshed on demand after this tick was scheduled, wait until they are due again
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (m_tokenRefreshFailures == 0 && now < m_nextTokenRefresh)
     {
-        Logger::Logging::Log(m_logCb, Logger::Level::Error, "Error: SessionManager::executeTokenRefresh: Failed, will no longer retry.");
-        m_tokenRefresher->AbortLoop();
+        const int remaining = (int)std::chrono::duration_cast<std::chrono::seconds>(m_nextTokenRefresh - now).count() + 1;
+        std::stringstream buffer;
+        buffer << "SessionManager::executeTokenRefresh: Tokens were refreshed on demand, next token refresh in " << remaining << " seconds.";
+        Logger::Logging::Log(m_logCb, Logger::Level::Info, buffer.str().c_str(), this);
+
+        m_tokenRefresher->RescheduleLoop(remaining);
         return;
     }
 
-    Aws::String accessToken = outcome.GetResult().GetAuthenticationResult().GetAccessToken();
-    Aws::String idToken = outcome.GetResult().GetAuthenticationResult().GetIdToken();
-    int expiresIn = outcome.GetResult().GetAuthenticationResult().GetExpiresIn();
+    bool retryable = true;
+    if (refreshTokens(retryable) == GAMEKIT_SUCCESS)
+    {
+        const int interval = (int)std::chrono::duration_cast<std::chrono::seconds>(m_nextTokenRefresh - now).count();
+        std::stringstream buffer;
+        buffer << "SessionManager::executeTokenRefresh: Next token refresh in " << interval << " seconds.";
+        Logger::Logging::Log(m_logCb, Logger::Level::Info, buffer.str().c_str(), this);
 
-    SetToken(TokenType::AccessToken, ToStdString(accessToken));
-    SetToken(TokenType::IdToken, ToStdString(idToken));
+        m_tokenRefresher->RescheduleLoop(interval);
+        return;
+    }
+
+    if (!retryable)
+    {
+        Logger::Logging::Log(m_logCb, Logger::Level::Error, "Error: SessionManager::executeTokenRefresh: Refresh token is no longer valid, stopping token refresh loop.", this);
+        m_tokenRefresher->AbortLoop();
+        return;
+    }
 
-    // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
-    int interval = std::max<int>(expiresIn - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION, expiresIn / 2);
+    const int retryDelay = getTokenRefreshRetryDelay();
     std::stringstream buffer;
-    buffer << "SessionManager::executeTokenRefresh: Next token refresh in " << interval << " seconds.";
+    buffer << "SessionManager::executeTokenRefresh: Retry attempt " << m_tokenRefreshFailures << " in " << retryDelay << " seconds.";
     Logger::Logging::Log(m_logCb, Logger::Level::Info, buffer.str().c_str(), this);
 
-    m_tokenRefresher->RescheduleLoop(interval);
+    m_tokenRefresher->RescheduleLoop(retryDelay);
 }
 #pragma endregion
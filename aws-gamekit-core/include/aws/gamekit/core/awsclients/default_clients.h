@@ -28,6 +28,9 @@ namespace GameKit
         // These keys can be added by the client on their own instance of awsGameKitClientConfig.yml
         static const std::string SETTINGS_CA_CERT_FILE = "ca_cert_file";
         static const std::string SETTINGS_CA_CERT_PATH = "ca_cert_path";
+
+        // HTTP version used by the GameKit HTTP clients: "1.1", or "2" to negotiate HTTP/2 over TLS and multiplex requests on shared connections
+        static const std::string SETTINGS_HTTP_VERSION = "http_version";
     }
 
     class DefaultClients
@@ -129,6 +132,16 @@ namespace GameKit
 
             clientConfig.httpLibOverride = Aws::Http::TransferLibType::CURL_CLIENT;
 #endif
+
+            const auto httpVersion = clientSettings.find(ClientSettings::SETTINGS_HTTP_VERSION);
+            if (httpVersion != clientSettings.end() && httpVersion->second == "1.1")
+            {
+                clientConfig.version = Aws::Http::Version::HTTP_VERSION_1_1;
+            }
+            else if (httpVersion != clientSettings.end() && httpVersion->second == "2")
+            {
+                clientConfig.version = Aws::Http::Version::HTTP_VERSION_2TLS;
+            }
         }
     };
 }
@@ -0,0 +1,62 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <memory>
+#include <string>
+
+// AWS SDK
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClient.h>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+#include <aws/gamekit/core/logging.h>
+
+namespace GameKit
+{
+    /**
+     * @brief Registry of the low level HTTP clients shared by the GameKit features.
+     *
+     * @details Each HTTP client owns a pool of connections, and with the curl client, the TLS sessions of those connections.
+     * Features that call the same API Gateway host with the same transport settings get the same client, so a call made by one
+     * feature after login reuses the warm connections opened by another instead of paying for a new TCP and TLS handshake.
+     * Clients are created with Aws::Http::CreateHttpClient(), through whichever HttpClientFactory is installed, and are kept
+     * until Clear() is called. AwsApiInitializer clears the registry before the AWS SDK is shut down.
+     */
+    class GAMEKIT_API SharedHttpClients
+    {
+    public:
+        /**
+         * @brief Get the client shared by every caller with the same transport settings, creating it on first use.
+         *
+         * @details Only the settings the HTTP client itself uses are compared: scheme, timeouts, connection limits,
+         * keep-alive, TLS verification and certificates, proxy, redirects and HTTP version. Settings that only affect how
+         * requests are built, such as the region, don't prevent sharing.
+         *
+         * @param clientConfig The configuration the client would be created with.
+         * @param logCb Callback function for logging information and errors.
+         * @returns The shared client. nullptr if the installed HttpClientFactory can't create one, which isn't cached.
+        */
+        static std::shared_ptr<Aws::Http::HttpClient> Get(const Aws::Client::ClientConfiguration& clientConfig, FuncLogCallback logCb = nullptr);
+
+        /**
+         * @brief Release the registry's references to the shared clients. Callers that hold a client keep it alive.
+        */
+        static void Clear();
+
+        /**
+         * @brief Get the number of clients currently held by the registry.
+        */
+        static size_t GetClientCount();
+
+        /**
+         * @brief Build the key clients are shared by. Two configurations share a client when their keys are equal.
+         *
+         * @details The proxy credentials are part of the key as a SHA-256 digest, never in plain text.
+        */
+        static std::string GetConfigurationKey(const Aws::Client::ClientConfiguration& clientConfig);
+    };
+}
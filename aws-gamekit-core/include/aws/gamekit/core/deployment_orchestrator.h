@@ -4,6 +4,7 @@
 #pragma once
 
 // Standard library
+#include <chrono>
 #include <functional>
 #include <shared_mutex>
 #include <unordered_map>
@@ -13,6 +14,7 @@
 #include <aws/gamekit/core/awsclients/api_initializer.h>
 #include <aws/gamekit/core/enums.h>
 #include <aws/gamekit/core/exports.h>
+#include <aws/gamekit/core/feature_deployment_scheduler.h>
 #include <aws/gamekit/core/feature_resources.h>
 #include <aws/gamekit/core/gamekit_account.h>
 
@@ -37,6 +39,13 @@ namespace GameKit
         mutable std::shared_timed_mutex m_featureStatusMutex;
         std::unordered_map<FeatureType, FeatureStatus> m_featureStatusMap;
 
+        // RefreshFeatureStatuses() reuses the statuses refreshed from CloudFormation within this duration, except before deployments
+        // which invalidate the refresh first. Also serializes concurrent refreshes, so callers arriving during a refresh reuse its result.
+        static constexpr std::chrono::seconds FEATURE_STATUSES_REFRESH_TTL = std::chrono::seconds(5);
+        std::mutex m_featureStatusesRefreshMutex;
+        std::chrono::steady_clock::time_point m_featureStatusesRefreshTime; // Guarded by m_featureStatusesRefreshMutex
+        bool m_featureStatusesRefreshed = false; // Guarded by m_featureStatusesRefreshMutex
+
         // Lazy-loaded FeatureResources instances
         std::mutex m_featureResourcesMutex;
         std::unordered_map<FeatureType, std::shared_ptr<GameKitFeatureResources>> m_featureResourcesMap;
@@ -54,15 +63,10 @@ namespace GameKit
         AccountInfoCopy m_accountInfo;
         AccountCredentialsCopy m_accountCredentials;
 
-        const std::unordered_map<FeatureType, std::unordered_set<FeatureType>> m_featureDependencies =
-        {
-            { FeatureType::Main, { } },
-            { FeatureType::Identity, { } },
-            { FeatureType::Achievements, { FeatureType::Identity } },
-            { FeatureType::GameStateCloudSaving, { FeatureType::Identity } },
-            { FeatureType::UserGameplayData, { FeatureType::Identity } }
-            // Every feature has an implicit dependency on FeatureType::Main, which is enforced through the deployment processes
-        };
+        const FeatureDependencies m_featureDependencies = FEATURE_DEPENDENCIES;
+
+        // Features deployed concurrently share the account's API Gateway stage; its deployments are serialized
+        std::mutex m_apiGatewayStageMutex;
 
         // Enabled GameKit features
         const std::unordered_set<FeatureType> m_availableFeatures { FeatureType::Main, FeatureType::Identity, FeatureType::Achievements, FeatureType::GameStateCloudSaving, FeatureType::UserGameplayData };
@@ -92,9 +96,13 @@ namespace GameKit
 
         unsigned int deployFeature(FeatureType feature);
         unsigned int validateAndDeployFeature(FeatureType feature);
+        unsigned int createOrRedeployMainStack();
         unsigned int createOrRedeployFeatureAndMainStack(FeatureType feature, std::function<bool(FeatureType)> isFeatureStateValid);
         unsigned int validateFeatureSettings(FeatureType featureType) const;
 
+        void updateFeatureStatusFromStackStatus(FeatureType feature, const std::string& cloudFormationStatus);
+        void invalidateFeatureStatusesRefresh();
+
         unsigned int invokeDeploymentResponseCallback(DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback, unsigned int callStatus) const;
         bool invokeCanExecuteDeploymentActionCallback(DISPATCH_RECEIVER_HANDLE receiver, CanExecuteDeploymentActionCallback callback, FeatureType targetFeature, bool canExecuteAction, DeploymentActionBlockedReason reason, std::unordered_set<FeatureType> blockingFeatures = std::unordered_set<FeatureType>()) const;
 
@@ -122,6 +130,16 @@ namespace GameKit
         virtual bool IsAnyFeatureUpdating() const;
         
         virtual unsigned int RefreshFeatureStatus(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
+
+        /**
+         * @brief Refresh the status of every feature from CloudFormation.
+         *
+         * @details All the feature stacks are described with a single paginated DescribeStacks sweep, falling back to one call per
+         * feature if the sweep fails. Statuses refreshed less than FEATURE_STATUSES_REFRESH_TTL ago are reused without calling CloudFormation.
+         * @param receiver (Optional) Receiver of callback.
+         * @param callback (Optional) Receives the statuses of all the features.
+         * @returns GAMEKIT_SUCCESS
+        */
         virtual unsigned int RefreshFeatureStatuses(DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
         
         virtual bool CanCreateFeature(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver = nullptr, CanExecuteDeploymentActionCallback callback = nullptr) const;
@@ -130,6 +148,7 @@ namespace GameKit
 
         virtual unsigned int CreateFeature(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
         virtual unsigned int RedeployFeature(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
+        virtual unsigned int DeployFeatures(const std::unordered_set<FeatureType>& features, DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
         virtual unsigned int DeleteFeature(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver = nullptr, DeploymentResponseCallback callback = nullptr);
 
         virtual unsigned int DescribeFeatureResources(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver, DispatchedResourceInfoCallback callback);
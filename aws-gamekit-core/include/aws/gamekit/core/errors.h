@@ -36,6 +36,7 @@ namespace GameKit
     static const unsigned int GAMEKIT_ERROR_CREDENTIALS_FILE_MALFORMED = 0x164;
     static const unsigned int GAMEKIT_ERROR_REQUEST_TIMED_OUT = 0x165;
     static const unsigned int GAMEKIT_ERROR_SETTINGS_MISSING = 0x166;
+    static const unsigned int GAMEKIT_ERROR_REQUEST_CANCELLED = 0x167;
    
     // Bootstrapping status codes (501-1000)
     static const unsigned int GAMEKIT_ERROR_BOOTSTRAP_BUCKET_LOOKUP_FAILED = 0x1F5;
@@ -74,6 +75,7 @@ namespace GameKit
     static const unsigned int GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_STATE = 0x5DD;
     static const unsigned int GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_SETTINGS = 0x5DE;
     static const unsigned int GAMEKIT_ERROR_ORCHESTRATION_DEPLOYMENT_IN_PROGRESS = 0x5DF;
+    static const unsigned int GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED = 0x5E0;
 
     // Identity status codes (0x10000 - 0x103FF)
     static const unsigned int GAMEKIT_ERROR_REGISTER_USER_FAILED = 0x10000;
@@ -88,6 +90,7 @@ namespace GameKit
     static const unsigned int GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER = 0x10010;
 
     // Authentication status codes (0x10400 - 0x107FF)
+    static const unsigned int GAMEKIT_ERROR_TOKEN_REFRESH_FAILED = 0x10400;
 
     // Achievements status codes (0x10800 - 0x10BFF)
     static const unsigned int GAMEKIT_ERROR_ACHIEVEMENTS_ICON_UPLOAD_FAILED = 0x10800;
@@ -17,6 +17,7 @@
 #include <aws/gamekit/core/logging.h>
 #include <aws/gamekit/core/model/account_credentials.h>
 #include <aws/gamekit/core/model/account_info.h>
+#include <aws/gamekit/core/model/request_metrics_snapshot.h>
 
 namespace GameKit { namespace Utils { class STSUtils; } }
 
@@ -120,6 +121,15 @@ extern "C"
      * @param resourceStatus The status of the resource being deployed.
      */
     typedef void(*DispatchedResourceInfoCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* logicalResourceId, const char* resourceType, const char* resourceStatus);
+
+    /**
+     * @brief A static dispatcher function pointer that receives the request metrics of every endpoint.
+     *
+     * @param dispatchReceiver A pointer to an instance of a class where the results will be dispatched to.
+     * @param snapshots Array of snapshots, one per endpoint, sorted by endpoint name. Only valid during the callback.
+     * @param snapshotCount Number of snapshots in the array.
+     */
+    typedef void(*RequestMetricsCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const GameKit::RequestMetricsSnapshot* snapshots, unsigned int snapshotCount);
 }
 
 extern "C"
@@ -137,6 +147,52 @@ extern "C"
     GAMEKIT_API unsigned int GameKitShutdownAwsSdk(FuncLogCallback logCb);
 #pragma endregion
 
+#pragma region Logging
+    /**
+     * @brief Set the lowest log level passed to the log callbacks of every GameKit API. Messages below it are dropped before being formatted.
+     *
+     * @param level The minimum level, see GameKit::Logger::Level. Defaults to 0 (None), which logs everything. Values above 4 (Error) disable logging.
+     */
+    GAMEKIT_API void GameKitSetMinimumLogLevel(unsigned int level);
+
+    /**
+     * @brief Choose how log records are delivered to the log callbacks of every GameKit API.
+     *
+     * @details In the queued modes, threads that log never wait on the callbacks, which is useful when callbacks are marshalled into managed code.
+     * Records that don't fit in the full queue are dropped, see GameKitGetDroppedLogCount().
+     *
+     * @param mode 0 (Synchronous, default): callbacks are invoked on the thread that logs. 1 (Background): a GameKit thread delivers records in batches.
+     * 2 (Manual): records are delivered when GameKitFlushLogs() is called.
+     */
+    GAMEKIT_API void GameKitSetLogDeliveryMode(unsigned int mode);
+
+    /**
+     * @brief Deliver the queued log records on the calling thread, in the order they were logged.
+     *
+     * @return The number of records delivered.
+     */
+    GAMEKIT_API unsigned int GameKitFlushLogs();
+
+    /**
+     * @brief Get the number of log records dropped because the queue was full, since the process started.
+     */
+    GAMEKIT_API unsigned long long GameKitGetDroppedLogCount();
+#pragma endregion
+
+#pragma region Request Metrics
+    /**
+     * @brief Get the request counts, latency percentiles, retries, drops, queue depth, bytes transferred and cache hits of every endpoint called by the GameKit features.
+     *
+     * @details Recording metrics never blocks the threads making requests. Call this periodically to forward the metrics to a telemetry service.
+     *
+     * @param dispatchReceiver Pointer to the caller object (object that will handle the callback function).
+     * @param resultCallback Pointer to the callback function that receives the snapshots.
+     * @param reset If true, the metrics are reset as they are read, so the next call only covers what happened since this one.
+     * @return GAMEKIT_SUCCESS.
+     */
+    GAMEKIT_API unsigned int GameKitGetRequestMetrics(DISPATCH_RECEIVER_HANDLE dispatchReceiver, RequestMetricsCallback resultCallback, bool reset);
+#pragma endregion
+
 #pragma region GameKitAccount
     // -------- Static functions, these don't require a GameKitAccount instance handle
     /**
@@ -1144,6 +1200,25 @@ extern "C"
      */
     GAMEKIT_API unsigned int GameKitDeploymentOrchestratorRedeployFeature(GAMEKIT_DEPLOYMENT_ORCHESTRATOR_INSTANCE_HANDLE deploymentOrchestratorInstance, GameKit::FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback resultCb);
 
+    /**
+     * @brief Create or re-deploy several features, deploying independent features concurrently.
+     *
+     * @details This is a long running operation. The main stack is deployed first, then each feature is deployed as soon as
+     * the upstream features it depends on are deployed. A feature can be created in the same call as its upstream features.
+     *
+     * @param deploymentOrchestratorInstance Pointer to a GameKitDeploymentOrchestrator instance created with GameKitDeploymentOrchestratorCreate().
+     * @param features Array of the GameKit features to deploy.
+     * @param featureCount Number of features in the array.
+     * @param receiver This pointer will be passed to the resultCb function as the `dispatchReceiver`.
+     * @param resultCb A callback function passed an array of features and their statuses, as well as the status of the call once complete.
+     * @return The result code of the operation.
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_STATE: A feature or one of its dependencies is in an invalid state for deployment.
+     * - GAMEKIT_ERROR_ORCHESTRATION_DEPLOYMENT_IN_PROGRESS: A feature or one of its dependencies is already being deployed.
+     * - GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED: A feature was not deployed because one of its dependencies failed to deploy.
+     */
+    GAMEKIT_API unsigned int GameKitDeploymentOrchestratorDeployFeatures(GAMEKIT_DEPLOYMENT_ORCHESTRATOR_INSTANCE_HANDLE deploymentOrchestratorInstance, const GameKit::FeatureType* features, unsigned int featureCount, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback resultCb);
+
     /**
      * @brief Delete a requested feature.
      *
@@ -0,0 +1,56 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+#include <aws/gamekit/core/enums.h>
+
+namespace GameKit
+{
+    typedef std::unordered_map<FeatureType, std::unordered_set<FeatureType>> FeatureDependencies;
+
+    // Upstream dependencies of each feature.
+    // Every feature has an implicit dependency on FeatureType::Main, which is enforced through the deployment processes
+    static const FeatureDependencies FEATURE_DEPENDENCIES =
+    {
+        { FeatureType::Main, { } },
+        { FeatureType::Identity, { } },
+        { FeatureType::Achievements, { FeatureType::Identity } },
+        { FeatureType::GameStateCloudSaving, { FeatureType::Identity } },
+        { FeatureType::UserGameplayData, { FeatureType::Identity } }
+    };
+
+    /**
+     * @brief Deploys a set of features in dependency order, deploying independent features concurrently.
+     */
+    class GAMEKIT_API FeatureDeploymentScheduler
+    {
+    public:
+        /**
+         * @brief Call deployFeature once for every feature, as soon as the upstream features it depends on are deployed.
+         *
+         * @details Each call runs on its own thread, so the total time is the time of the slowest dependency chain rather than
+         * the sum of all deployments. Only dependencies that are part of features are waited for, others are assumed to be deployed.
+         * When a feature fails, the features that depend on it are skipped and the independent ones are still deployed.
+         *
+         * @param features The features to deploy.
+         * @param dependencies Upstream dependencies of each feature, usually FEATURE_DEPENDENCIES.
+         * @param deployFeature Deploys one feature and returns a GameKit status code. Must be safe to call concurrently.
+         * @param returnedResults Receives the result of every feature. Skipped features get GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED.
+         * @returns GAMEKIT_SUCCESS if all features were deployed, otherwise the first error returned by deployFeature.
+         * GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED if the dependencies are circular.
+        */
+        static unsigned int DeployInDependencyOrder(
+            const std::unordered_set<FeatureType>& features,
+            const FeatureDependencies& dependencies,
+            const std::function<unsigned int(FeatureType)>& deployFeature,
+            std::unordered_map<FeatureType, unsigned int>& returnedResults);
+    };
+}
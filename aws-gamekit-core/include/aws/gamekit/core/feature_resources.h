@@ -7,6 +7,7 @@
 #include <fstream>
 #include <iostream>
 #include <regex>
+#include <unordered_map>
 #include <unordered_set>
 
 // AWS SDK
@@ -28,6 +29,7 @@
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/ssm/SSMClient.h>
 #include <aws/ssm/model/GetParameterRequest.h>
+#include <aws/ssm/model/GetParametersRequest.h>
 #include <aws/ssm/model/PutParameterRequest.h>
 
 // GameKit
@@ -44,6 +46,7 @@
 #include <aws/gamekit/core/model/template_consts.h>
 #include <aws/gamekit/core/paramstore_keys.h>
 #include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/template_utils.h>
 #include <aws/gamekit/core/zipper.h>
 
 // yaml-cpp
@@ -80,6 +83,9 @@ namespace GameKit
         std::string m_layersReplacementId;
         std::string m_functionsReplacementId;
 
+        // Hashes of the layers zipped by CompressFeatureLayers(), keyed by layer name. Recorded in Parameter Store once the layers are published.
+        std::unordered_map<std::string, std::string> m_compressedLayerHashes;
+
         std::string m_pluginRoot;
         std::string m_gamekitRoot;
         std::string m_baseLayersPath;
@@ -90,19 +96,15 @@ namespace GameKit
         std::string m_instanceFunctionsPath;
         std::string m_instanceCloudformationPath;
 
-        std::unordered_map<std::string, bool> m_resouceStatusMap;
-
         Aws::Vector<Aws::CloudFormation::Model::Parameter> getStackParameters(TemplateType templateType) const;
-        std::string getRawStackParameters(TemplateType templateType) const;
-        std::string getFeatureDashboardTemplate(TemplateType templateType) const;
         std::string getCloudFormationTemplate(TemplateType templateType) const;
+        std::shared_ptr<const GameKit::Utils::ParsedTemplate> loadTemplate(TemplateType templateType, const std::string& fileName) const;
+        std::unordered_map<std::string, std::string> getSystemVariables(const std::string& shortRegionCode) const;
         unsigned int createStack() const;
         unsigned int updateStack() const;
         unsigned int deleteStack() const;
-        Aws::CloudFormation::Model::StackStatus periodicallyDescribeStackEvents();
-        void describeStackEvents();
+        Aws::CloudFormation::Model::StackStatus waitForStackOperation() const;
         unsigned int getDeployedTemplateBody(const std::string& stackName, std::string& templateBody) const;
-        bool isTerminalState(Aws::CloudFormation::Model::StackStatus status);
         bool isFailedState(Aws::CloudFormation::Model::StackStatus status);
         std::string getTempLayersPath() const;
         std::string getTempFunctionsPath() const;
@@ -116,10 +118,20 @@ namespace GameKit
         unsigned int removeOutputsFromClientConfiguration() const;
         unsigned int writeClientConfigurationWithOutputs(Aws::Vector<Aws::CloudFormation::Model::Output> outputs) const;
         std::string getFeatureLayerNameFromDirName(const std::string& layerDirName) const;
-        Aws::Lambda::Model::PublishLayerVersionOutcome createFeatureLayer(const std::string& layerDirName, const std::string& s3ObjectName);
-        bool lambdaLayerHashChanged(const std::string& layerName, const std::string& layerHash) const;
-        unsigned int createAndSetLambdaLayerHash(const std::string& layerName, const std::string& layerHash) const;
-        unsigned int createAndSetLambdaLayerArn(const std::string& layerName, const std::string& layerArn) const;
+        Aws::Lambda::Model::PublishLayerVersionOutcome createFeatureLayer(const std::string& layerDirName, const std::string& s3ObjectName, const std::string& bootstrapBucketName);
+
+        // Lambda layer hashes and ARNs are read from Parameter Store in batches
+        unsigned int getParameters(const std::vector<std::string>& paramNames, std::unordered_map<std::string, Aws::SSM::Model::Parameter>& returnedParams) const;
+        void getChangedLambdaLayerHashes(const std::vector<std::string>& layerDirectories, std::unordered_map<std::string, std::string>& returnedLayerHashes) const;
+        unsigned int recordPublishedLambdaLayers(const std::vector<std::tuple<std::string, std::string, std::string>>& layers) const; // Tuples of layer name, hash and ARN
+
+        // Per-artifact stages of the layer and function deployment pipelines. They are called concurrently for different artifacts.
+        std::vector<std::string> getArtifactPaths(const std::string& parentPath, bool directories) const;
+        unsigned int compressFeatureLayer(const std::string& layerDirectory, std::string& returnedZipFileName) const;
+        unsigned int uploadFeatureLayer(const std::string& zipFile, const std::string& bootstrapBucketName, std::string& returnedLayerArn);
+        unsigned int compressFeatureFunction(const std::string& functionDirectory, std::string& returnedZipFileName) const;
+        unsigned int uploadFeatureFunction(const std::string& zipFile, const std::string& bootstrapBucketName) const;
+        unsigned int putArtifact(const std::string& zipFile, const std::string& objectName, const std::string& bootstrapBucketName) const;
         std::string getShortRegionCode();
 
         std::string getStackName(FeatureType featureType) const;
@@ -339,6 +351,25 @@ namespace GameKit
         virtual unsigned int DeployFeatureFunctions();
         
         virtual std::string GetCurrentStackStatus() const;
+
+        /**
+         * @brief Describe several stacks of the account with a single paginated DescribeStacks sweep.
+         *
+         * @details Pagination stops as soon as every stack is found. The sweep is limited to the first pages, stacks it didn't find
+         * are then described by name. Stacks that don't exist are not returned.
+         * @param stackNames Names of the stacks to describe, see GetStackName().
+         * @param returnedStacks Receives the description of every stack found, keyed by stack name.
+         * @returns GAMEKIT_SUCCESS, or GAMEKIT_ERROR_CLOUDFORMATION_DESCRIBE_STACKS_FAILED if a page could not be retrieved.
+        */
+        virtual unsigned int DescribeFeatureStacks(const std::unordered_set<std::string>& stackNames, std::unordered_map<std::string, Aws::CloudFormation::Model::Stack>& returnedStacks) const;
+
+        /**
+         * @brief Same as GetCurrentStackStatus(), for a stack that was already described, see DescribeFeatureStacks().
+         *
+         * @param describedStack Description of this feature's stack, or nullptr if the stack doesn't exist.
+         * @returns The stack status, or ERR_STACK_CURRENT_STATUS_UNDEPLOYED.
+        */
+        virtual std::string GetStackStatusFromDescription(const Aws::CloudFormation::Model::Stack* describedStack) const;
         virtual void UpdateDashboardDeployStatus(std::unordered_set<FeatureType> features) const;
         virtual unsigned int CreateOrUpdateFeatureStack();
         virtual unsigned int DeleteFeatureStack();
@@ -3,6 +3,9 @@
 
 #pragma once
 
+// Standard Library
+#include <functional>
+
 // AWS SDK
 #include <aws/apigateway/model/CreateDeploymentRequest.h>
 #include <aws/apigateway/model/Op.h>
@@ -81,10 +84,14 @@ namespace GameKit
         bool isFunctionsPathValid(TemplateType templateType);
         bool isCloudFormationPathValid(TemplateType templateType);
         unsigned int createSecret(const std::string& secretId, const std::string& secretValue);
-        unsigned int updateSecret(const std::string& secretId, const std::string& secretValue);
+        unsigned int updateSecret(const std::string& secretId, const std::string& secretValue, bool& returnedSecretNotFound);
         unsigned int deleteSecret(const std::string& secretId);
         std::string getShortRegionCode();
 
+        // Calls featureTask with the name and path of every feature directory in featuresPath, several features at a time
+        unsigned int forEachFeatureDirectory(const std::string& featuresPath, const std::function<unsigned int(const std::string& featureName, const std::string& featureDirectory)>& featureTask) const;
+        Aws::UniquePtr<GameKitFeatureResources> createFeatureResources(const std::string& featureName) const;
+
     public:
         GameKitAccount(const AccountInfo& accountInfo, const AccountCredentials& credentials, FuncLogCallback logCallback);
         GameKitAccount(const AccountInfoCopy& accountInfo, const AccountCredentialsCopy& credentials, FuncLogCallback logCallback);
@@ -57,6 +57,14 @@ namespace GameKit
      *
      * The file is loaded during the constructor, and can be reloaded by calling Reload().
      * Call SaveSettings() to write the settings to back to disk after making modifications with any "Set", "Add/Delete", "Activate/Deactivate" methods.
+     *
+     * Parsed settings are kept in memory and shared by every instance of the process, so creating an instance only parses the file
+     * when its size or contents changed since it was last loaded or saved. Instances copy the shared settings on their first modification.
+     * Saves are written behind: a save is written immediately unless the same file was written less than a moment ago, in which case
+     * it is coalesced with the following saves into a single write, including saves of other instances. Pending saves are written
+     * by Reload() and FlushSettings(), shortly after the last save, and by AwsApiInitializer::Shutdown(). Instances created meanwhile
+     * load the pending settings. A coalesced write that fails stays pending: the next SaveSettings() or FlushSettings() retries it
+     * and returns the failure.
      */
     class GAMEKIT_API GameKitSettings
     {
@@ -68,6 +76,11 @@ namespace GameKit
         YAML::Node m_gamekitYamlSettings;
         FuncLogCallback m_logCb;
 
+        // False while m_gamekitYamlSettings is shared with the settings cache and other instances
+        bool m_ownsSettings = false;
+
+        YAML::Node& writableSettings();
+
         static unsigned int readAwsCredentials(const std::string& profileName, Aws::Config::AWSConfigFileProfileConfigLoader& configLoader, const std::string& credentialsFileLocation, Aws::Auth::AWSCredentials& credentials, Aws::Config::AWSProfileConfigLoader::ProfilesContainer& profiles, FuncLogCallback logCb);
         static unsigned int persistAwsProfiles(Aws::Config::AWSConfigFileProfileConfigLoader& configLoader, const std::string& credentialsFileLocation, const Aws::Config::AWSProfileConfigLoader::ProfilesContainer& profiles, FuncLogCallback logCb);
     public:
@@ -95,6 +108,20 @@ namespace GameKit
         std::string GetSettingsFilePath() const;
         void Reload();
 
+        /**
+         * @brief Write the pending saves of this instance's settings file now.
+         *
+         * @returns GAMEKIT_SUCCESS when nothing is pending or the write succeeded, GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED otherwise.
+        */
+        unsigned int FlushSettings();
+
+        /**
+         * @brief Write the pending saves of every settings file and stop the background writer. Called by AwsApiInitializer::Shutdown().
+         *
+         * @returns GAMEKIT_SUCCESS, or GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED if any write failed.
+        */
+        static unsigned int Shutdown();
+
         static unsigned int SaveAwsCredentials(const std::string& profileName, const std::string& accessKey, const std::string& secretKey, FuncLogCallback logCb);
         static bool AwsProfileExists(const std::string& profileName);
         static unsigned int SetAwsAccessKey(const std::string& profileName, const std::string& newAccessKey, FuncLogCallback logCb);
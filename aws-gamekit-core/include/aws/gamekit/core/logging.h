@@ -16,6 +16,21 @@ extern "C"
     typedef void(*FuncLogCallback)(unsigned int level, const char* message, int size);
 }
 
+/**
+ * @brief Log a message only when the callback is set and the level passes the minimum level.
+ *
+ * @details The message arguments are not evaluated otherwise, so messages built with string concatenation
+ * cost nothing when their level is disabled. Use it for messages logged on every request.
+ */
+#define GAMEKIT_LOG(cb, level, ...) \
+    do \
+    { \
+        if (GameKit::Logger::Logging::IsEnabled((cb), (level))) \
+        { \
+            GameKit::Logger::Logging::Log((cb), (level), __VA_ARGS__); \
+        } \
+    } while (0)
+
 namespace GameKit
 {
     namespace Logger
@@ -29,11 +44,76 @@ namespace GameKit
             Error = 4
         };
 
+        /**
+         * @brief How log records reach the log callbacks.
+         */
+        enum class DeliveryMode
+        {
+            // The callback is invoked on the thread that logs.
+            Synchronous = 0,
+
+            // Records are queued and delivered in batches by a GameKit thread.
+            Background = 1,
+
+            // Records are queued until the application calls Logging::FlushLogs(), e.g. once per frame from the engine's main thread.
+            Manual = 2
+        };
+
         class GAMEKIT_API Logging
         {
         public:
             static void Log(FuncLogCallback cb, Level level, const char* message);
             static void Log(FuncLogCallback cb, Level level, const char* message, const void* context);
+            static void Log(FuncLogCallback cb, Level level, const std::string& message);
+            static void Log(FuncLogCallback cb, Level level, const std::string& message, const void* context);
+
+            /**
+             * @brief Set the lowest level that is passed to log callbacks. Messages below it are dropped before being formatted.
+             *
+             * @details Applies to the whole process. Defaults to Level::None, which logs everything.
+             *
+             * @param level The minimum level. Values above Level::Error disable logging.
+            */
+            static void SetMinimumLevel(unsigned int level);
+            static void SetMinimumLevel(Level level);
+            static unsigned int GetMinimumLevel();
+
+            /**
+             * @brief Check if a message would reach the callback, before spending time building it.
+            */
+            static bool IsEnabled(FuncLogCallback cb, Level level);
+
+            /**
+             * @brief Choose how log records are delivered to the log callbacks.
+             *
+             * @details In the queued modes, logging threads copy the formatted record into a fixed-size lock-free queue and
+             * never wait on the callbacks. Records that don't fit in a full queue are dropped and counted by GetDroppedCount().
+             * Callbacks must stay valid until their records are delivered. Switching back to Synchronous delivers the queued records first.
+             *
+             * @param mode The delivery mode. Defaults to DeliveryMode::Synchronous.
+            */
+            static void SetDeliveryMode(DeliveryMode mode);
+            static DeliveryMode GetDeliveryMode();
+
+            /**
+             * @brief Deliver the queued log records on the calling thread, in the order they were logged.
+             *
+             * @returns The number of records delivered.
+            */
+            static unsigned int FlushLogs();
+
+            /**
+             * @brief Get the number of records dropped because the queue was full, since the process started.
+            */
+            static unsigned long long GetDroppedCount();
+
+            /**
+             * @brief Stop the background delivery thread and deliver the queued records, then go back to Synchronous delivery.
+             *
+             * @details Called by AwsApiInitializer::Shutdown(). The thread is never joined at process exit, where joining
+             * from a static destructor can deadlock.
+            */
+            static void Shutdown();
         };
     }
 }
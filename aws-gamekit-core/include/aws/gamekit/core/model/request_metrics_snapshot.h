@@ -0,0 +1,38 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+namespace GameKit
+{
+    // Marshallable struct to be used with P/Invoke. Metrics of one endpoint, see GameKitGetRequestMetrics().
+    struct RequestMetricsSnapshot
+    {
+        const char* endpoint;
+
+        // Requests that were sent, including retries. Failed requests didn't get a 2xx response.
+        unsigned long long requestCount;
+        unsigned long long failedRequestCount;
+        unsigned long long retryCount;
+
+        // Requests that were never sent because a queue was full
+        unsigned long long droppedCount;
+
+        // Operations waiting in the endpoint's retry queue, sampled each time the queue is processed
+        long long queueDepth;
+
+        // Sum of the request and response Content-Length headers
+        unsigned long long bytesSent;
+        unsigned long long bytesReceived;
+
+        unsigned long long cacheHitCount;
+        unsigned long long cacheMissCount;
+
+        // Client-side latency. Percentiles are accurate to 12.5%.
+        unsigned long long latencyMeanMicroseconds;
+        unsigned long long latencyP50Microseconds;
+        unsigned long long latencyP90Microseconds;
+        unsigned long long latencyP99Microseconds;
+        unsigned long long latencyMaxMicroseconds;
+    };
+}
@@ -0,0 +1,104 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// AWS SDK
+#include <aws/cloudformation/CloudFormationClient.h>
+#include <aws/cloudformation/model/StackStatus.h>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+#include <aws/gamekit/core/logging.h>
+
+namespace GameKit
+{
+    /**
+     * @brief Polls CloudFormation stacks that are being created, updated or deleted until their operations complete.
+     *
+     * @details A single background thread serves every watched stack, so deployments don't each spend a thread on polling.
+     * Each stack is polled with an adaptive interval: the interval is reset to the minimum whenever the stack reports progress,
+     * grows while nothing changes, and backs off further when CloudFormation throttles requests.
+     * Stack events are paged with NextToken on every poll, so every event that happened since the previous poll is logged.
+     * The thread is started when the first stack is watched and exits when no stack is left to watch or Shutdown() is called.
+     */
+    class GAMEKIT_API StackWatcher
+    {
+    private:
+        struct WatchedStack;
+
+        std::chrono::milliseconds m_minPollInterval;
+        std::chrono::milliseconds m_maxPollInterval;
+
+        std::mutex m_watchedStacksMutex;
+        std::condition_variable m_watchedStacksChanged;
+        std::vector<std::shared_ptr<WatchedStack>> m_watchedStacks; // Guarded by m_watchedStacksMutex
+        std::thread m_poller; // Guarded by m_watchedStacksMutex
+        bool m_pollerRunning = false; // Guarded by m_watchedStacksMutex
+        bool m_stopPolling = false; // Guarded by m_watchedStacksMutex
+
+        void pollStacks();
+        bool pollStack(WatchedStack& stack) const;
+        bool logNewStackEvents(WatchedStack& stack) const;
+
+    public:
+        /**
+         * @brief Create a watcher. Prefer the shared instance returned by GetInstance().
+         *
+         * @param minPollInterval The delay between polls of a stack that is making progress.
+         * @param maxPollInterval The longest delay between polls of a stack that isn't making progress or is throttled.
+        */
+        StackWatcher(std::chrono::milliseconds minPollInterval, std::chrono::milliseconds maxPollInterval);
+        ~StackWatcher();
+
+        StackWatcher(const StackWatcher&) = delete;
+        StackWatcher& operator=(const StackWatcher&) = delete;
+
+        /**
+         * @brief Get the watcher shared by all the features of the process.
+         *
+         * @details The shared watcher is never destroyed, AwsApiInitializer::Shutdown() stops its thread.
+        */
+        static StackWatcher& GetInstance();
+
+        /**
+         * @brief Stop polling and wait for the polling thread to exit.
+         *
+         * @details Stacks still being watched are given their last known status, NOT_SET if they were never described.
+         * Watching a stack afterwards starts a new thread.
+        */
+        void Shutdown();
+
+        /**
+         * @brief Start watching a stack whose create, update or delete operation was just started.
+         *
+         * @details The stack is polled until it reaches a terminal state, or until DescribeStacks fails with an error that
+         * isn't retryable, which is how a completed deletion is reported. When DescribeStacks keeps failing with retryable errors,
+         * the stack is given up on and reported in the failed state of its last known operation, CREATE_FAILED if it was never described.
+         * Progress is logged with logCb as stack events arrive.
+         * The client must stay valid until the returned future is ready.
+         *
+         * @param cfClient The CloudFormation client used to describe the stack and its events.
+         * @param stackName Name of the stack to watch.
+         * @param logCb Callback function for logging information and errors.
+         * @param logContext Context passed to logCb, usually the object that started the stack operation.
+         * @returns A future that receives the last known status of the stack. NOT_SET if the stack could never be described.
+        */
+        std::shared_future<Aws::CloudFormation::Model::StackStatus> Watch(Aws::CloudFormation::CloudFormationClient* cfClient, const std::string& stackName, FuncLogCallback logCb, const void* logContext);
+
+        /**
+         * @brief Check if a stack status ends a create, update or delete operation.
+        */
+        static bool IsTerminalState(Aws::CloudFormation::Model::StackStatus status);
+    };
+}
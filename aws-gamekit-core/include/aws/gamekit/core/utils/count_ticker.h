@@ -29,8 +29,10 @@ namespace GameKit
 
         protected:
             void startNewInterval(int intervalSeconds) override;
+            void startNewInterval(std::chrono::milliseconds interval) override;
             void countDownInterval(std::chrono::milliseconds sleepTime) override;
             bool isIntervalOver() const override;
+            std::chrono::milliseconds getIntervalTimeLeft() const override;
 
         public:
             CountTicker(int interval, std::function<void()> tickFunc, FuncLogCallback logCb)
@@ -41,6 +41,9 @@ namespace GameKit
             /**
             * @brief Calculates the hash of an entire directory.
             *
+            * @details Files are streamed and hashed in parallel. Per-file digests are cached by path, size and last write time,
+            * and persisted in the temp directory, so files that didn't change since they were last hashed are not read again.
+            *
             * @param directoryPath The absolute or relative path of the directory to hash (UTF-8 encoded). Example: "foo", "..\\foo", or "C:\\Program Files\\foo".
             * @param returnedString (Out Parameter) The string to write into. If the operation fails, the string will be empty: "".
             * @param logCallback (Optional) If provided and the operation fails, will log a human readable error message.
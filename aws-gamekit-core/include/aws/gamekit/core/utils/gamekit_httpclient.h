@@ -26,6 +26,7 @@
 #include <aws/gamekit/core/utils/gamekit_httpclient_types.h>
 #include <aws/gamekit/core/utils/gamekit_httpclient_callbacks.h>
 #include <aws/gamekit/core/utils/count_ticker.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 
 using namespace GameKit::Logger;
 
@@ -49,6 +50,8 @@ namespace GameKit
                 GameKit::Utils::CountTicker m_requestPump;
                 bool m_abortProcessingRequested;
                 std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
+                RequestMetrics::Endpoint* m_requestMetrics; // Named after the client, shared by the clients of the same name
+                size_t m_reportedQueueDepth = 0; // This client's share of the endpoint's queue depth, guarded by m_queueProcessingMutex
                 std::shared_ptr<IRetryStrategy> m_retryStrategy;
                 OperationQueue m_activeQueue; // this queue is only r/w in the background thread
                 OperationQueue m_pendingQueue; // this queue is always r/w under mutex
@@ -60,12 +63,15 @@ namespace GameKit
                 CacheProcessedCallback m_cachedProcessedCb;
 
                 bool enqueuePending(std::shared_ptr<IOperation> operation);
+                void tickRequestPump();
                 void preProcessQueue();
                 void processActiveQueue();
+                void reportQueueDepth(size_t queueDepth); // Must be called while holding m_queueProcessingMutex
 
             protected:
                 FuncLogCallback m_logCb = nullptr;
                 RequestModifier m_authorizationHeaderSetter;
+                UnauthorizedResponseHandler m_unauthorizedResponseHandler;
                 bool m_stopProcessingOnError;
                 bool m_errorDuringProcessing;
 
@@ -104,6 +110,10 @@ namespace GameKit
 
                 void SetNetworkChangeCallback(NETWORK_STATE_RECEIVER_HANDLE receiverHandle, NetworkStatusChangeCallback statusChangeCallback);
                 void SetCacheProcessedCallback(CACHE_PROCESSED_RECEIVER_HANDLE receiverHandle, CacheProcessedCallback cacheProcessedCallback);
+
+                // Set the handler called when a request is rejected with 401 Unauthorized. If it returns true, the request is replayed once
+                // with the authorization header set again. Must be set before the retry background thread is started.
+                void SetUnauthorizedResponseHandler(UnauthorizedResponseHandler unauthorizedHandler);
                 
                 // Start the retry background thread. This will process the requests in the internal queue.
                 void StartRetryBackgroundThread();
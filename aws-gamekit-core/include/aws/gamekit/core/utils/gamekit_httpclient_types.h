@@ -8,7 +8,9 @@
 #include <string>
 #include <deque>
 #include <map>
+#include <mutex>
 #include <chrono>
+#include <random>
 #include <sstream>
 #include <iostream>
 
@@ -95,9 +97,16 @@ namespace GameKit
             // Callback to be called before sending a request. Used to update/modify request headers such as authorization.
             typedef std::function<void(std::shared_ptr<Aws::Http::HttpRequest>)> RequestModifier;
 
+            // Callback to be called when a request is rejected with 401 Unauthorized. Receives the rejected request, whose authorization headers identify the
+            // token version it was sent with. Returns true if the authorization was refreshed and the request should be replayed.
+            typedef std::function<bool(std::shared_ptr<const Aws::Http::HttpRequest> rejectedRequest)> UnauthorizedResponseHandler;
+
             GAMEKIT_API bool TrySerializeRequestBinary(std::ostream& os, const std::shared_ptr<Aws::Http::HttpRequest> request, FuncLogCallback logCb = nullptr);
             GAMEKIT_API bool TryDeserializeRequestBinary(std::istream& is, std::shared_ptr<Aws::Http::HttpRequest>& outRequest, FuncLogCallback logCb = nullptr);
 
+            // Delay requested by a Retry-After header, given in seconds or as an HTTP date, which is compared to now. Zero when the response has no valid Retry-After header.
+            GAMEKIT_API std::chrono::milliseconds GetRetryAfter(const std::shared_ptr<const Aws::Http::HttpResponse> response, std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+
             // Base struct for retryable client operations
             struct GAMEKIT_API IOperation
             {
@@ -160,6 +169,12 @@ namespace GameKit
                 virtual void IncreaseThreshold() = 0;
                 virtual bool ShouldRetry() = 0;
                 virtual void Reset() = 0;
+
+                // Delay requested by the server for the failure that last called IncreaseThreshold(), e.g. with a Retry-After header.
+                virtual void SetRetryAfter(std::chrono::milliseconds retryAfter) { /* Ignored by default */ };
+
+                // Time left before ShouldRetry() returns true. Zero when a retry is allowed now or the strategy doesn't keep a deadline.
+                virtual std::chrono::milliseconds GetTimeUntilRetry() const { return std::chrono::milliseconds(0); };
             };
 
             // Constant Interval Strategy. With this strategy, operations are always retried in each interval.
@@ -174,23 +189,31 @@ namespace GameKit
                 virtual void Reset() override { /* No-op by design */ };
             };
 
-            // Binary Exponential Backoff Strategy. With this strategy, retries are spaced out at exponential intervals.
+            // Exponential Backoff Strategy with decorrelated jitter. With this strategy, each failure moves the next retry time to a random
+            // delay between the minimum delay and three times the previous delay, capped at the maximum delay. A delay requested by the
+            // server is honored when it's longer. The random engine is owned by the instance and all methods are thread-safe. Time is read from
+            // the given clock, the steady clock by default.
             class GAMEKIT_API ExponentialBackoffStrategy : public IRetryStrategy
             {
             private:
-                unsigned int tickCounter;
-                unsigned int maxAttempts;
-                unsigned int currentStep;
-                unsigned int retryThreshold;
+                std::chrono::milliseconds minDelay;
+                std::chrono::milliseconds maxDelay;
+                std::chrono::milliseconds currentDelay;
+                std::chrono::steady_clock::time_point retryTime;
+                std::mt19937_64 randomEngine;
+                mutable std::mutex strategyMutex;
                 FuncLogCallback logCb = nullptr;
+                SteadyClock clock;
 
             public:
-                ExponentialBackoffStrategy(unsigned int maxAttempts, FuncLogCallback logCb = nullptr);
+                ExponentialBackoffStrategy(std::chrono::milliseconds minDelay, std::chrono::milliseconds maxDelay, FuncLogCallback logCb = nullptr, SteadyClock clock = std::chrono::steady_clock::now);
                 virtual ~ExponentialBackoffStrategy();
 
                 virtual void IncreaseThreshold() override;
                 virtual bool ShouldRetry() override;
                 virtual void Reset() override;
+                virtual void SetRetryAfter(std::chrono::milliseconds retryAfter) override;
+                virtual std::chrono::milliseconds GetTimeUntilRetry() const override;
             };
 
             enum class StrategyType
@@ -0,0 +1,33 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <functional>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        class GAMEKIT_API ParallelUtils
+        {
+        public:
+            /**
+             * @brief Run tasks on a bounded pool of worker threads and wait for all of them to finish.
+             *
+             * @details Tasks are started in order. After a task fails, tasks that haven't started yet are skipped; tasks that are
+             * already running are allowed to finish. When maxConcurrency is 1, or there is a single task, tasks run on the calling thread.
+             *
+             * @param tasks The tasks to run. Each returns GAMEKIT_SUCCESS or an error code.
+             * @param maxConcurrency The maximum number of tasks running at the same time. Zero is treated as one.
+             * @returns GAMEKIT_SUCCESS if every task succeeded, otherwise the error returned by the first task that failed.
+            */
+            static unsigned int RunTasks(const std::vector<std::function<unsigned int()>>& tasks, size_t maxConcurrency);
+        };
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+// AWS SDK
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+#include <aws/gamekit/core/model/request_metrics_snapshot.h>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+         * @brief Request counters and latency histograms of every endpoint called by GameKit, shared by all features.
+         *
+         * @details Endpoints are registered by name the first time they are used and live until the process exits.
+         * Looking up a registered endpoint and recording into it never takes a lock.
+         */
+        class GAMEKIT_API RequestMetrics
+        {
+        public:
+            /**
+             * @brief Metrics of a single endpoint. All methods are thread safe.
+             *
+             * @details Latencies are recorded in microseconds into an HDR-style histogram: every power of two is split
+             * into 8 linear sub-buckets, so any recorded value is within 12.5% of its bucket's bounds.
+             */
+            class GAMEKIT_API Endpoint
+            {
+            public:
+                static const unsigned int LATENCY_SUB_BUCKET_BITS = 3;
+                static const unsigned int LATENCY_SUB_BUCKET_COUNT = 1 << LATENCY_SUB_BUCKET_BITS;
+
+                // Latencies of 2^37 microseconds (about 38 hours) and more all go to the last bucket
+                static const unsigned int LATENCY_MAX_EXPONENT = 36;
+                static const unsigned int LATENCY_BUCKET_COUNT = LATENCY_SUB_BUCKET_COUNT * (LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 2);
+
+            private:
+                std::string m_name;
+                std::atomic<unsigned long long> m_requestCount{ 0 };
+                std::atomic<unsigned long long> m_failedRequestCount{ 0 };
+                std::atomic<unsigned long long> m_retryCount{ 0 };
+                std::atomic<unsigned long long> m_droppedCount{ 0 };
+                std::atomic<long long> m_queueDepth{ 0 };
+                std::atomic<unsigned long long> m_bytesSent{ 0 };
+                std::atomic<unsigned long long> m_bytesReceived{ 0 };
+                std::atomic<unsigned long long> m_cacheHitCount{ 0 };
+                std::atomic<unsigned long long> m_cacheMissCount{ 0 };
+                std::atomic<unsigned long long> m_latencySum{ 0 };
+                std::atomic<unsigned long long> m_latencyMax{ 0 };
+                std::atomic<unsigned long long> m_latencyBuckets[LATENCY_BUCKET_COUNT];
+
+            public:
+                explicit Endpoint(std::string name);
+
+                Endpoint(const Endpoint&) = delete;
+                Endpoint& operator=(const Endpoint&) = delete;
+
+                inline const std::string& GetName() const { return m_name; }
+
+                /**
+                 * @brief Record a request that was sent.
+                 *
+                 * @param latency Time from sending the request to receiving the response.
+                 * @param responseCode The response code. Codes outside of 2xx count as failures.
+                 * @param bytesSent Size of the request body.
+                 * @param bytesReceived Size of the response body.
+                */
+                void RecordRequest(std::chrono::microseconds latency, Aws::Http::HttpResponseCode responseCode, unsigned long long bytesSent, unsigned long long bytesReceived);
+
+                void RecordRetry();
+                void RecordDrop();
+                void RecordCacheHit();
+                void RecordCacheMiss();
+
+                /**
+                 * @brief Change the queue depth. Clients sharing the endpoint add the change of their own queue, so the
+                 * depth is the sum of their queues.
+                 *
+                 * @param delta Change of the caller's queue depth since its last call.
+                */
+                void AddQueueDepth(long long delta);
+
+                /**
+                 * @brief Take a snapshot of the metrics.
+                 *
+                 * @details Each counter is read atomically, but a request recorded while the snapshot is taken may be
+                 * reflected in some counters and not others.
+                 *
+                 * @param reset If true, counters and histogram are reset as they are read, so the next snapshot covers
+                 * only what happened since this one. The queue depth is never reset.
+                 * @returns The snapshot. Its endpoint name stays valid until the process exits.
+                */
+                RequestMetricsSnapshot Snapshot(bool reset);
+
+                static unsigned int GetLatencyBucketIndex(unsigned long long microseconds);
+                static unsigned long long GetLatencyBucketUpperBound(unsigned int bucketIndex);
+            };
+
+            /**
+             * @brief Get the metrics of an endpoint, registering it on first use.
+             *
+             * @details Names should identify an API rather than a resource, e.g. "Achievements.GetAchievementForPlayer",
+             * to keep the number of endpoints small. Past 191 named endpoints, new names share the "Other" endpoint.
+             *
+             * @param name Name of the endpoint.
+             * @returns The endpoint, valid until the process exits.
+            */
+            static Endpoint& GetEndpoint(const std::string& name);
+
+            /**
+             * @brief Send a request and record it into the endpoint's metrics.
+             *
+             * @param client The client sending the request.
+             * @param request The request.
+             * @param endpoint The endpoint receiving the metrics.
+             * @returns The response returned by the client.
+            */
+            static std::shared_ptr<Aws::Http::HttpResponse> MakeRequest(Aws::Http::HttpClient& client, const std::shared_ptr<Aws::Http::HttpRequest>& request, Endpoint& endpoint);
+
+            /**
+             * @brief Take a snapshot of every registered endpoint, sorted by name.
+             *
+             * @param returnedSnapshots (Out Parameter) Receives the snapshots.
+             * @param reset If true, metrics are reset as they are read, see Endpoint::Snapshot().
+            */
+            static void Snapshot(std::vector<RequestMetricsSnapshot>& returnedSnapshots, bool reset);
+        };
+    }
+}
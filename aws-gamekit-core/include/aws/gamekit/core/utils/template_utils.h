@@ -0,0 +1,89 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+#include <aws/gamekit/core/logging.h>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+         * @brief A template tokenized into literal text and {{NAME}} placeholders.
+         *
+         * @details Instances are immutable once parsed and can be rendered any number of times, from any thread.
+         */
+        class GAMEKIT_API ParsedTemplate
+        {
+        private:
+            struct Segment
+            {
+                // Position of the segment in the template source. For placeholders this covers the braces.
+                size_t Offset;
+                size_t Length;
+
+                // Placeholder name without braces, empty for literal text.
+                std::string Name;
+            };
+
+            std::string m_source;
+            std::vector<Segment> m_segments;
+
+        public:
+            /**
+             * @brief Tokenize a template.
+             *
+             * @details A placeholder is "{{", followed by a name that doesn't contain braces or line breaks, followed by "}}".
+             *
+             * @param source The template text.
+            */
+            explicit ParsedTemplate(std::string source);
+
+            /**
+             * @brief Render the template in a single pass.
+             *
+             * @details Placeholders whose name is not in values are emitted unchanged, so a template can be rendered in stages
+             * and CloudFormation dynamic references such as {{resolve:...}} are preserved. Values are inserted verbatim.
+             *
+             * @param values Placeholder values keyed by placeholder name, without braces.
+             * @returns The rendered text.
+            */
+            std::string Render(const std::unordered_map<std::string, std::string>& values) const;
+
+            inline const std::string& GetSource() const { return m_source; }
+        };
+
+        class GAMEKIT_API TemplateUtils
+        {
+        public:
+            /**
+             * @brief Load and tokenize a template file.
+             *
+             * @details Parsed templates are cached by path and reused for as long as the file's size and last write time
+             * don't change. Call InvalidateTemplate() after writing a file that may be loaded again within the same second.
+             *
+             * @param filePath Path of the template file.
+             * @param returnedTemplate Receives the parsed template. Set to an empty template when the file cannot be read.
+             * @param logCallback Callback function for logging information and errors.
+             * @returns GAMEKIT_SUCCESS or the error returned by FileUtils::ReadFileIntoString().
+            */
+            static unsigned int LoadTemplate(const std::string& filePath, std::shared_ptr<const ParsedTemplate>& returnedTemplate, FuncLogCallback logCallback = nullptr);
+
+            /**
+             * @brief Remove a template file from the cache used by LoadTemplate().
+             *
+             * @param filePath Path of the template file.
+            */
+            static void InvalidateTemplate(const std::string& filePath);
+        };
+    }
+}
@@ -17,19 +17,23 @@ namespace GameKit
 {
     namespace Utils
     {
+        // Returns the current time. Classes that schedule work take one so tests can control time.
+        typedef std::function<std::chrono::steady_clock::time_point()> SteadyClock;
+
         /**
         * @brief Utility class that calls a function in its own background thread at defined intervals.
         */
         class GAMEKIT_API Ticker
         {
         private:
-            static const int TICKER_PULSE = 250;
+            static constexpr int TICKER_PULSE = 250;
 
             std::mutex m_tickerMutex;
             std::condition_variable m_completedVar;
             std::thread::id m_threadId;
             std::thread m_funcThread;
             int m_interval = 0;
+            std::chrono::milliseconds m_nextTickDelay = std::chrono::milliseconds(0);
             std::function<void()> m_tickFunc;
             FuncLogCallback m_logCb;
             bool m_isRunning;
@@ -55,6 +59,13 @@ namespace GameKit
              */
             virtual void startNewInterval(int intervalSeconds) = 0;
 
+            /**
+             * @brief Start counting down a new interval with millisecond precision.
+             * @details Tickers that don't override this method round the interval up to whole seconds.
+             * @param interval The length of the new interval.
+             */
+            virtual void startNewInterval(std::chrono::milliseconds interval);
+
             /**
              * @brief Count down the current interval.
              * @param sleepTime The amount of time the background thread slept before calling this method.
@@ -68,6 +79,14 @@ namespace GameKit
              */
             virtual bool isIntervalOver() const = 0;
 
+            /**
+             * @brief Get the time left in the current interval.
+             * @details The background thread never sleeps longer than this, so the tick function is called on time.
+             * Tickers that don't override this method are woken up every pulse.
+             * @return The time left, or zero if the interval is over.
+             */
+            virtual std::chrono::milliseconds getIntervalTimeLeft() const;
+
         public:
             /**
             * @brief Create a new instance of this class.
@@ -119,6 +138,14 @@ namespace GameKit
             * @param newInterval The new interval in seconds.
             */
             void RescheduleLoop(int newInterval);
+
+            /**
+            * @brief Schedule only the next tick after a delay, instead of after the loop interval. This should be called inside the tick function.
+            *
+            * @details The following ticks go back to the loop interval. Use this to wake up exactly when a deadline computed by the tick function expires.
+            * @param delay The delay before the next tick, with millisecond precision.
+            */
+            void RescheduleNextTick(std::chrono::milliseconds delay);
         };
 
     }
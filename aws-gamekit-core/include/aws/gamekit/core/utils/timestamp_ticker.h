@@ -25,15 +25,25 @@ namespace GameKit
         {
         private:
             std::chrono::time_point<std::chrono::steady_clock> m_intervalEndTime = std::chrono::time_point<std::chrono::steady_clock>();
+            SteadyClock m_clock;
 
         protected:
             void startNewInterval(int intervalSeconds) override;
+            void startNewInterval(std::chrono::milliseconds interval) override;
             void countDownInterval(std::chrono::milliseconds sleepTime) override;
             bool isIntervalOver() const override;
+            std::chrono::milliseconds getIntervalTimeLeft() const override;
 
         public:
-            TimestampTicker(int interval, std::function<void()> tickFunc, FuncLogCallback logCb)
-                : Ticker(interval, tickFunc, logCb) {}
+            /**
+            * @brief Create a new instance of this class.
+            * @param interval The interval in seconds.
+            * @param tickFunc The function to call at the end of every interval.
+            * @param logCb The log callback function.
+            * @param clock The clock the intervals are measured with.
+            */
+            TimestampTicker(int interval, std::function<void()> tickFunc, FuncLogCallback logCb, SteadyClock clock = std::chrono::steady_clock::now)
+                : Ticker(interval, tickFunc, logCb), m_clock(clock) {}
 
             ~TimestampTicker() override;
         };
@@ -52,6 +52,14 @@ namespace GameKit
 			 * @returns True if the identifier is a valid primary identifier, false otherwise.
 			 */
 			static bool IsValidPrimaryIdentifier(const std::string& identifier);
+
+			/**
+			 * @brief Validates the given null-terminated string as a primary identifier, without copying it.
+			 *
+			 * @param identifier The identifier to validate. Null is not a valid identifier.
+			 * @returns True if the identifier is a valid primary identifier, false otherwise.
+			 */
+			static bool IsValidPrimaryIdentifier(const char* identifier);
 		};
 	}
 }
\ No newline at end of file
@@ -3,6 +3,10 @@
 
 #pragma once
 
+// Standard Library
+#include <string>
+#include <vector>
+
 // GameKit
 #include <aws/gamekit/core/api.h>
 
@@ -10,11 +14,19 @@ namespace GameKit
 {
     // Wrapper for public-domain miniz ZIP writer - see miniz.inc
     // NOTE: filenames and paths use UTF-8 encoding on all platforms
+    //
+    // Deflated file entries are cached on disk by the SHA-256 of their content, so zipping a directory again only compresses the files that changed.
+    // Cached entries are inflated and checked against the file before being copied into the archive; entries that don't match are compressed again.
+    // Files that deflating doesn't make smaller are stored uncompressed.
     class GAMEKIT_API Zipper
     {
     private:
         void* m_zipFile;
         std::string m_sourcePath;
+        size_t m_compressedEntryCount;
+        size_t m_cachedEntryCount;
+
+        bool addFilesToZipFile(const std::vector<std::string>& filePaths);
 
     public:
         Zipper(const std::string& sourcePath, const std::string& zipFileName);
@@ -23,6 +35,15 @@ namespace GameKit
         bool AddDirectoryToZipFile(const std::string& directoryPath);
         bool AddFileToZipFile(const std::string& fileName);
         bool CloseZipFile();
+        // Number of entries this instance compressed, or copied from the entry cache. Files added by miniz directly are not counted.
+        size_t GetCompressedEntryCount() const;
+        size_t GetCachedEntryCount() const;
+
         static void NormalizePathInZip(std::string& inOutPathInZip, const std::string& relativeSoucePath);
+
+        // Sets the directory of the compressed entry cache, shared by all instances. An empty path disables the cache.
+        // Defaults to a "gamekit_zip_entries" directory in the temp directory, per user and only accessible by its owner.
+        static void SetEntryCacheDirectory(const std::string& directoryPath);
+        static std::string GetEntryCacheDirectory();
     };
 }
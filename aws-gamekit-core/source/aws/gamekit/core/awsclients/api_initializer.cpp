@@ -3,6 +3,9 @@
 
 // GameKit
 #include <aws/gamekit/core/awsclients/api_initializer.h>
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
+#include <aws/gamekit/core/gamekit_settings.h>
+#include <aws/gamekit/core/stack_watcher.h>
 
 // Aws
 #include <aws/core/Aws.h>
@@ -99,7 +102,15 @@ void GameKit::AwsApiInitializer::Shutdown(FuncLogCallback log, const void* calle
     if (m_count == 1 || (m_count > 1 && force))
     {
         message = "AwsApiInitializer::Shutdown(): Shutting down (count: " + std::to_string(m_count) + ", force: " + std::to_string(force) + ")";
+
+        // Stop the background threads while the clients they use still work
+        StackWatcher::GetInstance().Shutdown();
+        GameKitSettings::Shutdown();
+
+        // The shared clients must not outlive the HTTP library they were created with
+        SharedHttpClients::Clear();
         Aws::ShutdownAPI(*m_awsSdkOptions);
+        Logging::Shutdown();
 
         m_awsSdkOptions = nullptr;
         m_isAwsSdkInitialized = false;
@@ -0,0 +1,126 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+// AWS SDK
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/crypto/Sha256.h>
+
+// GameKit
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
+
+using namespace GameKit;
+using namespace GameKit::Logger;
+
+namespace
+{
+    std::mutex& getSharedClientsMutex()
+    {
+        static std::mutex sharedClientsMutex;
+        return sharedClientsMutex;
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<Aws::Http::HttpClient>>& getSharedClients()
+    {
+        static std::unordered_map<std::string, std::shared_ptr<Aws::Http::HttpClient>> sharedClients;
+        return sharedClients;
+    }
+
+    // The key is kept as long as its client, so the proxy secrets are only stored as a digest
+    Aws::String hashProxyCredentials(const Aws::Client::ClientConfiguration& clientConfig)
+    {
+        Aws::Utils::Crypto::Sha256 sha256;
+        const Aws::Utils::Base64::Base64 base64;
+        const auto hashResult = sha256.Calculate(clientConfig.proxyUserName + "\n" + clientConfig.proxyPassword + "\n" + clientConfig.proxySSLKeyPassword);
+
+        return base64.Encode(hashResult.GetResult());
+    }
+}
+
+std::shared_ptr<Aws::Http::HttpClient> SharedHttpClients::Get(const Aws::Client::ClientConfiguration& clientConfig, FuncLogCallback logCb)
+{
+    const std::string key = GetConfigurationKey(clientConfig);
+
+    // Clients are created under the lock so concurrent constructors of different features end up with the same client
+    std::lock_guard<std::mutex> lock(getSharedClientsMutex());
+    std::unordered_map<std::string, std::shared_ptr<Aws::Http::HttpClient>>& sharedClients = getSharedClients();
+    const auto sharedClient = sharedClients.find(key);
+    if (sharedClient != sharedClients.end())
+    {
+        return sharedClient->second;
+    }
+
+    std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    if (httpClient == nullptr)
+    {
+        Logging::Log(logCb, Level::Error, "SharedHttpClients::Get(): The HttpClientFactory did not create a client.");
+        return nullptr;
+    }
+
+    sharedClients.emplace(key, httpClient);
+    Logging::Log(logCb, Level::Info, ("SharedHttpClients::Get(): Created shared HTTP client " + std::to_string(sharedClients.size()) +
+        " (connectTimeoutMs: " + std::to_string(clientConfig.connectTimeoutMs) + ", requestTimeoutMs: " + std::to_string(clientConfig.requestTimeoutMs) + ")").c_str());
+
+    return httpClient;
+}
+
+void SharedHttpClients::Clear()
+{
+    // Destroy the clients outside the lock, their connections are closed on destruction
+    std::unordered_map<std::string, std::shared_ptr<Aws::Http::HttpClient>> releasedClients;
+    {
+        std::lock_guard<std::mutex> lock(getSharedClientsMutex());
+        releasedClients.swap(getSharedClients());
+    }
+}
+
+size_t SharedHttpClients::GetClientCount()
+{
+    std::lock_guard<std::mutex> lock(getSharedClientsMutex());
+    return getSharedClients().size();
+}
+
+std::string SharedHttpClients::GetConfigurationKey(const Aws::Client::ClientConfiguration& clientConfig)
+{
+    std::ostringstream key;
+    key << static_cast<int>(clientConfig.scheme) << '\n'
+        << static_cast<int>(clientConfig.httpLibOverride) << '\n'
+        << static_cast<int>(clientConfig.version) << '\n'
+        << clientConfig.maxConnections << '\n'
+        << clientConfig.connectTimeoutMs << '\n'
+        << clientConfig.httpRequestTimeoutMs << '\n'
+        << clientConfig.requestTimeoutMs << '\n'
+        << clientConfig.lowSpeedLimit << '\n'
+        << clientConfig.enableTcpKeepAlive << '\n'
+        << clientConfig.tcpKeepAliveIntervalMs << '\n'
+        << clientConfig.verifySSL << '\n'
+        << clientConfig.caPath << '\n'
+        << clientConfig.caFile << '\n'
+        << static_cast<int>(clientConfig.followRedirects) << '\n'
+        << clientConfig.disableExpectHeader << '\n'
+        << static_cast<int>(clientConfig.proxyScheme) << '\n'
+        << clientConfig.proxyHost << '\n'
+        << clientConfig.proxyPort << '\n'
+        << hashProxyCredentials(clientConfig) << '\n'
+        << clientConfig.proxySSLCertPath << '\n'
+        << clientConfig.proxySSLCertType << '\n'
+        << clientConfig.proxySSLKeyPath << '\n'
+        << clientConfig.proxySSLKeyType << '\n'
+        << clientConfig.proxyCaPath << '\n'
+        << clientConfig.proxyCaFile << '\n';
+
+    for (size_t i = 0; i < clientConfig.nonProxyHosts.GetLength(); ++i)
+    {
+        key << clientConfig.nonProxyHosts[i] << ',';
+    }
+
+    // Rate limiters keep state per client, share only between configurations that use the same limiter
+    key << '\n' << clientConfig.writeRateLimiter.get() << '\n' << clientConfig.readRateLimiter.get();
+
+    return key.str();
+}
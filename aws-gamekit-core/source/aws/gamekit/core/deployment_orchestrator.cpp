@@ -6,6 +6,9 @@
 #include <aws/gamekit/core/errors.h>
 #include <aws/gamekit/core/gamekit_settings.h>
 
+// Standard Library
+#include <future>
+
 using namespace GameKit;
 
 #pragma region Macros
@@ -279,22 +282,35 @@ unsigned int GameKitDeploymentOrchestrator::deployFeature(FeatureType feature)
     // Remove the final '/' character
     instanceCloudFormationPath.pop_back();
 
-    result = featureResources->UploadDashboard(instanceCloudFormationPath);
-    SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to upload CloudFormation dashboard");
+    // The dashboard doesn't depend on the Lambda Layers and Functions, upload it while they are being uploaded
+    std::future<unsigned int> dashboardUpload = std::async(std::launch::async, [featureResources, instanceCloudFormationPath]()
+    {
+        return featureResources->UploadDashboard(instanceCloudFormationPath);
+    });
 
     setFeatureStatus(feature, FeatureStatus::UploadingLayers);
-    result = featureResources->DeployFeatureLayers();
-    SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to upload Lambda Layers");
+    const unsigned int layersResult = featureResources->DeployFeatureLayers();
+
+    unsigned int functionsResult = GAMEKIT_SUCCESS;
+    if (layersResult == GAMEKIT_SUCCESS)
+    {
+        setFeatureStatus(feature, FeatureStatus::UploadingFunctions);
+        functionsResult = featureResources->DeployFeatureFunctions();
+    }
 
-    setFeatureStatus(feature, FeatureStatus::UploadingFunctions);
-    result = featureResources->DeployFeatureFunctions();
-    SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to upload Lambda Functions");
+    result = dashboardUpload.get();
+    SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to upload CloudFormation dashboard");
+    SET_STATUS_AND_RETURN_IF_ERROR(layersResult, feature, "Failed to upload Lambda Layers");
+    SET_STATUS_AND_RETURN_IF_ERROR(functionsResult, feature, "Failed to upload Lambda Functions");
 
     setFeatureStatus(feature, FeatureStatus::DeployingResources);
     result = featureResources->CreateOrUpdateFeatureStack();
     SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to deploy CloudFormation stack");
 
-    result = getAccount()->DeployApiGatewayStage();
+    {
+        std::lock_guard<std::mutex> apiGatewayStageGuard(m_apiGatewayStageMutex);
+        result = getAccount()->DeployApiGatewayStage();
+    }
     SET_STATUS_AND_RETURN_IF_ERROR(result, feature, "Failed to deploy API Gateway stage");
 
     setFeatureStatus(feature, FeatureStatus::Deployed);
@@ -322,30 +338,36 @@ unsigned int GameKitDeploymentOrchestrator::validateAndDeployFeature(FeatureType
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int GameKitDeploymentOrchestrator::createOrRedeployFeatureAndMainStack(FeatureType feature, std::function<bool(FeatureType)> isFeatureStateValid)
+unsigned int GameKitDeploymentOrchestrator::createOrRedeployMainStack()
 {
-    // We need to sync our statuses and (re)deploy the main stack before we can create the target feature.
-    // Signal that we are working on deploying the main stack and the target feature.
-    setDeploymentInProgress(FeatureType::Main, true);
-    setDeploymentInProgress(feature, true);
-
-    // Ensure all of our stack statuses are up to date to account for remote modifications
-    RefreshFeatureStatuses();
-
     // Create or redeploy the main stack
     if (!isCreateStateValid(FeatureType::Main) && !isRedeployStateValid(FeatureType::Main))
     {
         const std::string errorMessage = "Cannot deploy the main stack, as it is in an invalid state for deployment";
         Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str());
         setDeploymentInProgress(FeatureType::Main, false);
-        setDeploymentInProgress(feature, false);
 
         return GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_STATE;
     }
 
-    unsigned int result = validateAndDeployFeature(FeatureType::Main);
+    const unsigned int result = validateAndDeployFeature(FeatureType::Main);
     setDeploymentInProgress(FeatureType::Main, false);
-    
+
+    return result;
+}
+
+unsigned int GameKitDeploymentOrchestrator::createOrRedeployFeatureAndMainStack(FeatureType feature, std::function<bool(FeatureType)> isFeatureStateValid)
+{
+    // We need to sync our statuses and (re)deploy the main stack before we can create the target feature.
+    // Signal that we are working on deploying the main stack and the target feature.
+    setDeploymentInProgress(FeatureType::Main, true);
+    setDeploymentInProgress(feature, true);
+
+    // Ensure all of our stack statuses are up to date to account for remote modifications
+    invalidateFeatureStatusesRefresh();
+    RefreshFeatureStatuses();
+
+    unsigned int result = createOrRedeployMainStack();
     if (result != GAMEKIT_SUCCESS)
     {
         setDeploymentInProgress(feature, false);
@@ -392,6 +414,23 @@ unsigned int GameKitDeploymentOrchestrator::validateFeatureSettings(FeatureType
     return GAMEKIT_SUCCESS;
 }
 
+void GameKitDeploymentOrchestrator::updateFeatureStatusFromStackStatus(FeatureType feature, const std::string& cloudFormationStatus)
+{
+    const FeatureStatus featureStatusFromCloudFormationStatus = GetFeatureStatusFromCloudFormationStackStatus(cloudFormationStatus);
+
+    // For an in-progress feature deployment, the local running status (more descriptive) takes precedence over cloudformation running status
+    if (!(IsFeatureDeploymentInProgress(feature) && IsFeatureUpdating(feature)))
+    {
+        setFeatureStatus(feature, featureStatusFromCloudFormationStatus);
+    }
+}
+
+void GameKitDeploymentOrchestrator::invalidateFeatureStatusesRefresh()
+{
+    std::lock_guard<std::mutex> refreshGuard(m_featureStatusesRefreshMutex);
+    m_featureStatusesRefreshed = false;
+}
+
 unsigned int GameKitDeploymentOrchestrator::invokeDeploymentResponseCallback(DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback, unsigned int callStatus) const
 {
     if (receiver != nullptr && callback != nullptr)
@@ -545,6 +584,8 @@ unsigned int GameKitDeploymentOrchestrator::SetCredentials(const AccountInfo& ac
     m_featureStatusMap.clear();
     featureStatusGuard.unlock();
 
+    invalidateFeatureStatusesRefresh();
+
     return GAMEKIT_SUCCESS;
 }
 
@@ -602,25 +643,50 @@ bool GameKitDeploymentOrchestrator::IsAnyFeatureUpdating() const
 unsigned int GameKitDeploymentOrchestrator::RefreshFeatureStatus(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback)
 {
     const std::shared_ptr<GameKitFeatureResources> featureResources = getFeatureResources(feature);
-    const std::string cloudFormationStatus = featureResources->GetCurrentStackStatus();
-    const FeatureStatus featureStatusFromCloudFormationStatus = GetFeatureStatusFromCloudFormationStackStatus(cloudFormationStatus);
-
-    // For an in-progress feature deployment, the local running status (more descriptive) takes precedence over cloudformation running status
-    if (!(IsFeatureDeploymentInProgress(feature) && IsFeatureUpdating(feature)))
-    {
-        setFeatureStatus(feature, featureStatusFromCloudFormationStatus);
-    }
+    updateFeatureStatusFromStackStatus(feature, featureResources->GetCurrentStackStatus());
 
     return invokeDeploymentResponseCallback(receiver, callback, GAMEKIT_SUCCESS);
 }
 
 unsigned int GameKitDeploymentOrchestrator::RefreshFeatureStatuses(DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback)
 {
+    std::unique_lock<std::mutex> refreshGuard(m_featureStatusesRefreshMutex);
+    if (m_featureStatusesRefreshed && std::chrono::steady_clock::now() - m_featureStatusesRefreshTime < FEATURE_STATUSES_REFRESH_TTL)
+    {
+        refreshGuard.unlock();
+        return invokeDeploymentResponseCallback(receiver, callback, GAMEKIT_SUCCESS);
+    }
+
+    std::unordered_map<FeatureType, std::shared_ptr<GameKitFeatureResources>> featureResources;
+    std::unordered_set<std::string> stackNames;
     for (const FeatureType feature : m_availableFeatures)
     {
-        RefreshFeatureStatus(feature, nullptr, nullptr);
+        featureResources[feature] = getFeatureResources(feature);
+        stackNames.insert(featureResources[feature]->GetStackName());
+    }
+
+    // Any feature's resources can describe the stacks of the others, they share the account and region
+    std::unordered_map<std::string, Aws::CloudFormation::Model::Stack> describedStacks;
+    const unsigned int describeResult = featureResources[FeatureType::Main]->DescribeFeatureStacks(stackNames, describedStacks);
+
+    for (const FeatureType feature : m_availableFeatures)
+    {
+        const std::shared_ptr<GameKitFeatureResources>& resources = featureResources[feature];
+        if (describeResult != GAMEKIT_SUCCESS)
+        {
+            // e.g. the credentials are only allowed to describe GameKit stacks by name
+            updateFeatureStatusFromStackStatus(feature, resources->GetCurrentStackStatus());
+            continue;
+        }
+
+        const auto describedStack = describedStacks.find(resources->GetStackName());
+        updateFeatureStatusFromStackStatus(feature, resources->GetStackStatusFromDescription(describedStack == describedStacks.end() ? nullptr : &describedStack->second));
     }
 
+    m_featureStatusesRefreshTime = std::chrono::steady_clock::now();
+    m_featureStatusesRefreshed = true;
+    refreshGuard.unlock();
+
     return invokeDeploymentResponseCallback(receiver, callback, GAMEKIT_SUCCESS);
 }
 
@@ -700,6 +766,85 @@ unsigned int GameKitDeploymentOrchestrator::RedeployFeature(FeatureType feature,
     return invokeDeploymentResponseCallback(receiver, callback, result);
 }
 
+unsigned int GameKitDeploymentOrchestrator::DeployFeatures(const std::unordered_set<FeatureType>& features, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback)
+{
+    // The main stack is always (re)deployed first, it is not scheduled with the other features
+    std::unordered_set<FeatureType> targetFeatures(features);
+    targetFeatures.erase(FeatureType::Main);
+
+    if (!areCredentialsValid())
+    {
+        Logger::Logging::Log(m_logCb, Logger::Level::Warning, "Cannot deploy features, the credentials are invalid");
+        return invokeDeploymentResponseCallback(receiver, callback, GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_STATE);
+    }
+
+    for (const FeatureType feature : targetFeatures)
+    {
+        if (isFeatureOrUpstreamDeploymentInProgress(feature))
+        {
+            const std::string errorMessage = "Cannot deploy feature " + GetFeatureTypeString(feature) + ", as it or one of its dependencies are being deployed";
+            Logger::Logging::Log(m_logCb, Logger::Level::Warning, errorMessage.c_str());
+
+            return invokeDeploymentResponseCallback(receiver, callback, GAMEKIT_ERROR_ORCHESTRATION_DEPLOYMENT_IN_PROGRESS);
+        }
+    }
+
+    setDeploymentInProgress(FeatureType::Main, true);
+    for (const FeatureType feature : targetFeatures)
+    {
+        setDeploymentInProgress(feature, true);
+    }
+
+    // Ensure all of our stack statuses are up to date to account for remote modifications
+    invalidateFeatureStatusesRefresh();
+    RefreshFeatureStatuses();
+
+    unsigned int result = createOrRedeployMainStack();
+    if (result != GAMEKIT_SUCCESS)
+    {
+        for (const FeatureType feature : targetFeatures)
+        {
+            setDeploymentInProgress(feature, false);
+        }
+
+        return invokeDeploymentResponseCallback(receiver, callback, result);
+    }
+
+    // Deploy every feature as soon as its upstream features are deployed. A feature's state is validated when it is its turn,
+    // so that a feature can be created in the same call as the upstream features it depends on.
+    std::unordered_map<FeatureType, unsigned int> featureResults;
+    result = FeatureDeploymentScheduler::DeployInDependencyOrder(targetFeatures, m_featureDependencies, [this](FeatureType feature)
+    {
+        unsigned int featureResult = GAMEKIT_ERROR_ORCHESTRATION_INVALID_FEATURE_STATE;
+        if (isCreateStateValid(feature) || isRedeployStateValid(feature))
+        {
+            featureResult = validateAndDeployFeature(feature);
+        }
+        else
+        {
+            const std::string errorMessage = "Cannot deploy the feature " + GetFeatureTypeString(feature) + ", as it or one of its upstream dependencies are in an invalid state for deployment";
+            Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str());
+        }
+
+        setDeploymentInProgress(feature, false);
+        return featureResult;
+    }, featureResults);
+
+    for (const std::pair<const FeatureType, unsigned int>& featureResult : featureResults)
+    {
+        if (featureResult.second == GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED)
+        {
+            // Skipped because an upstream feature failed to deploy
+            setDeploymentInProgress(featureResult.first, false);
+
+            const std::string errorMessage = "Skipped deployment of feature " + GetFeatureTypeString(featureResult.first) + ", as one of its upstream dependencies failed to deploy";
+            Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str());
+        }
+    }
+
+    return invokeDeploymentResponseCallback(receiver, callback, result);
+}
+
 unsigned int GameKitDeploymentOrchestrator::DeleteFeature(FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback callback)
 {
     if (!CanDeleteFeature(feature))
@@ -712,6 +857,7 @@ unsigned int GameKitDeploymentOrchestrator::DeleteFeature(FeatureType feature, D
 
     setDeploymentInProgress(feature, true);
 
+    invalidateFeatureStatusesRefresh();
     RefreshFeatureStatuses();
 
     if (!isDeleteStateValid(feature))
@@ -12,6 +12,7 @@
 #include <aws/gamekit/core/awsclients/default_clients.h>
 #include <aws/gamekit/core/model/account_credentials.h>
 #include <aws/gamekit/core/model/account_info.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 #include <aws/gamekit/core/utils/sts_utils.h>
 
 #include <fstream>
@@ -33,6 +34,48 @@ unsigned int GameKitShutdownAwsSdk(FuncLogCallback logCb)
 }
 #pragma endregion
 
+#pragma region Logging
+void GameKitSetMinimumLogLevel(unsigned int level)
+{
+    Logging::SetMinimumLevel(level);
+}
+
+void GameKitSetLogDeliveryMode(unsigned int mode)
+{
+    if (mode > (unsigned int)DeliveryMode::Manual)
+    {
+        return;
+    }
+
+    Logging::SetDeliveryMode((DeliveryMode)mode);
+}
+
+unsigned int GameKitFlushLogs()
+{
+    return Logging::FlushLogs();
+}
+
+unsigned long long GameKitGetDroppedLogCount()
+{
+    return Logging::GetDroppedCount();
+}
+#pragma endregion
+
+#pragma region Request Metrics
+unsigned int GameKitGetRequestMetrics(DISPATCH_RECEIVER_HANDLE dispatchReceiver, RequestMetricsCallback resultCallback, bool reset)
+{
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    GameKit::Utils::RequestMetrics::Snapshot(snapshots, reset);
+
+    if (resultCallback != nullptr)
+    {
+        resultCallback(dispatchReceiver, snapshots.data(), (unsigned int)snapshots.size());
+    }
+
+    return GameKit::GAMEKIT_SUCCESS;
+}
+#pragma endregion
+
 #pragma region GameKitAccount Methods
 unsigned int GameKitGetAwsAccountId(DISPATCH_RECEIVER_HANDLE caller, CharPtrCallback resultCallback, const char* accessKey, const char* secretKey, FuncLogCallback logCb)
 {
@@ -310,64 +353,14 @@ unsigned int GameKitResourcesSaveFunctionInstances(GAMEKIT_FEATURERESOURCES_INST
 
 GAMEKIT_API unsigned int GameKitResourcesUploadFeatureLayers(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
-    GameKit::GameKitFeatureResources* resources = ((GameKit::GameKitFeatureResources*)resourceInstance);
-
-    // create/set replacement id
-    unsigned int result = resources->CreateAndSetLayersReplacementId();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // compress feature functions
-    result = resources->CompressFeatureLayers();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // upload feature functions
-    result = resources->UploadFeatureLayers();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // cleanup
-    resources->CleanupTempFiles();
-
-    return result;
+    // compress and upload every layer, cleaning up temp files afterwards
+    return ((GameKit::GameKitFeatureResources*)resourceInstance)->DeployFeatureLayers();
 }
 
 unsigned int GameKitResourcesUploadFeatureFunctions(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
-    GameKit::GameKitFeatureResources* resources = ((GameKit::GameKitFeatureResources*)resourceInstance);
-
-    // create/set replacement id
-    unsigned int result = resources->CreateAndSetFunctionsReplacementId();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // compress feature functions
-    result = resources->CompressFeatureFunctions();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // upload feature functions
-    result = resources->UploadFeatureFunctions();
-    if (result != GameKit::GAMEKIT_SUCCESS)
-    {
-        return result;
-    }
-
-    // cleanup
-    resources->CleanupTempFiles();
-
-    return result;
+    // compress and upload every function, cleaning up temp files afterwards
+    return ((GameKit::GameKitFeatureResources*)resourceInstance)->DeployFeatureFunctions();
 }
 
 unsigned int GameKitResourcesDescribeStackResources(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance, FuncResourceInfoCallback resourceInfoCb)
@@ -617,6 +610,12 @@ unsigned int GameKitDeploymentOrchestratorRedeployFeature(GAMEKIT_DEPLOYMENT_ORC
     return ((GameKit::GameKitDeploymentOrchestrator*)deploymentOrchestratorInstance)->RedeployFeature(feature, receiver, resultCb);
 }
 
+unsigned int GameKitDeploymentOrchestratorDeployFeatures(GAMEKIT_DEPLOYMENT_ORCHESTRATOR_INSTANCE_HANDLE deploymentOrchestratorInstance, const GameKit::FeatureType* features, unsigned int featureCount, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback resultCb)
+{
+    const std::unordered_set<GameKit::FeatureType> featureSet(features, features + featureCount);
+    return ((GameKit::GameKitDeploymentOrchestrator*)deploymentOrchestratorInstance)->DeployFeatures(featureSet, receiver, resultCb);
+}
+
 unsigned int GameKitDeploymentOrchestratorDeleteFeature(GAMEKIT_DEPLOYMENT_ORCHESTRATOR_INSTANCE_HANDLE deploymentOrchestratorInstance, GameKit::FeatureType feature, DISPATCH_RECEIVER_HANDLE receiver, DeploymentResponseCallback resultCb)
 {
     return ((GameKit::GameKitDeploymentOrchestrator*)deploymentOrchestratorInstance)->DeleteFeature(feature, receiver, resultCb);
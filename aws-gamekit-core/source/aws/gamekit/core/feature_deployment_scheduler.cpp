@@ -0,0 +1,126 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/feature_deployment_scheduler.h>
+
+using namespace GameKit;
+
+unsigned int FeatureDeploymentScheduler::DeployInDependencyOrder(
+    const std::unordered_set<FeatureType>& features,
+    const FeatureDependencies& dependencies,
+    const std::function<unsigned int(FeatureType)>& deployFeature,
+    std::unordered_map<FeatureType, unsigned int>& returnedResults)
+{
+    std::mutex resultsMutex;
+    std::condition_variable featureDeployed;
+    std::vector<std::thread> deployments;
+    std::unordered_set<FeatureType> pendingFeatures(features);
+    size_t runningDeployments = 0;
+    unsigned int result = GAMEKIT_SUCCESS;
+
+    returnedResults.clear();
+
+    std::unique_lock<std::mutex> lock(resultsMutex);
+    while (!pendingFeatures.empty() || runningDeployments > 0)
+    {
+        // Start or skip every pending feature whose upstream features are done. Skipping a feature can unblock others, so repeat until nothing changes.
+        bool featuresChanged = true;
+        while (featuresChanged)
+        {
+            featuresChanged = false;
+            for (auto pendingFeature = pendingFeatures.begin(); pendingFeature != pendingFeatures.end();)
+            {
+                const FeatureType feature = *pendingFeature;
+                bool upstreamFeaturesDone = true;
+                bool upstreamFeatureFailed = false;
+
+                const auto upstreamFeatures = dependencies.find(feature);
+                if (upstreamFeatures != dependencies.end())
+                {
+                    for (const FeatureType upstreamFeature : upstreamFeatures->second)
+                    {
+                        if (features.find(upstreamFeature) == features.end())
+                        {
+                            continue;
+                        }
+
+                        const auto upstreamResult = returnedResults.find(upstreamFeature);
+                        if (upstreamResult == returnedResults.end())
+                        {
+                            upstreamFeaturesDone = false;
+                            break;
+                        }
+
+                        upstreamFeatureFailed |= upstreamResult->second != GAMEKIT_SUCCESS;
+                    }
+                }
+
+                if (!upstreamFeaturesDone)
+                {
+                    ++pendingFeature;
+                    continue;
+                }
+
+                pendingFeature = pendingFeatures.erase(pendingFeature);
+                featuresChanged = true;
+
+                if (upstreamFeatureFailed)
+                {
+                    returnedResults[feature] = GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED;
+                    continue;
+                }
+
+                ++runningDeployments;
+                deployments.emplace_back([&, feature]()
+                {
+                    const unsigned int deployResult = deployFeature(feature);
+
+                    std::lock_guard<std::mutex> resultsGuard(resultsMutex);
+                    returnedResults[feature] = deployResult;
+                    if (result == GAMEKIT_SUCCESS)
+                    {
+                        result = deployResult;
+                    }
+
+                    --runningDeployments;
+                    featureDeployed.notify_all();
+                });
+            }
+        }
+
+        if (runningDeployments == 0)
+        {
+            // Nothing is running and nothing can start: the remaining features depend on each other
+            for (const FeatureType feature : pendingFeatures)
+            {
+                returnedResults[feature] = GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED;
+            }
+
+            if (!pendingFeatures.empty() && result == GAMEKIT_SUCCESS)
+            {
+                result = GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED;
+            }
+
+            pendingFeatures.clear();
+            break;
+        }
+
+        featureDeployed.wait(lock);
+    }
+    lock.unlock();
+
+    for (std::thread& deployment : deployments)
+    {
+        deployment.join();
+    }
+
+    return result;
+}
@@ -6,9 +6,16 @@
 #include <aws/gamekit/core/gamekit_settings.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
+#include <aws/gamekit/core/stack_watcher.h>
 #include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
 #include <aws/gamekit/core/gamekit_account.h>
 
+// Standard Library
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 // Boost
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -23,6 +30,54 @@ namespace S3Model = Aws::S3::Model;
 namespace SSMModel = Aws::SSM::Model;
 namespace fs = boost::filesystem;
 
+namespace
+{
+    // Maximum number of Lambda layers or functions of a feature that are zipped and uploaded at the same time
+    static const size_t MAX_CONCURRENT_ARTIFACT_TASKS = 4;
+
+    // DescribeFeatureStacks() sweeps at most this many pages of the account's stacks, the stacks not found by then are described by name
+    static const int MAX_DESCRIBE_STACKS_PAGES = 2;
+
+    // Parameter Store accepts at most this many names in a GetParameters request
+    static const size_t MAX_PARAMETERS_PER_REQUEST = 10;
+
+    // Serializes read-modify-write of awsGameKitClientConfig.yml, which is shared by all features that may be deployed concurrently
+    std::recursive_mutex& getClientConfigMutex()
+    {
+        static std::recursive_mutex clientConfigMutex;
+        return clientConfigMutex;
+    }
+
+    // Replaces every "Description: (GAMEKIT<tag>) ..." line with "Description: (GAMEKIT-<tag>-<sourceEngine>) <description>".
+    void replaceTemplateDescription(std::string& cfTemplate, const std::string& sourceEngine, const std::string& description)
+    {
+        static const std::string DESCRIPTION_PREFIX = "Description: (GAMEKIT";
+
+        size_t pos = 0;
+        while ((pos = cfTemplate.find(DESCRIPTION_PREFIX, pos)) != std::string::npos)
+        {
+            const size_t tagStart = pos + DESCRIPTION_PREFIX.size();
+            size_t lineEnd = cfTemplate.find_first_of("\r\n", tagStart);
+            if (lineEnd == std::string::npos)
+            {
+                lineEnd = cfTemplate.size();
+            }
+
+            // the tag ends at the last closing parenthesis of the line
+            const size_t tagEnd = cfTemplate.rfind(')', lineEnd - 1);
+            if (tagEnd == std::string::npos || tagEnd < tagStart)
+            {
+                pos = lineEnd;
+                continue;
+            }
+
+            const std::string replacement = "Description: (GAMEKIT-" + cfTemplate.substr(tagStart, tagEnd - tagStart) + "-" + sourceEngine + ") " + description;
+            cfTemplate.replace(pos, lineEnd - pos, replacement);
+            pos += replacement.size();
+        }
+    }
+}
+
 #pragma region Constructors/Destructor
 GameKitFeatureResources::GameKitFeatureResources(const AccountInfo accountInfo, const AccountCredentials credentials, FeatureType featureType, FuncLogCallback logCb) :
     GameKitFeatureResources(CreateAccountInfoCopy(accountInfo), CreateAccountCredentialsCopy(credentials), featureType, logCb)
@@ -36,7 +91,6 @@ GameKitFeatureResources::GameKitFeatureResources(const AccountInfoCopy& accountI
     m_featureType = featureType;
     m_logCb = logCb;
 
-    m_resouceStatusMap = {};
     m_stackName = GetStackName();
 
     GameKit::AwsApiInitializer::Initialize(m_logCb, this);
@@ -219,38 +273,16 @@ unsigned int GameKitFeatureResources::SaveCloudFormationInstance(std::string sou
         return GameKit::GAMEKIT_ERROR_REGION_CODE_CONVERSION_FAILED;
     }
 
-    auto cfTemplate = this->getCloudFormationTemplate(TemplateType::Base);
-    auto cfDashboard = this->getFeatureDashboardTemplate(TemplateType::Base);
-    auto cfParams = this->getRawStackParameters(TemplateType::Base);
-
-    // regex swap description to describe the engine and version
-    std::regex targetLine("Description: \\(GAMEKIT(.*)\\).*");
-
-    std::string replacementDescription = "Description: (GAMEKIT-$1-" + sourceEngine + ") The AWS CloudFormation template for AWS GameKit" + GetFeatureTypeString(m_featureType) + ". v" + pluginVersion;
-    cfTemplate = std::regex_replace(cfTemplate, targetLine, replacementDescription);
-    cfDashboard = std::regex_replace(cfDashboard, targetLine, replacementDescription);
+    // render all GAMEKIT System Variables AWSGAMEKIT::SYS::* in a single pass over each template
+    const std::unordered_map<std::string, std::string> systemVariables = getSystemVariables(shortRegionCode);
+    auto cfTemplate = loadTemplate(TemplateType::Base, TemplateFileNames::CLOUDFORMATION_FILE)->Render(systemVariables);
+    auto cfDashboard = loadTemplate(TemplateType::Base, TemplateFileNames::FEATURE_DASHBOARD_FILE)->Render(systemVariables);
+    auto cfParams = loadTemplate(TemplateType::Base, TemplateFileNames::PARAMETERS_FILE)->Render(systemVariables);
 
-    // replace occurrances of GAMEKIT System Variables AWSGAMEKIT::SYS::*
-    std::regex envVar(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_ENVIRONMENT + TemplateVars::END);
-    cfTemplate = std::regex_replace(cfTemplate, envVar, m_accountInfo.environment.GetEnvironmentString());
-    cfDashboard = std::regex_replace(cfDashboard, envVar, m_accountInfo.environment.GetEnvironmentString());
-    cfParams = std::regex_replace(cfParams, envVar, m_accountInfo.environment.GetEnvironmentString());
-
-    std::regex gameName(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_GAMENAME + TemplateVars::END);
-    cfTemplate = std::regex_replace(cfTemplate, gameName, m_accountInfo.gameName);
-    cfDashboard = std::regex_replace(cfDashboard, gameName, m_accountInfo.gameName);
-    cfParams = std::regex_replace(cfParams, gameName, m_accountInfo.gameName);
-
-    const std::string base36AwsAccountIdStr = GameKit::Utils::EncodingUtils::DecimalToBase(m_accountInfo.accountId, GameKit::Utils::BASE_36);
-    std::regex base36AwsAccountId(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_BASE36_AWS_ACCOUNTID + TemplateVars::END);
-    cfTemplate = std::regex_replace(cfTemplate, base36AwsAccountId, base36AwsAccountIdStr);
-    cfDashboard = std::regex_replace(cfDashboard, base36AwsAccountId, base36AwsAccountIdStr);
-    cfParams = std::regex_replace(cfParams, base36AwsAccountId, base36AwsAccountIdStr);
-
-    const std::regex shortRegionCodeRegex(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_SHORT_REGION_CODE + TemplateVars::END);
-    cfTemplate = std::regex_replace(cfTemplate, shortRegionCodeRegex, shortRegionCode);
-    cfDashboard = std::regex_replace(cfDashboard, shortRegionCodeRegex, shortRegionCode);
-    cfParams = std::regex_replace(cfParams, shortRegionCodeRegex, shortRegionCode);
+    // swap description to describe the engine and version
+    const std::string description = "The AWS CloudFormation template for AWS GameKit" + GetFeatureTypeString(m_featureType) + ". v" + pluginVersion;
+    replaceTemplateDescription(cfTemplate, sourceEngine, description);
+    replaceTemplateDescription(cfDashboard, sourceEngine, description);
 
     //  save to GAMEKIT_ROOT
     auto writeResult = writeCloudFormationParameterInstance(cfParams);
@@ -283,20 +315,8 @@ unsigned int GameKitFeatureResources::UpdateCloudFormationParameters()
         return GameKit::GAMEKIT_ERROR_REGION_CODE_CONVERSION_FAILED;
     }
 
-    auto cfParams = this->getRawStackParameters(TemplateType::Base);
-
     // replace occurrances of GAMEKIT System Variables AWSGAMEKIT::SYS::*
-    const std::regex envVar(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_ENVIRONMENT + TemplateVars::END);
-    cfParams = std::regex_replace(cfParams, envVar, m_accountInfo.environment.GetEnvironmentString());
-
-    const std::regex gameName(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_GAMENAME + TemplateVars::END);
-    cfParams = std::regex_replace(cfParams, gameName, m_accountInfo.gameName);
-
-    const std::regex base36AwsAccountId(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_BASE36_AWS_ACCOUNTID + TemplateVars::END);
-    cfParams = std::regex_replace(cfParams, base36AwsAccountId, GameKit::Utils::EncodingUtils::DecimalToBase(m_accountInfo.accountId, GameKit::Utils::BASE_36));
-
-    const std::regex shortRegionCodeRegex(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_SHORT_REGION_CODE + TemplateVars::END);
-    cfParams = std::regex_replace(cfParams, shortRegionCodeRegex, shortRegionCode);
+    const std::string cfParams = loadTemplate(TemplateType::Base, TemplateFileNames::PARAMETERS_FILE)->Render(getSystemVariables(shortRegionCode));
 
     // Do not replace AWSGAMEKIT::VARS::* values; these will be replaced at time of deployment
 
@@ -475,159 +495,85 @@ unsigned int GameKitFeatureResources::UploadDashboard(const std::string& path)
 
 unsigned int GameKitFeatureResources::CompressFeatureLayers()
 {
-    // loop through the feature's layers directory
-    std::string layerName;
-    Aws::UniquePtr<Zipper> zipper;
-    fs::path p(m_instanceLayersPath);
-    fs::directory_iterator endIterator;
-
-    // Verify that path exists and is a directory
-    if (fs::exists(p) && fs::is_directory(p))
+    // zip every layer directory whose hash changed since it was last deployed
+    const std::vector<std::string> layerDirectories = getArtifactPaths(m_instanceLayersPath, true);
+    if (layerDirectories.empty())
     {
-        for (fs::directory_iterator dirIterator(p); dirIterator != endIterator; ++dirIterator)
-        {
-            // create zip file for every layers directory
-            const fs::path cp = (*dirIterator);
-
-            // Verify that path is a directory
-            if (fs::is_directory(cp))
-            {
-                layerName = cp.stem().string();
-
-                std::string layerHash;
-                const unsigned int result = GameKit::Utils::FileUtils::CalculateDirectoryHash(cp.string(), layerHash);
-
-                if (result == GAMEKIT_SUCCESS && !lambdaLayerHashChanged(layerName, layerHash))
-                {
-                    // update hash param
-                    if (createAndSetLambdaLayerHash(layerName, layerHash) != GAMEKIT_SUCCESS)
-                    {
-                        std::string msg = std::string("Unable to save layer hash for ").append(layerName);
-                        Logging::Log(m_logCb, Level::Error, msg.c_str());
-                    }
-
-
-                    // create output directory in temp path
-                    std::string tempLayersPath = getTempLayersPath();
-                    fs::create_directories(tempLayersPath);
+        return GAMEKIT_SUCCESS;
+    }
 
-                    // create zip file
-                    std::string zipFileName = tempLayersPath + "/" + layerName + ".zip";
-                    zipper = Aws::MakeUnique<Zipper>(zipFileName.c_str(), cp.string(), zipFileName);
-                    if (!zipper->AddDirectoryToZipFile(cp.string()))
-                    {
-                        std::string msg = std::string("Unable to initialize ").append(zipFileName);
-                        Logging::Log(m_logCb, Level::Error, msg.c_str());
-                        return GAMEKIT_ERROR_LAYER_ZIP_INIT_FAILED;
-                    }
+    m_compressedLayerHashes.clear();
+    getChangedLambdaLayerHashes(layerDirectories, m_compressedLayerHashes);
+    if (m_compressedLayerHashes.empty())
+    {
+        return GAMEKIT_SUCCESS;
+    }
 
-                    // write zip file to disk
-                    if (!zipper->CloseZipFile())
-                    {
-                        std::string msg = std::string("Unable to write ").append(zipFileName).append(" to disk");
-                        Logging::Log(m_logCb, Level::Error, msg.c_str(), this);
-                        return GAMEKIT_ERROR_LAYER_ZIP_WRITE_FAILED;
-                    }
+    fs::create_directories(getTempLayersPath());
 
-                    // zip file creation successful
-                    std::string msg = std::string("Zip file ")
-                        .append(zipFileName)
-                        .append(" created");
-                    Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
-                }
-            }
+    std::vector<std::function<unsigned int()>> tasks;
+    for (const std::string& layerDirectory : layerDirectories)
+    {
+        if (m_compressedLayerHashes.count(fs::path(layerDirectory).stem().string()) == 0)
+        {
+            continue;
         }
+
+        tasks.push_back([this, layerDirectory]()
+        {
+            std::string zipFileName;
+            return compressFeatureLayer(layerDirectory, zipFileName);
+        });
     }
 
-    return GAMEKIT_SUCCESS;
+    return GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
 }
 
 unsigned int GameKitFeatureResources::UploadFeatureLayers()
 {
     Logging::Log(m_logCb, Level::Verbose, "Start UploadFeatureLayers()", this);
 
-    // loop through feature layers temp directory
-    const std::string tempLayersPath = getTempLayersPath();
-    const fs::path p(tempLayersPath);
-    fs::directory_iterator endIterator;
-
     // If region name cannot be converted to short region code, return an error (all s3 buckets use 5-letter short region codes)
     const std::string shortRegionCode = getShortRegionCode();
     if (shortRegionCode.empty())
     {
         return GameKit::GAMEKIT_ERROR_REGION_CODE_CONVERSION_FAILED;
     }
+    const std::string bootstrapBucketName = GetBootstrapBucketName(m_accountInfo, shortRegionCode);
 
-    // Verify that the path exists and is a directory
-    if (fs::exists(p) && fs::is_directory(p))
+    // upload every zip file in the feature layers temp directory
+    const std::vector<std::string> zipFiles = getArtifactPaths(getTempLayersPath(), false);
+    std::vector<std::tuple<std::string, std::string, std::string>> publishedLayers(zipFiles.size());
+    std::vector<std::function<unsigned int()>> tasks;
+    for (size_t i = 0; i < zipFiles.size(); ++i)
     {
-        for (fs::directory_iterator dirIterator(p); dirIterator != endIterator; ++dirIterator)
+        tasks.push_back([this, i, &zipFiles, &publishedLayers, &bootstrapBucketName]()
         {
-            assert(GameKit::AwsApiInitializer::IsInitialized());
-            const fs::path cp = (*dirIterator);
-
-            // Verify that the path is a file
-            if (fs::is_regular_file(cp))
+            const std::string layerName = fs::path(zipFiles[i]).stem().string();
+            const auto layerHash = m_compressedLayerHashes.find(layerName);
+            std::string layerArn;
+            const unsigned int uploadResult = uploadFeatureLayer(zipFiles[i], bootstrapBucketName, layerArn);
+            if (uploadResult == GAMEKIT_SUCCESS && layerHash != m_compressedLayerHashes.end())
             {
-                std::string layerDirName = cp.stem().string();
-
-                // set put request params
-                std::string objectName = std::string("layers/")
-                    .append(GameKit::GetFeatureTypeString(m_featureType))
-                    .append("/")
-                    .append(layerDirName)
-                    .append(".")
-                    .append(m_layersReplacementId)
-                    .append(cp.extension().string());
-
-                std::shared_ptr<Aws::IOStream> inputData = Aws::MakeShared<Aws::FStream>(
-                    cp.string().c_str(),
-                    cp.native(),
-                    std::ios_base::in | std::ios_base::binary);
-
-                S3Model::PutObjectRequest putObjRequest;
-                putObjRequest.SetBucket(ToAwsString(GetBootstrapBucketName(m_accountInfo, shortRegionCode)));
-                putObjRequest.SetKey(ToAwsString(objectName));
-                putObjRequest.SetBody(inputData);
-                putObjRequest.SetExpectedBucketOwner(ToAwsString(m_accountInfo.accountId));
-
-                // upload zip file
-                Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::UploadFeatureLayers() Start put object", m_s3Client);
-                auto putObjOutcome = m_s3Client->PutObject(putObjRequest);
-                Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::UploadFeatureLayers() End put object", m_s3Client);
-
-                if (!putObjOutcome.IsSuccess())
-                {
-                    Logging::Log(m_logCb, Level::Error, putObjOutcome.GetError().GetMessage().c_str(), this);
-                    return GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED;
-                }
+                publishedLayers[i] = std::make_tuple(layerName, layerHash->second, layerArn);
+            }
 
-                std::string msg = std::string("Object: ")
-                    .append(objectName)
-                    .append(" uploaded to: ")
-                    .append(GetBootstrapBucketName(m_accountInfo, shortRegionCode))
-                    .append("; ETag: ")
-                    .append(ToStdString(putObjOutcome.GetResult().GetETag()));
+            return uploadResult;
+        });
+    }
 
-                Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
+    const unsigned int result = GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
 
-                // create Lambda layer
-                msg = std::string("GameKitFeatureResources::UploadFeatureLayers() Creating Lambda Layer for ").append(layerDirName);
-                auto layerCreationOutcome = createFeatureLayer(layerDirName, objectName);
-                if (!layerCreationOutcome.IsSuccess())
-                {
-                    return GAMEKIT_ERROR_LAYER_CREATION_FAILED;
-                }
+    // record the layers that were published, even if others failed, so they are not published again
+    const unsigned int recordResult = recordPublishedLambdaLayers(publishedLayers);
+    if (result != GAMEKIT_SUCCESS)
+    {
+        return result;
+    }
 
-                // get latest version ARN and set it in parameter store
-                std::string latestArn = ToStdString(layerCreationOutcome.GetResult().GetLayerVersionArn());
-                unsigned int paramWriteResult = createAndSetLambdaLayerArn(layerDirName, latestArn);
-                if (paramWriteResult != GAMEKIT_SUCCESS)
-                {
-                    return paramWriteResult;
-                }
-            }
-        }
+    if (recordResult != GAMEKIT_SUCCESS)
+    {
+        return recordResult;
     }
 
     Logging::Log(m_logCb, Level::Verbose, "End UploadFeatureLayers()", this);
@@ -637,24 +583,77 @@ unsigned int GameKitFeatureResources::UploadFeatureLayers()
 
 unsigned int GameKitFeatureResources::DeployFeatureLayers()
 {
+    const std::vector<std::string> layerDirectories = getArtifactPaths(m_instanceLayersPath, true);
+
+    // a redeploy of unchanged layers stops here, after a single batched read of the layer hashes
+    std::unordered_map<std::string, std::string> layerHashes;
+    getChangedLambdaLayerHashes(layerDirectories, layerHashes);
+    if (layerHashes.empty())
+    {
+        if (!layerDirectories.empty())
+        {
+            Logging::Log(m_logCb, Level::Info, "Lambda layers are unchanged since they were last deployed.", this);
+        }
+
+        return GAMEKIT_SUCCESS;
+    }
+
     unsigned int result = CreateAndSetLayersReplacementId();
     if (result != GameKit::GAMEKIT_SUCCESS)
     {
         return result;
     }
 
-    result = CompressFeatureLayers();
-    if (result != GameKit::GAMEKIT_SUCCESS)
+    // If region name cannot be converted to short region code, return an error (all s3 buckets use 5-letter short region codes)
+    const std::string shortRegionCode = getShortRegionCode();
+    if (shortRegionCode.empty())
     {
-        CleanupTempFiles();
-        return result;
+        return GameKit::GAMEKIT_ERROR_REGION_CODE_CONVERSION_FAILED;
     }
+    const std::string bootstrapBucketName = GetBootstrapBucketName(m_accountInfo, shortRegionCode);
 
-    result = UploadFeatureLayers();
-    if (result != GameKit::GAMEKIT_SUCCESS)
+    fs::create_directories(getTempLayersPath());
+
+    // each changed layer is zipped, uploaded and published as soon as the previous stage is done, independently of the other layers
+    std::vector<std::tuple<std::string, std::string, std::string>> publishedLayers(layerDirectories.size());
+    std::vector<std::function<unsigned int()>> tasks;
+    for (size_t i = 0; i < layerDirectories.size(); ++i)
     {
-        CleanupTempFiles();
-        return result;
+        const std::string layerName = fs::path(layerDirectories[i]).stem().string();
+        const auto layerHash = layerHashes.find(layerName);
+        if (layerHash == layerHashes.end())
+        {
+            continue;
+        }
+
+        const std::string hash = layerHash->second;
+        tasks.push_back([this, i, layerName, hash, &layerDirectories, &publishedLayers, &bootstrapBucketName]()
+        {
+            std::string zipFileName;
+            const unsigned int compressResult = compressFeatureLayer(layerDirectories[i], zipFileName);
+            if (compressResult != GAMEKIT_SUCCESS)
+            {
+                return compressResult;
+            }
+
+            std::string layerArn;
+            const unsigned int uploadResult = uploadFeatureLayer(zipFileName, bootstrapBucketName, layerArn);
+            if (uploadResult == GAMEKIT_SUCCESS)
+            {
+                publishedLayers[i] = std::make_tuple(layerName, hash, layerArn);
+            }
+
+            return uploadResult;
+        });
+    }
+
+    result = GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
+
+    // record the layers that were published, even if others failed, so they are not published again
+    const unsigned int recordResult = recordPublishedLambdaLayers(publishedLayers);
+    if (result == GAMEKIT_SUCCESS)
+    {
+        result = recordResult;
     }
 
     CleanupTempFiles();
@@ -664,69 +663,32 @@ unsigned int GameKitFeatureResources::DeployFeatureLayers()
 
 unsigned int GameKitFeatureResources::CompressFeatureFunctions()
 {
-    // loop through the feature's functions directory
-    std::string functionName;
-    Aws::UniquePtr<Zipper> zipper;
-    const fs::path p(m_instanceFunctionsPath);
-    fs::directory_iterator endIterator;
-
-    // Verify that path exists and is a directory
-    if (fs::exists(p) && fs::is_directory(p))
+    // zip every function directory
+    const std::vector<std::string> functionDirectories = getArtifactPaths(m_instanceFunctionsPath, true);
+    if (functionDirectories.empty())
     {
-        for (fs::directory_iterator dirIterator(p); dirIterator != endIterator; ++dirIterator)
-        {
-            // create zip file for every function directory
-            const fs::path cp = (*dirIterator);
-
-            // Verify that path is a directory
-            if (fs::is_directory(cp))
-            {
-                // create output directory in temp path
-                std::string tempFunctionsPath = getTempFunctionsPath();
-                fs::create_directories(tempFunctionsPath);
-
-                // create zip file
-                functionName = cp.stem().string();
-                std::string zipFileName = tempFunctionsPath + "/" + functionName + ".zip";
-                zipper = Aws::MakeUnique<Zipper>(zipFileName.c_str(), cp.string(), zipFileName);
-                bool result = zipper->AddDirectoryToZipFile(cp.string());
-                if (!result)
-                {
-                    std::string msg = std::string("Unable to initialize ").append(zipFileName);
-                    Logging::Log(m_logCb, Level::Error, msg.c_str());
-                    return GAMEKIT_ERROR_FUNCTION_ZIP_INIT_FAILED;
-                }
+        return GAMEKIT_SUCCESS;
+    }
 
-                // write zip file to disk
-                result = zipper->CloseZipFile();
-                if (!result)
-                {
-                    std::string msg = std::string("Unable to write ").append(zipFileName).append(" to disk");
-                    Logging::Log(m_logCb, Level::Error, msg.c_str(), this);
-                    return GAMEKIT_ERROR_FUNCTION_ZIP_WRITE_FAILED;
-                }
+    fs::create_directories(getTempFunctionsPath());
 
-                // zip file creation successful
-                std::string msg = std::string("Zip file ")
-                    .append(zipFileName)
-                    .append(" created");
-                Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
-            }
-        }
+    std::vector<std::function<unsigned int()>> tasks;
+    for (const std::string& functionDirectory : functionDirectories)
+    {
+        tasks.push_back([this, functionDirectory]()
+        {
+            std::string zipFileName;
+            return compressFeatureFunction(functionDirectory, zipFileName);
+        });
     }
 
-    return GAMEKIT_SUCCESS;
+    return GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
 }
 
 unsigned int GameKitFeatureResources::UploadFeatureFunctions()
 {
     Logging::Log(m_logCb, Level::Verbose, "Start UploadFeatureFunctions()", this);
 
-    // loop through feature functions temp directory
-    const std::string tempFunctionsPath = getTempFunctionsPath();
-    const fs::path p(tempFunctionsPath);
-    fs::directory_iterator endIterator;
-
     // If region name cannot be converted to short region code, return an error (all s3 buckets use 5-letter short region codes)
     const std::string shortRegionCode = getShortRegionCode();
     if (shortRegionCode.empty())
@@ -735,60 +697,20 @@ unsigned int GameKitFeatureResources::UploadFeatureFunctions()
     }
     const std::string bootstrapBucketName = GetBootstrapBucketName(m_accountInfo, shortRegionCode);
 
-    // Verify that path exists and is a directory
-    if (fs::exists(p) && fs::is_directory(p))
+    // upload every zip file in the feature functions temp directory
+    std::vector<std::function<unsigned int()>> tasks;
+    for (const std::string& zipFile : getArtifactPaths(getTempFunctionsPath(), false))
     {
-        for (fs::directory_iterator dirIterator(p); dirIterator != endIterator; ++dirIterator)
+        tasks.push_back([this, zipFile, &bootstrapBucketName]()
         {
-            assert(GameKit::AwsApiInitializer::IsInitialized());
-            const fs::path cp = (*dirIterator);
+            return uploadFeatureFunction(zipFile, bootstrapBucketName);
+        });
+    }
 
-            // Verify that path is a file
-            if (fs::is_regular_file(cp))
-            {
-                // set put request params
-                std::string objectName = std::string("functions/")
-                    .append(GameKit::GetFeatureTypeString(m_featureType))
-                    .append("/")
-                    .append(cp.stem().string())
-                    .append(".")
-                    .append(m_functionsReplacementId)
-                    .append(cp.extension().string());
-
-                std::shared_ptr<Aws::IOStream> inputData = Aws::MakeShared<Aws::FStream>(
-                    cp.string().c_str(),
-                    cp.native(),
-                    std::ios_base::in | std::ios_base::binary);
-
-                S3Model::PutObjectRequest putObjRequest;
-                putObjRequest.SetExpectedBucketOwner(ToAwsString(m_accountInfo.accountId));
-                putObjRequest.SetBucket(ToAwsString(bootstrapBucketName));
-                putObjRequest.SetKey(ToAwsString(objectName));
-                putObjRequest.SetBody(inputData);
-
-                // upload zip file
-                Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::UploadFeatureFunctions() Start put object", m_s3Client);
-                auto putObjOutcome = m_s3Client->PutObject(putObjRequest);
-                Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::UploadFeatureFunctions() End put object", m_s3Client);
-
-                if (putObjOutcome.IsSuccess())
-                {
-                    std::string msg = std::string("Object: ")
-                        .append(objectName)
-                        .append(" uploaded to: ")
-                        .append(bootstrapBucketName.c_str())
-                        .append("; ETag: ")
-                        .append(ToStdString(putObjOutcome.GetResult().GetETag()));
-
-                    Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
-                }
-                else
-                {
-                    Logging::Log(m_logCb, Level::Error, putObjOutcome.GetError().GetMessage().c_str(), this);
-                    return GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED;
-                }
-            }
-        }
+    const unsigned int result = GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
+    if (result != GAMEKIT_SUCCESS)
+    {
+        return result;
     }
 
     Logging::Log(m_logCb, Level::Verbose, "End UploadFeatureFunctions()", this);
@@ -804,20 +726,39 @@ unsigned int GameKitFeatureResources::DeployFeatureFunctions()
         return result;
     }
 
-    result = CompressFeatureFunctions();
-    if (result != GameKit::GAMEKIT_SUCCESS)
+    // If region name cannot be converted to short region code, return an error (all s3 buckets use 5-letter short region codes)
+    const std::string shortRegionCode = getShortRegionCode();
+    if (shortRegionCode.empty())
     {
-        CleanupTempFiles();
-        return result;
+        return GameKit::GAMEKIT_ERROR_REGION_CODE_CONVERSION_FAILED;
     }
+    const std::string bootstrapBucketName = GetBootstrapBucketName(m_accountInfo, shortRegionCode);
 
-    result = UploadFeatureFunctions();
-    if (result != GameKit::GAMEKIT_SUCCESS)
+    const std::vector<std::string> functionDirectories = getArtifactPaths(m_instanceFunctionsPath, true);
+    if (!functionDirectories.empty())
     {
-        CleanupTempFiles();
-        return result;
+        fs::create_directories(getTempFunctionsPath());
     }
 
+    // each function is zipped and uploaded as soon as its zip file is written, independently of the other functions
+    std::vector<std::function<unsigned int()>> tasks;
+    for (const std::string& functionDirectory : functionDirectories)
+    {
+        tasks.push_back([this, functionDirectory, &bootstrapBucketName]()
+        {
+            std::string zipFileName;
+            const unsigned int compressResult = compressFeatureFunction(functionDirectory, zipFileName);
+            if (compressResult != GAMEKIT_SUCCESS)
+            {
+                return compressResult;
+            }
+
+            return uploadFeatureFunction(zipFileName, bootstrapBucketName);
+        });
+    }
+
+    result = GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
+
     CleanupTempFiles();
 
     return result;
@@ -847,19 +788,91 @@ std::string GameKitFeatureResources::GetCurrentStackStatus() const
     const auto describeStackReq = CfnModel::DescribeStacksRequest()
         .WithStackName(m_stackName.c_str());
 
-    auto outcome = m_cfClient->DescribeStacks(describeStackReq);
-    auto stackStatus = CfnModel::StackStatus::NOT_SET;
-    auto stacks = outcome.GetResult().GetStacks();
+    const auto outcome = m_cfClient->DescribeStacks(describeStackReq);
+    const auto& stacks = outcome.GetResult().GetStacks();
 
-    if (stacks.size() > 0)
+    return GetStackStatusFromDescription(stacks.empty() ? nullptr : &stacks.front());
+}
+
+unsigned int GameKitFeatureResources::DescribeFeatureStacks(const std::unordered_set<std::string>& stackNames, std::unordered_map<std::string, CfnModel::Stack>& returnedStacks) const
+{
+    returnedStacks.clear();
+
+    // Without a stack name, DescribeStacks returns every stack of the account that isn't deleted.
+    // Accounts with many stacks are only swept partially, so a missing stack doesn't page through all of them.
+    Aws::String nextToken;
+    int page = 0;
+    do
+    {
+        auto describeStacksReq = CfnModel::DescribeStacksRequest();
+        if (!nextToken.empty())
+        {
+            describeStacksReq.SetNextToken(nextToken);
+        }
+
+        const auto outcome = m_cfClient->DescribeStacks(describeStacksReq);
+        if (!outcome.IsSuccess())
+        {
+            const std::string msg = "DescribeStacks failed: " + ToStdString(outcome.GetError().GetMessage());
+            Logging::Log(m_logCb, Level::Warning, msg.c_str(), this);
+            return GAMEKIT_ERROR_CLOUDFORMATION_DESCRIBE_STACKS_FAILED;
+        }
+
+        for (const CfnModel::Stack& stack : outcome.GetResult().GetStacks())
+        {
+            const std::string stackName = ToStdString(stack.GetStackName());
+            if (stackNames.find(stackName) != stackNames.end())
+            {
+                returnedStacks.emplace(stackName, stack);
+            }
+        }
+
+        nextToken = outcome.GetResult().GetNextToken();
+    } while (!nextToken.empty() && returnedStacks.size() < stackNames.size() && ++page < MAX_DESCRIBE_STACKS_PAGES);
+
+    if (nextToken.empty() || returnedStacks.size() == stackNames.size())
+    {
+        return GAMEKIT_SUCCESS;
+    }
+
+    // Describe the remaining stacks by name, a stack that doesn't exist is reported as a validation error
+    for (const std::string& stackName : stackNames)
+    {
+        if (returnedStacks.find(stackName) != returnedStacks.end())
+        {
+            continue;
+        }
+
+        const auto outcome = m_cfClient->DescribeStacks(CfnModel::DescribeStacksRequest().WithStackName(ToAwsString(stackName)));
+        if (outcome.IsSuccess())
+        {
+            if (!outcome.GetResult().GetStacks().empty())
+            {
+                returnedStacks.emplace(stackName, outcome.GetResult().GetStacks().front());
+            }
+        }
+        else if (outcome.GetError().GetErrorType() != Aws::CloudFormation::CloudFormationErrors::VALIDATION)
+        {
+            const std::string msg = "DescribeStacks failed for " + stackName + ": " + ToStdString(outcome.GetError().GetMessage());
+            Logging::Log(m_logCb, Level::Warning, msg.c_str(), this);
+            return GAMEKIT_ERROR_CLOUDFORMATION_DESCRIBE_STACKS_FAILED;
+        }
+    }
+
+    return GAMEKIT_SUCCESS;
+}
+
+std::string GameKitFeatureResources::GetStackStatusFromDescription(const CfnModel::Stack* describedStack) const
+{
+    auto stackStatus = CfnModel::StackStatus::NOT_SET;
+    if (describedStack != nullptr)
     {
-        stackStatus = stacks.at(0).GetStackStatus();
+        stackStatus = describedStack->GetStackStatus();
     }
 
     if (stackStatus == CfnModel::StackStatus::CREATE_COMPLETE || stackStatus == CfnModel::StackStatus::UPDATE_COMPLETE)
     {
-        const auto outputs = stacks.at(0).GetOutputs();
-        const auto writeResult = this->writeClientConfigurationWithOutputs(outputs);
+        const auto writeResult = this->writeClientConfigurationWithOutputs(describedStack->GetOutputs());
         if (writeResult != GAMEKIT_SUCCESS)
         {
             std::string msg = std::string("Failed to write client configuration parameters for ").append(m_stackName);
@@ -979,6 +992,179 @@ unsigned int GameKitFeatureResources::DescribeStackResources(const DISPATCH_RECE
     return internalDescribeFeatureResources(nullptr, dispatchReceiver, resourceInfoCb);
 }
 
+std::vector<std::string> GameKitFeatureResources::getArtifactPaths(const std::string& parentPath, bool directories) const
+{
+    std::vector<std::string> paths;
+    const fs::path p(parentPath);
+
+    // Verify that path exists and is a directory
+    if (fs::exists(p) && fs::is_directory(p))
+    {
+        fs::directory_iterator endIterator;
+        for (fs::directory_iterator dirIterator(p); dirIterator != endIterator; ++dirIterator)
+        {
+            const fs::path cp = (*dirIterator);
+            if (directories ? fs::is_directory(cp) : fs::is_regular_file(cp))
+            {
+                paths.push_back(cp.string());
+            }
+        }
+    }
+
+    return paths;
+}
+
+unsigned int GameKitFeatureResources::compressFeatureLayer(const std::string& layerDirectory, std::string& returnedZipFileName) const
+{
+    const std::string layerName = fs::path(layerDirectory).stem().string();
+
+    // create zip file
+    const std::string zipFileName = getTempLayersPath() + "/" + layerName + ".zip";
+    Aws::UniquePtr<Zipper> zipper = Aws::MakeUnique<Zipper>(zipFileName.c_str(), layerDirectory, zipFileName);
+    if (!zipper->AddDirectoryToZipFile(layerDirectory))
+    {
+        std::string msg = std::string("Unable to initialize ").append(zipFileName);
+        Logging::Log(m_logCb, Level::Error, msg.c_str());
+        return GAMEKIT_ERROR_LAYER_ZIP_INIT_FAILED;
+    }
+
+    // write zip file to disk
+    if (!zipper->CloseZipFile())
+    {
+        std::string msg = std::string("Unable to write ").append(zipFileName).append(" to disk");
+        Logging::Log(m_logCb, Level::Error, msg.c_str(), this);
+        return GAMEKIT_ERROR_LAYER_ZIP_WRITE_FAILED;
+    }
+
+    // zip file creation successful
+    std::string msg = std::string("Zip file ")
+        .append(zipFileName)
+        .append(" created");
+    Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
+
+    returnedZipFileName = zipFileName;
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameKitFeatureResources::uploadFeatureLayer(const std::string& zipFile, const std::string& bootstrapBucketName, std::string& returnedLayerArn)
+{
+    assert(GameKit::AwsApiInitializer::IsInitialized());
+    const fs::path zipFilePath(zipFile);
+    const std::string layerDirName = zipFilePath.stem().string();
+
+    // set put request params
+    std::string objectName = std::string("layers/")
+        .append(GameKit::GetFeatureTypeString(m_featureType))
+        .append("/")
+        .append(layerDirName)
+        .append(".")
+        .append(m_layersReplacementId)
+        .append(zipFilePath.extension().string());
+
+    const unsigned int result = putArtifact(zipFile, objectName, bootstrapBucketName);
+    if (result != GAMEKIT_SUCCESS)
+    {
+        return result;
+    }
+
+    // create Lambda layer
+    std::string msg = std::string("GameKitFeatureResources::UploadFeatureLayers() Creating Lambda Layer for ").append(layerDirName);
+    Logging::Log(m_logCb, Level::Verbose, msg.c_str(), this);
+    auto layerCreationOutcome = createFeatureLayer(layerDirName, objectName, bootstrapBucketName);
+    if (!layerCreationOutcome.IsSuccess())
+    {
+        return GAMEKIT_ERROR_LAYER_CREATION_FAILED;
+    }
+
+    // the ARN of the new version is set in parameter store with the layer hash, see recordPublishedLambdaLayers()
+    returnedLayerArn = ToStdString(layerCreationOutcome.GetResult().GetLayerVersionArn());
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameKitFeatureResources::compressFeatureFunction(const std::string& functionDirectory, std::string& returnedZipFileName) const
+{
+    // create zip file
+    const std::string functionName = fs::path(functionDirectory).stem().string();
+    const std::string zipFileName = getTempFunctionsPath() + "/" + functionName + ".zip";
+    Aws::UniquePtr<Zipper> zipper = Aws::MakeUnique<Zipper>(zipFileName.c_str(), functionDirectory, zipFileName);
+    if (!zipper->AddDirectoryToZipFile(functionDirectory))
+    {
+        std::string msg = std::string("Unable to initialize ").append(zipFileName);
+        Logging::Log(m_logCb, Level::Error, msg.c_str());
+        return GAMEKIT_ERROR_FUNCTION_ZIP_INIT_FAILED;
+    }
+
+    // write zip file to disk
+    if (!zipper->CloseZipFile())
+    {
+        std::string msg = std::string("Unable to write ").append(zipFileName).append(" to disk");
+        Logging::Log(m_logCb, Level::Error, msg.c_str(), this);
+        return GAMEKIT_ERROR_FUNCTION_ZIP_WRITE_FAILED;
+    }
+
+    // zip file creation successful
+    std::string msg = std::string("Zip file ")
+        .append(zipFileName)
+        .append(" created");
+    Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
+
+    returnedZipFileName = zipFileName;
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameKitFeatureResources::uploadFeatureFunction(const std::string& zipFile, const std::string& bootstrapBucketName) const
+{
+    assert(GameKit::AwsApiInitializer::IsInitialized());
+    const fs::path zipFilePath(zipFile);
+
+    // set put request params
+    std::string objectName = std::string("functions/")
+        .append(GameKit::GetFeatureTypeString(m_featureType))
+        .append("/")
+        .append(zipFilePath.stem().string())
+        .append(".")
+        .append(m_functionsReplacementId)
+        .append(zipFilePath.extension().string());
+
+    return putArtifact(zipFile, objectName, bootstrapBucketName);
+}
+
+unsigned int GameKitFeatureResources::putArtifact(const std::string& zipFile, const std::string& objectName, const std::string& bootstrapBucketName) const
+{
+    const fs::path zipFilePath(zipFile);
+    std::shared_ptr<Aws::IOStream> inputData = Aws::MakeShared<Aws::FStream>(
+        zipFile.c_str(),
+        zipFilePath.native(),
+        std::ios_base::in | std::ios_base::binary);
+
+    S3Model::PutObjectRequest putObjRequest;
+    putObjRequest.SetExpectedBucketOwner(ToAwsString(m_accountInfo.accountId));
+    putObjRequest.SetBucket(ToAwsString(bootstrapBucketName));
+    putObjRequest.SetKey(ToAwsString(objectName));
+    putObjRequest.SetBody(inputData);
+
+    // upload zip file
+    Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::putArtifact() Start put object", m_s3Client);
+    auto putObjOutcome = m_s3Client->PutObject(putObjRequest);
+    Logging::Log(m_logCb, Level::Verbose, "GameKitFeatureResources::putArtifact() End put object", m_s3Client);
+
+    if (!putObjOutcome.IsSuccess())
+    {
+        Logging::Log(m_logCb, Level::Error, putObjOutcome.GetError().GetMessage().c_str(), this);
+        return GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED;
+    }
+
+    std::string msg = std::string("Object: ")
+        .append(objectName)
+        .append(" uploaded to: ")
+        .append(bootstrapBucketName)
+        .append("; ETag: ")
+        .append(ToStdString(putObjOutcome.GetResult().GetETag()));
+    Logging::Log(m_logCb, Level::Info, msg.c_str(), this);
+
+    return GAMEKIT_SUCCESS;
+}
+
 std::string GameKitFeatureResources::getFeatureLayerNameFromDirName(const std::string& layerDirName) const
 {
     return std::string("gamekit_")
@@ -989,10 +1175,10 @@ std::string GameKitFeatureResources::getFeatureLayerNameFromDirName(const std::s
                 .append(layerDirName);
 }
 
-LambdaModel::PublishLayerVersionOutcome GameKitFeatureResources::createFeatureLayer(const std::string& layerDirName, const std::string& s3ObjectName)
+LambdaModel::PublishLayerVersionOutcome GameKitFeatureResources::createFeatureLayer(const std::string& layerDirName, const std::string& s3ObjectName, const std::string& bootstrapBucketName)
 {
     const auto layerContent = LambdaModel::LayerVersionContentInput()
-        .WithS3Bucket(ToAwsString(GetBootstrapBucketName(m_accountInfo, getShortRegionCode())))
+        .WithS3Bucket(ToAwsString(bootstrapBucketName))
         .WithS3Key(ToAwsString(s3ObjectName));
 
     const std::string layerName = getFeatureLayerNameFromDirName(layerDirName);
@@ -1005,80 +1191,179 @@ LambdaModel::PublishLayerVersionOutcome GameKitFeatureResources::createFeatureLa
     return m_lambdaClient->PublishLayerVersion(publishRequest);
 }
 
-bool GameKitFeatureResources::lambdaLayerHashChanged(const std::string& layerName, const std::string& layerHash) const
+unsigned int GameKitFeatureResources::getParameters(const std::vector<std::string>& paramNames, std::unordered_map<std::string, SSMModel::Parameter>& returnedParams) const
 {
-    const std::string paramName = GetLambdaLayerHashParamName(layerName);
-
-    SSMModel::GetParameterRequest getParamRequest;
-    getParamRequest.SetName(ToAwsString(paramName));
-
-    const auto getParamOutcome = m_ssmClient->GetParameter(getParamRequest);
-    if (!getParamOutcome.IsSuccess())
+    std::mutex returnedParamsMutex;
+    std::vector<std::function<unsigned int()>> tasks;
+    for (size_t batchStart = 0; batchStart < paramNames.size(); batchStart += MAX_PARAMETERS_PER_REQUEST)
     {
-        // SSM returns 400 for all errors except internal server error (500)
-        // Warn if not internal server error, otherwise log as Error by default
-        Level level = Level::Error;
-        std::string defaultErrorMessage = std::string("Lambda Layer hash parameter not found for layer ").append(layerName);
-        if (getParamOutcome.GetError().GetResponseCode() != Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR)
+        const size_t batchEnd = std::min(batchStart + MAX_PARAMETERS_PER_REQUEST, paramNames.size());
+        tasks.push_back([this, batchStart, batchEnd, &paramNames, &returnedParams, &returnedParamsMutex]()
         {
-            level = Level::Warning;
-            defaultErrorMessage.append(". This is expected when you deploy your first GameKit feature.");
-        }
+            SSMModel::GetParametersRequest getParamsRequest;
+            for (size_t i = batchStart; i < batchEnd; ++i)
+            {
+                getParamsRequest.AddNames(ToAwsString(paramNames[i]));
+            }
 
-        // Returned error message may be empty. Use default error message instead.
-        std::string errorMessage = (getParamOutcome.GetError().GetMessage().empty()) ? defaultErrorMessage : ToStdString(getParamOutcome.GetError().GetMessage());
-        Logging::Log(m_logCb, level, errorMessage.c_str(), this);
-        return false;
-    }
+            // parameters that don't exist are returned as invalid parameters, not as an error
+            const auto getParamsOutcome = m_ssmClient->GetParameters(getParamsRequest);
+            if (!getParamsOutcome.IsSuccess() && getParamsOutcome.GetError().GetErrorType() == Aws::SSM::SSMErrors::ACCESS_DENIED)
+            {
+                // policies written for earlier versions only allow ssm:GetParameter, read the parameters one by one
+                Logging::Log(m_logCb, Level::Verbose, "ssm:GetParameters is not allowed, reading Lambda Layer parameters with ssm:GetParameter.", this);
+                for (size_t i = batchStart; i < batchEnd; ++i)
+                {
+                    const auto getParamOutcome = m_ssmClient->GetParameter(SSMModel::GetParameterRequest().WithName(ToAwsString(paramNames[i])));
+                    if (getParamOutcome.IsSuccess())
+                    {
+                        std::lock_guard<std::mutex> lock(returnedParamsMutex);
+                        returnedParams.emplace(paramNames[i], getParamOutcome.GetResult().GetParameter());
+                    }
+                    else if (getParamOutcome.GetError().GetErrorType() != Aws::SSM::SSMErrors::PARAMETER_NOT_FOUND)
+                    {
+                        const std::string errorMessage = "Unable to read Lambda Layer parameter " + paramNames[i] + ": " + ToStdString(getParamOutcome.GetError().GetMessage());
+                        Logging::Log(m_logCb, Level::Error, errorMessage.c_str(), this);
+                        return GAMEKIT_ERROR_PARAMSTORE_READ_FAILED;
+                    }
+                }
 
-    const auto lastRecordedHash = getParamOutcome.GetResult().GetParameter();
-    if (std::string(lastRecordedHash.GetValue()) != layerHash)
-    {
-        return false;
+                return GAMEKIT_SUCCESS;
+            }
+
+            if (!getParamsOutcome.IsSuccess())
+            {
+                const std::string errorMessage = "Unable to read Lambda Layer parameters: " + ToStdString(getParamsOutcome.GetError().GetMessage());
+                Logging::Log(m_logCb, Level::Error, errorMessage.c_str(), this);
+                return GAMEKIT_ERROR_PARAMSTORE_READ_FAILED;
+            }
+
+            std::lock_guard<std::mutex> lock(returnedParamsMutex);
+            for (const SSMModel::Parameter& param : getParamsOutcome.GetResult().GetParameters())
+            {
+                returnedParams.emplace(ToStdString(param.GetName()), param);
+            }
+
+            return GAMEKIT_SUCCESS;
+        });
     }
 
-    return true;
+    return GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
 }
 
-unsigned int GameKitFeatureResources::createAndSetLambdaLayerHash(const std::string& layerName, const std::string& layerHash) const
+void GameKitFeatureResources::getChangedLambdaLayerHashes(const std::vector<std::string>& layerDirectories, std::unordered_map<std::string, std::string>& returnedLayerHashes) const
 {
-    const std::string paramName = GetLambdaLayerHashParamName(layerName);
+    // hash every layer directory, layers whose hash can't be calculated are not deployed
+    std::vector<std::string> layerHashes(layerDirectories.size());
+    std::vector<std::function<unsigned int()>> tasks;
+    for (size_t i = 0; i < layerDirectories.size(); ++i)
+    {
+        tasks.push_back([i, &layerDirectories, &layerHashes]()
+        {
+            GameKit::Utils::FileUtils::CalculateDirectoryHash(layerDirectories[i], layerHashes[i]);
+            return GAMEKIT_SUCCESS;
+        });
+    }
+    GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
 
-    SSMModel::PutParameterRequest putParamRequest;
-    putParamRequest.SetType(SSMModel::ParameterType::String);
-    putParamRequest.SetName(ToAwsString(paramName));
-    putParamRequest.SetValue(ToAwsString(layerHash));
-    putParamRequest.SetOverwrite(true);
+    // a layer is unchanged only when its deployed hash matches and the ARN it was published as is found
+    std::vector<std::string> layerNames(layerDirectories.size());
+    std::vector<std::string> paramNames;
+    for (size_t i = 0; i < layerDirectories.size(); ++i)
+    {
+        if (layerHashes[i].empty())
+        {
+            continue;
+        }
 
-    const auto putParamOutcome = m_ssmClient->PutParameter(putParamRequest);
-    if (!putParamOutcome.IsSuccess())
+        layerNames[i] = fs::path(layerDirectories[i]).stem().string();
+        paramNames.push_back(GetLambdaLayerHashParamName(layerNames[i]));
+        paramNames.push_back(GetLambdaLayerARNParamName(layerNames[i]));
+    }
+
+    std::unordered_map<std::string, SSMModel::Parameter> params;
+    const unsigned int result = getParameters(paramNames, params);
+    if (result != GAMEKIT_SUCCESS)
     {
-        Logging::Log(m_logCb, Level::Error, putParamOutcome.GetError().GetMessage().c_str(), this);
-        return GAMEKIT_ERROR_PARAMSTORE_WRITE_FAILED;
+        // deploy every layer rather than skip layers that may have changed
+        params.clear();
     }
 
-    return GAMEKIT_SUCCESS;
+    for (size_t i = 0; i < layerDirectories.size(); ++i)
+    {
+        if (layerHashes[i].empty())
+        {
+            continue;
+        }
+
+        const auto hashParam = params.find(GetLambdaLayerHashParamName(layerNames[i]));
+        const auto arnParam = params.find(GetLambdaLayerARNParamName(layerNames[i]));
+        if (hashParam == params.end())
+        {
+            if (result == GAMEKIT_SUCCESS)
+            {
+                const std::string msg = std::string("Lambda Layer hash parameter not found for layer ").append(layerNames[i]).append(". This is expected when you deploy your first GameKit feature.");
+                Logging::Log(m_logCb, Level::Warning, msg.c_str(), this);
+            }
+        }
+        else if (ToStdString(hashParam->second.GetValue()) == layerHashes[i] && arnParam != params.end())
+        {
+            continue;
+        }
+
+        returnedLayerHashes.emplace(layerNames[i], layerHashes[i]);
+    }
 }
 
-unsigned int GameKitFeatureResources::createAndSetLambdaLayerArn(const std::string& layerName, const std::string& layerArn) const
+unsigned int GameKitFeatureResources::recordPublishedLambdaLayers(const std::vector<std::tuple<std::string, std::string, std::string>>& layers) const
 {
-    // add GAMEKIT_LAMBDA_LAYER_ARN to Parameter Store with the replacement id
-    const auto paramName = GetLambdaLayerARNParamName(layerName);
+    std::atomic<unsigned int> result(GAMEKIT_SUCCESS);
+    std::vector<std::function<unsigned int()>> tasks;
+    for (const auto& layer : layers)
+    {
+        if (std::get<0>(layer).empty())
+        {
+            continue;
+        }
 
-    SSMModel::PutParameterRequest putParamRequest;
-    putParamRequest.SetType(SSMModel::ParameterType::String);
-    putParamRequest.SetName(ToAwsString(paramName));
-    putParamRequest.SetValue(ToAwsString(layerArn));
-    putParamRequest.SetOverwrite(true);
+        tasks.push_back([this, &layer, &result]()
+        {
+            const std::string& layerName = std::get<0>(layer);
+            const std::string& layerHash = std::get<1>(layer);
+            const std::string& layerArn = std::get<2>(layer);
 
-    const auto putParamOutcome = m_ssmClient->PutParameter(putParamRequest);
-    if (!putParamOutcome.IsSuccess())
+            // the hash is written after the ARN, so a layer whose ARN couldn't be recorded is published again by the next deployment
+            for (const auto& param : { std::make_pair(GetLambdaLayerARNParamName(layerName), layerArn), std::make_pair(GetLambdaLayerHashParamName(layerName), layerHash) })
+            {
+                SSMModel::PutParameterRequest putParamRequest;
+                putParamRequest.SetType(SSMModel::ParameterType::String);
+                putParamRequest.SetName(ToAwsString(param.first));
+                putParamRequest.SetValue(ToAwsString(param.second));
+                putParamRequest.SetOverwrite(true);
+
+                const auto putParamOutcome = m_ssmClient->PutParameter(putParamRequest);
+                if (!putParamOutcome.IsSuccess())
+                {
+                    const std::string errorMessage = "Unable to save Lambda Layer parameters for " + layerName + ": " + ToStdString(putParamOutcome.GetError().GetMessage());
+                    Logging::Log(m_logCb, Level::Error, errorMessage.c_str(), this);
+                    result = GAMEKIT_ERROR_PARAMSTORE_WRITE_FAILED;
+
+                    // keep recording the other layers
+                    return GAMEKIT_SUCCESS;
+                }
+            }
+
+            return GAMEKIT_SUCCESS;
+        });
+    }
+
+    if (tasks.empty())
     {
-        Logging::Log(m_logCb, Level::Error, putParamOutcome.GetError().GetMessage().c_str(), this);
-        return GAMEKIT_ERROR_PARAMSTORE_WRITE_FAILED;
+        return GAMEKIT_SUCCESS;
     }
 
-    return GAMEKIT_SUCCESS;
+    GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_ARTIFACT_TASKS);
+    return result;
 }
 
 std::string GameKitFeatureResources::getShortRegionCode()
@@ -1115,7 +1400,7 @@ unsigned int GameKitFeatureResources::CreateOrUpdateFeatureStack()
 
     snprintf(buffer, 256, "Creating stack resources for stack: %s", m_stackName.c_str());
     Logging::Log(m_logCb, Level::Info, buffer, this);
-    const auto stackStatus = periodicallyDescribeStackEvents();
+    const auto stackStatus = waitForStackOperation();
 
     // if last stack status is a failed state or deletion completion or deletion in progress, return a failed creation error code
     if (isFailedState(stackStatus) || stackStatus == CfnModel::StackStatus::DELETE_IN_PROGRESS || stackStatus == CfnModel::StackStatus::DELETE_COMPLETE)
@@ -1149,6 +1434,8 @@ unsigned int GameKitFeatureResources::writeClientConfigYamlToDisk(const YAML::No
 
 unsigned int GameKitFeatureResources::removeOutputsFromClientConfiguration() const
 {
+    std::lock_guard<std::recursive_mutex> clientConfigGuard(getClientConfigMutex());
+
     YAML::Node paramsYml = this->getClientConfigYaml();
     auto configParams = this->getConfigOutputParameters();
     if (configParams.size() == 0)
@@ -1167,6 +1454,8 @@ unsigned int GameKitFeatureResources::removeOutputsFromClientConfiguration() con
 
 unsigned int GameKitFeatureResources::writeClientConfigurationWithOutputs(Aws::Vector<CfnModel::Output> outputs) const
 {
+    std::lock_guard<std::recursive_mutex> clientConfigGuard(getClientConfigMutex());
+
     // Defensively check to make sure we actually are being passed new data and we are not working with Main stack,
     // otherwise just return success
     if (outputs.size() == 0 || m_featureType == FeatureType::Main)
@@ -1197,17 +1486,18 @@ unsigned int GameKitFeatureResources::writeClientConfigurationWithOutputs(Aws::V
         paramsYml = this->getClientConfigYaml();
     }
 
+    // values of CloudFormation output vars AWSGAMEKIT::CFNOUTPUT::*
+    std::unordered_map<std::string, std::string> outputValues;
+    for (auto& output : outputs)
+    {
+        outputValues.emplace(TemplateVars::AWS_GAMEKIT_CLOUDFORMATION_OUTPUT_PREFIX + ToStdString(output.GetOutputKey()), ToStdString(output.GetOutputValue()));
+    }
+
     auto configParams = this->getConfigOutputParameters();
     for (auto& param : configParams)
     {
         std::string paramKey = std::get<0>(param);
-        std::string paramVal = std::get<1>(param);
-        for (auto& output : outputs)
-        {
-            // replace occurrences of CloudFormation output vars AWSGAMEKIT::CFNOUTPUT::*
-            std::regex key(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_CLOUDFORMATION_OUTPUT_PREFIX + ToStdString(output.GetOutputKey()) + TemplateVars::END);
-            paramVal = std::regex_replace(paramVal, key, output.GetOutputValue());
-        }
+        std::string paramVal = GameKit::Utils::ParsedTemplate(std::get<1>(param)).Render(outputValues);
 
         std::string existingVal = paramsYml[paramKey].Scalar();
         if (existingVal != paramVal)
@@ -1229,6 +1519,8 @@ unsigned int GameKitFeatureResources::writeClientConfigurationWithOutputs(Aws::V
 
 unsigned int GameKitFeatureResources::WriteEmptyClientConfiguration() const
 {
+    std::lock_guard<std::recursive_mutex> clientConfigGuard(getClientConfigMutex());
+
     // Empty params since this should only be called when submitting an environment for the first time
     const YAML::Node paramsYml;
     return this->writeClientConfigYamlToDisk(paramsYml);
@@ -1280,7 +1572,7 @@ unsigned int GameKitFeatureResources::DeleteFeatureStack()
 
     snprintf(buffer, 256, "Deleting stack resources for stack: %s", m_stackName.c_str());
     Logging::Log(m_logCb, Level::Info, buffer, this);
-    const auto stackStatus = periodicallyDescribeStackEvents();
+    const auto stackStatus = waitForStackOperation();
 
     // Deleted stacks do not show up in the DescribeStacks API (by stack name) if the deletion has been completed successfully,
     // so the last status could be DELETE_IN_PROGRESS for successfully deleted stacks.
@@ -1335,13 +1627,15 @@ Aws::Vector<CfnModel::Parameter> GameKitFeatureResources::getStackParameters(Tem
     const std::map<std::string, std::string> userParams = settings.GetFeatureVariables(m_featureType);
 
     // Replace all instances of AWSGAMEKIT::VARS::* values with user parameter values
-    std::string rawParams = this->getRawStackParameters(templateType);
+    std::unordered_map<std::string, std::string> userVariables;
+    userVariables.reserve(userParams.size());
     for (const std::pair<std::string, std::string>& entry : userParams)
     {
-        std::regex key(TemplateVars::BEGIN + TemplateVars::AWS_GAMEKIT_USERVAR_PREFIX + entry.first + TemplateVars::END);
-        rawParams = std::regex_replace(rawParams, key, entry.second);
+        userVariables.emplace(TemplateVars::AWS_GAMEKIT_USERVAR_PREFIX + entry.first, entry.second);
     }
 
+    const std::string rawParams = loadTemplate(templateType, TemplateFileNames::PARAMETERS_FILE)->Render(userVariables);
+
     YAML::Node paramsYml = YAML::Load(rawParams);
 
     // read parameters and put them in a vector
@@ -1357,7 +1651,7 @@ Aws::Vector<CfnModel::Parameter> GameKitFeatureResources::getStackParameters(Tem
     return params;
 }
 
-std::string GameKitFeatureResources::getRawStackParameters(TemplateType templateType) const
+std::string GameKitFeatureResources::getCloudFormationTemplate(TemplateType templateType) const
 {
     auto cfPath = m_baseCloudformationPath;
     if (templateType == TemplateType::Instance)
@@ -1366,12 +1660,12 @@ std::string GameKitFeatureResources::getRawStackParameters(TemplateType template
     }
 
     std::string loadedString;
-    GameKit::Utils::FileUtils::ReadFileIntoString(cfPath + TemplateFileNames::PARAMETERS_FILE, loadedString);
+    GameKit::Utils::FileUtils::ReadFileIntoString(cfPath + TemplateFileNames::CLOUDFORMATION_FILE, loadedString);
 
     return loadedString;
 }
 
-std::string GameKitFeatureResources::getFeatureDashboardTemplate(TemplateType templateType) const
+std::shared_ptr<const GameKit::Utils::ParsedTemplate> GameKitFeatureResources::loadTemplate(TemplateType templateType, const std::string& fileName) const
 {
     auto cfPath = m_baseCloudformationPath;
     if (templateType == TemplateType::Instance)
@@ -1379,24 +1673,20 @@ std::string GameKitFeatureResources::getFeatureDashboardTemplate(TemplateType te
         cfPath = m_instanceCloudformationPath;
     }
 
-    std::string loadedString;
-    GameKit::Utils::FileUtils::ReadFileIntoString(cfPath + TemplateFileNames::FEATURE_DASHBOARD_FILE, loadedString);
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> parsedTemplate;
+    GameKit::Utils::TemplateUtils::LoadTemplate(cfPath + fileName, parsedTemplate);
 
-    return loadedString;
+    return parsedTemplate;
 }
 
-std::string GameKitFeatureResources::getCloudFormationTemplate(TemplateType templateType) const
+std::unordered_map<std::string, std::string> GameKitFeatureResources::getSystemVariables(const std::string& shortRegionCode) const
 {
-    auto cfPath = m_baseCloudformationPath;
-    if (templateType == TemplateType::Instance)
-    {
-        cfPath = m_instanceCloudformationPath;
-    }
-
-    std::string loadedString;
-    GameKit::Utils::FileUtils::ReadFileIntoString(cfPath + TemplateFileNames::CLOUDFORMATION_FILE, loadedString);
-
-    return loadedString;
+    return {
+        { TemplateVars::AWS_GAMEKIT_ENVIRONMENT, m_accountInfo.environment.GetEnvironmentString() },
+        { TemplateVars::AWS_GAMEKIT_GAMENAME, m_accountInfo.gameName },
+        { TemplateVars::AWS_GAMEKIT_BASE36_AWS_ACCOUNTID, GameKit::Utils::EncodingUtils::DecimalToBase(m_accountInfo.accountId, GameKit::Utils::BASE_36) },
+        { TemplateVars::AWS_GAMEKIT_SHORT_REGION_CODE, shortRegionCode }
+    };
 }
 
 unsigned int GameKitFeatureResources::createStack() const
@@ -1509,61 +1799,10 @@ unsigned int GameKitFeatureResources::deleteStack() const
     return deleteStackResult;
 }
 
-CfnModel::StackStatus GameKitFeatureResources::periodicallyDescribeStackEvents()
-{
-    const auto describeStackReq = CfnModel::DescribeStacksRequest().WithStackName(ToAwsString(m_stackName));
-
-    auto outcome = m_cfClient->DescribeStacks(describeStackReq);
-    auto stackStatus = CfnModel::StackStatus::NOT_SET;
-    if (outcome.GetResult().GetStacks().size() > 0)
-    {
-        stackStatus = outcome.GetResult().GetStacks().at(0).GetStackStatus();
-    }
-    // get first description of stack events (we may not even go into the loop below if process is already complete)
-    describeStackEvents();
-
-    while (outcome.IsSuccess() && !isTerminalState(stackStatus))
-    {
-        outcome = m_cfClient->DescribeStacks(describeStackReq);
-        if (outcome.GetResult().GetStacks().size() > 0)
-        {
-            stackStatus = outcome.GetResult().GetStacks().at(0).GetStackStatus();
-        }
-
-        // get stack events
-        describeStackEvents();
-
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-    }
-
-    return stackStatus;
-}
-
-void GameKitFeatureResources::describeStackEvents()
+CfnModel::StackStatus GameKitFeatureResources::waitForStackOperation() const
 {
-    auto describeStackEventsReq = CfnModel::DescribeStackEventsRequest();
-    describeStackEventsReq.SetStackName(ToAwsString(m_stackName));
-
-    auto futureOutcome = m_cfClient->DescribeStackEventsCallable(describeStackEventsReq);
-    futureOutcome.wait();
-
-    auto describeStackOutcome = futureOutcome.get();
-    auto resourceStatus = CfnModel::ResourceStatusMapper::GetNameForResourceStatus(CfnModel::ResourceStatus::NOT_SET);
-    auto events = describeStackOutcome.GetResult().GetStackEvents();
-    if (events.size() > 0)
-    {
-        auto event = events.at(0);
-        resourceStatus = CfnModel::ResourceStatusMapper::GetNameForResourceStatus(event.GetResourceStatus());
-        Aws::String resourceId = event.GetLogicalResourceId();
-
-        if (!m_resouceStatusMap[ToStdString(resourceId)])
-        {
-            m_resouceStatusMap[ToStdString(resourceId)] = true;
-            char buffer[1024] = "";
-            snprintf(buffer, 1024, "%s: %s | %s: %s", m_stackName.c_str(), resourceId.c_str(), resourceStatus.c_str(), event.GetResourceStatusReason().c_str());
-            Logging::Log(m_logCb, Level::Info, buffer, this);
-        }
-    }
+    // The shared watcher polls the stack, this thread only waits for the final status
+    return StackWatcher::GetInstance().Watch(m_cfClient, m_stackName, m_logCb, this).get();
 }
 
 unsigned int GameKitFeatureResources::getDeployedTemplateBody(const std::string& stackName, std::string& templateBody) const
@@ -1581,22 +1820,6 @@ unsigned int GameKitFeatureResources::getDeployedTemplateBody(const std::string&
 }
 
 
-bool GameKitFeatureResources::isTerminalState(CfnModel::StackStatus status)
-{
-    return status == CfnModel::StackStatus::CREATE_FAILED ||
-        status == CfnModel::StackStatus::CREATE_COMPLETE ||
-        status == CfnModel::StackStatus::ROLLBACK_FAILED ||
-        status == CfnModel::StackStatus::ROLLBACK_COMPLETE ||
-        status == CfnModel::StackStatus::DELETE_FAILED ||
-        status == CfnModel::StackStatus::DELETE_COMPLETE ||
-        status == CfnModel::StackStatus::UPDATE_COMPLETE ||
-        status == CfnModel::StackStatus::UPDATE_ROLLBACK_FAILED ||
-        status == CfnModel::StackStatus::UPDATE_ROLLBACK_COMPLETE ||
-        status == CfnModel::StackStatus::IMPORT_COMPLETE ||
-        status == CfnModel::StackStatus::IMPORT_ROLLBACK_FAILED ||
-        status == CfnModel::StackStatus::IMPORT_ROLLBACK_COMPLETE;
-}
-
 bool GameKitFeatureResources::isFailedState(CfnModel::StackStatus status)
 {
     return status == CfnModel::StackStatus::CREATE_FAILED ||
@@ -1648,6 +1871,7 @@ unsigned int GameKitFeatureResources::writeCloudFormationParameterInstance(const
     std::string logMsg;
     boost::filesystem::create_directories(m_instanceCloudformationPath);
     const auto writeResult = GameKit::Utils::FileUtils::WriteStringToFile(cfParams, m_instanceCloudformationPath + TemplateFileNames::PARAMETERS_FILE, m_logCb);
+    GameKit::Utils::TemplateUtils::InvalidateTemplate(m_instanceCloudformationPath + TemplateFileNames::PARAMETERS_FILE);
     if (writeResult != GAMEKIT_SUCCESS)
     {
         logMsg = std::string("Failed to saved parameters file to ").append(m_instanceCloudformationPath);
@@ -1666,6 +1890,7 @@ unsigned int GameKitFeatureResources::writeCloudFormationTemplateInstance(const
     std::string logMsg;
     boost::filesystem::create_directories(m_instanceCloudformationPath);
     const auto writeResult = GameKit::Utils::FileUtils::WriteStringToFile(cfTemplate, m_instanceCloudformationPath + TemplateFileNames::CLOUDFORMATION_FILE, m_logCb);
+    GameKit::Utils::TemplateUtils::InvalidateTemplate(m_instanceCloudformationPath + TemplateFileNames::CLOUDFORMATION_FILE);
     if (writeResult != GAMEKIT_SUCCESS)
     {
         logMsg = std::string("Failed to saved CloudFormation file to ").append(m_instanceCloudformationPath);
@@ -1684,6 +1909,7 @@ unsigned int GameKitFeatureResources::writeCloudFormationDashboardInstance(const
     std::string logMsg;
     boost::filesystem::create_directories(m_instanceCloudformationPath);
     auto writeResult = GameKit::Utils::FileUtils::WriteStringToFile(cfDashboard, m_instanceCloudformationPath + TemplateFileNames::FEATURE_DASHBOARD_FILE, m_logCb);
+    GameKit::Utils::TemplateUtils::InvalidateTemplate(m_instanceCloudformationPath + TemplateFileNames::FEATURE_DASHBOARD_FILE);
     if (writeResult != GAMEKIT_SUCCESS)
     {
         logMsg = std::string("Failed to saved CloudFormation Dashboard file to ").append(m_instanceCloudformationPath);
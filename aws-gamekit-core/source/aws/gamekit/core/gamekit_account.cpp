@@ -1,10 +1,12 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <aws/gamekit/core/feature_deployment_scheduler.h>
 #include <aws/gamekit/core/gamekit_account.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
 
 using namespace GameKit;
 using namespace GameKit::Logger;
@@ -16,6 +18,13 @@ namespace SecretsModel = Aws::SecretsManager::Model;
 namespace ApiGwyModel = Aws::APIGateway::Model;
 namespace fs = boost::filesystem;
 
+namespace
+{
+    // Maximum number of features whose artifacts are uploaded at the same time. Each feature also uploads several of its artifacts
+    // at the same time, this keeps the total number of concurrent requests under the default connection limit of the AWS clients.
+    static const size_t MAX_CONCURRENT_FEATURE_TASKS = 3;
+}
+
 #pragma region Constructor/Desctructor
 GameKitAccount::GameKitAccount(const AccountInfo& accountInfo, const AccountCredentials& credentials, FuncLogCallback logCallback)
 {
@@ -197,15 +206,15 @@ unsigned int GameKitAccount::SaveSecret(const std::string& secretName, const std
 {
     std::string const secretId = this->composeSecretId(secretName);
 
-    // check if secret exists
-    auto const checkSecretOutcome = CheckSecretExists(secretName);
-
-    if (checkSecretOutcome == GAMEKIT_WARNING_SECRETSMANAGER_SECRET_NOT_FOUND)
+    // update the secret in a single call, it only needs to be created the first time it is saved
+    bool secretNotFound = false;
+    const unsigned int updateResult = this->updateSecret(secretId, secretValue, secretNotFound);
+    if (secretNotFound)
     {
         return this->createSecret(secretId, secretValue);
     }
 
-    return this->updateSecret(secretId, secretValue);
+    return updateResult;
 }
 
 unsigned int GameKitAccount::DeleteSecret(const std::string& secretName)
@@ -278,40 +287,12 @@ unsigned int GameKit::GameKitAccount::UploadDashboards()
         return GAMEKIT_ERROR_CLOUDFORMATION_PATH_NOT_FOUND;
     }
 
-    // loop through the feature directories
-    fs::path p(m_instanceCloudformationPath);
-    fs::directory_iterator end_iter;
-    for (fs::directory_iterator iter(p); iter != end_iter; ++iter)
+    // upload the dashboard of every feature
+    return forEachFeatureDirectory(m_instanceCloudformationPath, [this](const std::string& featureName, const std::string& featureDirectory)
     {
-        // get feature name from directory
-        const fs::path cp = (*iter);
-        std::string featureName = cp.stem().string();
-
-        // instantiate a feature resource
-        Aws::UniquePtr<GameKitFeatureResources> featureResources = Aws::MakeUnique<GameKitFeatureResources>(
-            featureName.c_str(),
-            m_accountInfo,
-            m_credentials,
-            GameKit::GetFeatureTypeFromString(featureName),
-            m_logCb);
-
-        // set base and instance paths
-        featureResources->SetPluginRoot(m_pluginRoot);
-        featureResources->SetGameKitRoot(m_gamekitRoot);
-
-        // set AWS clients and bucket
-        featureResources->SetS3Client(m_s3Client, true);
-        featureResources->SetSSMClient(m_ssmClient, true);
-
-        // upload feature dashboard
-        auto uploadResult = featureResources->UploadDashboard(cp.string());
-        if (uploadResult != GAMEKIT_SUCCESS)
-        {
-            return uploadResult;
-        }
-    }
-
-    return GAMEKIT_SUCCESS;
+        Aws::UniquePtr<GameKitFeatureResources> featureResources = createFeatureResources(featureName);
+        return featureResources->UploadDashboard(featureDirectory);
+    });
 }
 
 unsigned int GameKit::GameKitAccount::UploadLayers()
@@ -321,53 +302,12 @@ unsigned int GameKit::GameKitAccount::UploadLayers()
         return GAMEKIT_ERROR_LAYERS_PATH_NOT_FOUND;
     }
 
-    // loop through the feature directories
-    fs::path p(m_instanceLayersPath);
-    fs::directory_iterator end_iter;
-    for (fs::directory_iterator iter(p); iter != end_iter; ++iter)
+    // compress and upload the layers of every feature
+    return forEachFeatureDirectory(m_instanceLayersPath, [this](const std::string& featureName, const std::string&)
     {
-        // get feature name from directory
-        const fs::path cp = (*iter);
-        std::string featureName = cp.stem().string();
-
-        // instantiate a feature resource
-        Aws::UniquePtr<GameKitFeatureResources> featureResources = Aws::MakeUnique<GameKitFeatureResources>(
-            featureName.c_str(),
-            m_accountInfo,
-            m_credentials,
-            GameKit::GetFeatureTypeFromString(featureName),
-            m_logCb);
-
-        // set base and instance paths
-        featureResources->SetPluginRoot(m_pluginRoot);
-        featureResources->SetGameKitRoot(m_gamekitRoot);
-
-        // set AWS clients and bucket
-        featureResources->SetS3Client(m_s3Client, true);
-        featureResources->SetSSMClient(m_ssmClient, true);
-
-        // create/set replacement id
-        featureResources->CreateAndSetLayersReplacementId();
-
-        // compress feature functions
-        auto compressResult = featureResources->CompressFeatureLayers();
-        if (compressResult != GAMEKIT_SUCCESS)
-        {
-            return compressResult;
-        }
-
-        // upload feature layers
-        auto uploadResult = featureResources->UploadFeatureLayers();
-        if (uploadResult != GAMEKIT_SUCCESS)
-        {
-            return uploadResult;
-        }
-
-        // cleanup
-        featureResources->CleanupTempFiles();
-    }
-
-    return GAMEKIT_SUCCESS;
+        Aws::UniquePtr<GameKitFeatureResources> featureResources = createFeatureResources(featureName);
+        return featureResources->DeployFeatureLayers();
+    });
 }
 
 unsigned int GameKitAccount::UploadFunctions()
@@ -377,53 +317,12 @@ unsigned int GameKitAccount::UploadFunctions()
         return GAMEKIT_ERROR_FUNCTIONS_PATH_NOT_FOUND;
     }
 
-    // loop through the feature directories
-    fs::path p(m_instanceFunctionsPath);
-    fs::directory_iterator end_iter;
-    for (fs::directory_iterator iter(p); iter != end_iter; ++iter)
+    // compress and upload the functions of every feature
+    return forEachFeatureDirectory(m_instanceFunctionsPath, [this](const std::string& featureName, const std::string&)
     {
-        // get feature name from directory
-        const fs::path cp = (*iter);
-        std::string featureName = cp.stem().string();
-
-        // instantiate a feature resource
-        Aws::UniquePtr<GameKitFeatureResources> featureResources = Aws::MakeUnique<GameKitFeatureResources>(
-            featureName.c_str(),
-            m_accountInfo,
-            m_credentials,
-            GameKit::GetFeatureTypeFromString(featureName),
-            m_logCb);
-
-        // set base and instance paths
-        featureResources->SetPluginRoot(m_pluginRoot);
-        featureResources->SetGameKitRoot(m_gamekitRoot);
-
-        // set AWS clients and bucket
-        featureResources->SetS3Client(m_s3Client, true);
-        featureResources->SetSSMClient(m_ssmClient, true);
-
-        // create/set replacement id
-        featureResources->CreateAndSetFunctionsReplacementId();
-
-        // compress feature functions
-        auto compressResult = featureResources->CompressFeatureFunctions();
-        if (compressResult != GAMEKIT_SUCCESS)
-        {
-            return compressResult;
-        }
-
-        // upload feature functions
-        auto uploadResult = featureResources->UploadFeatureFunctions();
-        if (uploadResult != GAMEKIT_SUCCESS)
-        {
-            return uploadResult;
-        }
-
-        // cleanup
-        featureResources->CleanupTempFiles();
-    }
-
-    return GAMEKIT_SUCCESS;
+        Aws::UniquePtr<GameKitFeatureResources> featureResources = createFeatureResources(featureName);
+        return featureResources->DeployFeatureFunctions();
+    });
 }
 
 bool GameKitAccount::HasValidCredentials()
@@ -625,16 +524,18 @@ unsigned int GameKitAccount::CreateOrUpdateFeatureStacks()
         return GAMEKIT_ERROR_FUNCTIONS_PATH_NOT_FOUND;
     }
 
-    auto result = GAMEKIT_SUCCESS;
+    std::unordered_map<FeatureType, std::shared_ptr<GameKitFeatureResources>> featureResourcesMap;
+    std::unordered_set<FeatureType> features;
     fs::path p(m_instanceCloudformationPath);
     fs::directory_iterator end_iter;
     for (fs::directory_iterator iter(p); iter != end_iter; ++iter)
     {
         const fs::path cp = (*iter);
         std::string featureName = cp.stem().string();
+        const FeatureType featureType = GameKit::GetFeatureTypeFromString(featureName);
 
         // skip main stack
-        if (featureName == GameKit::GetFeatureTypeString(FeatureType::Main))
+        if (featureType == FeatureType::Main)
         {
             continue;
         }
@@ -643,7 +544,7 @@ unsigned int GameKitAccount::CreateOrUpdateFeatureStacks()
             featureName.c_str(),
             m_accountInfo,
             m_credentials,
-            GameKit::GetFeatureTypeFromString(featureName),
+            featureType,
             m_logCb);
 
         // set paths
@@ -652,16 +553,16 @@ unsigned int GameKitAccount::CreateOrUpdateFeatureStacks()
         featureResources->SetPluginRoot(m_pluginRoot);
         featureResources->SetGameKitRoot(m_gamekitRoot);
 
-        // create/update feature stacks
-        result = featureResources->CreateOrUpdateFeatureStack();
-
-        if (result != GAMEKIT_SUCCESS)
-        {
-            break;
-        }
+        featureResourcesMap[featureType] = featureResources;
+        features.insert(featureType);
     }
 
-    return result;
+    // create/update feature stacks, independent stacks are created/updated concurrently
+    std::unordered_map<FeatureType, unsigned int> featureResults;
+    return FeatureDeploymentScheduler::DeployInDependencyOrder(features, FEATURE_DEPENDENCIES, [&featureResourcesMap](FeatureType featureType)
+    {
+        return featureResourcesMap.at(featureType)->CreateOrUpdateFeatureStack();
+    }, featureResults);
 }
 
 unsigned int GameKitAccount::createSecret(const std::string& secretId, const std::string& secretValue)
@@ -680,15 +581,22 @@ unsigned int GameKitAccount::createSecret(const std::string& secretId, const std
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int GameKitAccount::updateSecret(const std::string& secretId, const std::string& secretValue)
+unsigned int GameKitAccount::updateSecret(const std::string& secretId, const std::string& secretValue, bool& returnedSecretNotFound)
 {
     SecretsModel::UpdateSecretRequest updateRequest;
     updateRequest.SetSecretId(secretId.c_str());
     updateRequest.SetSecretString(secretValue.c_str());
     auto upddateOutcome = m_secretsClient->UpdateSecret(updateRequest);
 
+    returnedSecretNotFound = false;
     if (!upddateOutcome.IsSuccess())
     {
+        if (upddateOutcome.GetError().GetErrorType() == Aws::SecretsManager::SecretsManagerErrors::RESOURCE_NOT_FOUND)
+        {
+            returnedSecretNotFound = true;
+            return GAMEKIT_WARNING_SECRETSMANAGER_SECRET_NOT_FOUND;
+        }
+
         Logging::Log(m_logCb, Level::Error, upddateOutcome.GetError().GetMessage().c_str());
         return GAMEKIT_ERROR_SECRETSMANAGER_WRITE_FAILED;
     }
@@ -720,4 +628,45 @@ std::string GameKitAccount::getShortRegionCode()
     AwsRegionMappings& regionMappings = AwsRegionMappings::getInstance(GetPluginRoot(), m_logCb);
     return regionMappings.getFiveLetterRegionCode(std::string(m_credentials.region));
 }
+
+unsigned int GameKitAccount::forEachFeatureDirectory(const std::string& featuresPath, const std::function<unsigned int(const std::string& featureName, const std::string& featureDirectory)>& featureTask) const
+{
+    std::vector<std::function<unsigned int()>> tasks;
+    fs::path p(featuresPath);
+    fs::directory_iterator end_iter;
+    for (fs::directory_iterator iter(p); iter != end_iter; ++iter)
+    {
+        // get feature name from directory
+        const fs::path cp = (*iter);
+        const std::string featureName = cp.stem().string();
+        const std::string featureDirectory = cp.string();
+        tasks.push_back([&featureTask, featureName, featureDirectory]()
+        {
+            return featureTask(featureName, featureDirectory);
+        });
+    }
+
+    // features share the account's AWS clients, which are safe to use concurrently
+    return GameKit::Utils::ParallelUtils::RunTasks(tasks, MAX_CONCURRENT_FEATURE_TASKS);
+}
+
+Aws::UniquePtr<GameKitFeatureResources> GameKitAccount::createFeatureResources(const std::string& featureName) const
+{
+    Aws::UniquePtr<GameKitFeatureResources> featureResources = Aws::MakeUnique<GameKitFeatureResources>(
+        featureName.c_str(),
+        m_accountInfo,
+        m_credentials,
+        GameKit::GetFeatureTypeFromString(featureName),
+        m_logCb);
+
+    // set base and instance paths
+    featureResources->SetPluginRoot(m_pluginRoot);
+    featureResources->SetGameKitRoot(m_gamekitRoot);
+
+    // set AWS clients and bucket
+    featureResources->SetS3Client(m_s3Client, true);
+    featureResources->SetSSMClient(m_ssmClient, true);
+
+    return featureResources;
+}
 #pragma endregion
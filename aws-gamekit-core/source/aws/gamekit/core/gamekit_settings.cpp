@@ -1,6 +1,15 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+// GameKit
 #include <aws/gamekit/core/gamekit_settings.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
@@ -11,6 +20,287 @@ using namespace Logger;
 using namespace Aws::Auth;
 using namespace Aws::Config;
 
+namespace
+{
+    // Saves of a settings file that follow its last write closer than this are coalesced into a single write
+    static const std::chrono::milliseconds SETTINGS_WRITE_DEBOUNCE(250);
+
+    static const std::string SETTINGS_LOG_PREFIX = "Plugin settings: ";
+
+    struct CachedSettings
+    {
+        // Published settings are never modified, instances clone them before making changes
+        YAML::Node Settings;
+        bool Loaded = false;
+
+        // Size and content hash of the file when Settings were loaded from it or written to it. Unlike last write times,
+        // which have a one second resolution, they also tell apart external edits made within the same second.
+        uintmax_t FileSize = 0;
+        size_t ContentHash = 0;
+
+        // Settings are pending a write while the saved version is ahead of the written version
+        uint64_t SavedVersion = 0;
+        uint64_t WrittenVersion = 0;
+        std::chrono::steady_clock::time_point LastWrite;
+        FuncLogCallback LogCb = nullptr;
+
+        // Failed writes stay pending, the background writer leaves them to the next save or flush, which report the failure
+        bool WriteFailed = false;
+
+        bool IsWritePending() const { return SavedVersion != WrittenVersion; }
+    };
+
+    /**
+     * Process-wide cache of parsed settings files, keyed by file path, with a background writer for debounced saves.
+     * Pending saves outlive the instances that made them, so saves from short-lived instances are coalesced too.
+     */
+    class SettingsCache
+    {
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_writesChanged;
+        std::unordered_map<std::string, CachedSettings> m_files; // Guarded by m_mutex
+        std::thread m_writer; // Guarded by m_mutex
+        bool m_writerRunning = false; // Guarded by m_mutex
+        bool m_stopping = false; // Guarded by m_mutex
+
+        // Serializes file writes, so an older version can never overwrite a newer one
+        std::mutex m_writeMutex;
+
+        // Reading a settings file is cheap compared to parsing it
+        static bool fingerprintFile(const std::string& filePath, uintmax_t& fileSize, size_t& contentHash)
+        {
+            std::string contents;
+            if (Utils::FileUtils::ReadFileIntoString(filePath, contents) != GAMEKIT_SUCCESS)
+            {
+                return false;
+            }
+
+            fileSize = contents.size();
+            contentHash = std::hash<std::string>()(contents);
+            return true;
+        }
+
+        void writePendingSettings()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_stopping)
+            {
+                auto nextWrite = std::chrono::steady_clock::time_point::max();
+                std::string dueFile;
+                for (const auto& file : m_files)
+                {
+                    if (file.second.IsWritePending() && !file.second.WriteFailed)
+                    {
+                        const auto writeTime = file.second.LastWrite + SETTINGS_WRITE_DEBOUNCE;
+                        if (writeTime < nextWrite)
+                        {
+                            nextWrite = writeTime;
+                            dueFile = file.first;
+                        }
+                    }
+                }
+
+                if (dueFile.empty())
+                {
+                    break;
+                }
+
+                if (nextWrite > std::chrono::steady_clock::now())
+                {
+                    // Woken up early by new saves and by the cache shutting down
+                    m_writesChanged.wait_until(lock, nextWrite);
+                    continue;
+                }
+
+                lock.unlock();
+                Write(dueFile);
+                lock.lock();
+            }
+
+            m_writerRunning = false;
+        }
+
+    public:
+        ~SettingsCache()
+        {
+            // The writer is stopped by Shutdown(), joining it from a static destructor can deadlock under the Windows loader lock
+            assert(!m_writer.joinable());
+        }
+
+        // Stops the background writer and writes every pending save. Returns the result of the last failed write, if any.
+        unsigned int Shutdown()
+        {
+            std::thread writer;
+            std::vector<std::string> pendingFiles;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+                writer = std::move(m_writer);
+                for (const auto& file : m_files)
+                {
+                    if (file.second.IsWritePending())
+                    {
+                        pendingFiles.push_back(file.first);
+                    }
+                }
+            }
+
+            m_writesChanged.notify_all();
+            if (writer.joinable())
+            {
+                writer.join();
+            }
+
+            unsigned int result = GAMEKIT_SUCCESS;
+            for (const std::string& filePath : pendingFiles)
+            {
+                const unsigned int writeResult = Write(filePath);
+                if (writeResult != GAMEKIT_SUCCESS)
+                {
+                    result = writeResult;
+                }
+            }
+
+            // Later saves start a new writer
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = false;
+            return result;
+        }
+
+        unsigned int Load(const std::string& filePath, YAML::Node& returnedSettings, FuncLogCallback logCb)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            CachedSettings& cached = m_files[filePath];
+
+            // Saved settings are newer than the file until they are written
+            if (cached.IsWritePending())
+            {
+                returnedSettings.reset(cached.Settings);
+                return GAMEKIT_SUCCESS;
+            }
+
+            uintmax_t fileSize;
+            size_t contentHash;
+            if (!fingerprintFile(filePath, fileSize, contentHash))
+            {
+                // The file was deleted or never existed, the next save is written immediately
+                m_files.erase(filePath);
+                returnedSettings.reset(YAML::Node());
+                return GAMEKIT_ERROR_SETTINGS_MISSING;
+            }
+
+            if (cached.Loaded && cached.FileSize == fileSize && cached.ContentHash == contentHash)
+            {
+                returnedSettings.reset(cached.Settings);
+                return GAMEKIT_SUCCESS;
+            }
+
+            YAML::Node loaded;
+            const unsigned int result = Utils::FileUtils::ReadFileAsYAML(filePath, loaded, logCb, SETTINGS_LOG_PREFIX);
+            if (result != GAMEKIT_SUCCESS)
+            {
+                cached.Loaded = false;
+                return result;
+            }
+
+            cached.Settings.reset(loaded);
+            cached.Loaded = true;
+            cached.FileSize = fileSize;
+            cached.ContentHash = contentHash;
+            returnedSettings.reset(cached.Settings);
+            return GAMEKIT_SUCCESS;
+        }
+
+        unsigned int Save(const std::string& filePath, const YAML::Node& settings, FuncLogCallback logCb)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                CachedSettings& cached = m_files[filePath];
+
+                // After a failed write, save synchronously so the write is retried and its result returned to this caller
+                const bool writeNow = cached.WriteFailed ||
+                    (!cached.IsWritePending() && std::chrono::steady_clock::now() - cached.LastWrite >= SETTINGS_WRITE_DEBOUNCE);
+
+                cached.Settings.reset(settings);
+                cached.Loaded = true;
+                cached.LogCb = logCb;
+                ++cached.SavedVersion;
+
+                if (!writeNow)
+                {
+                    if (!m_writerRunning && !m_stopping)
+                    {
+                        // A writer that ran out of saves has already released the lock for good, joining it can't deadlock
+                        if (m_writer.joinable())
+                        {
+                            m_writer.join();
+                        }
+
+                        m_writer = std::thread(&SettingsCache::writePendingSettings, this);
+                        m_writerRunning = true;
+                    }
+
+                    m_writesChanged.notify_one();
+                    return GAMEKIT_SUCCESS;
+                }
+            }
+
+            return Write(filePath);
+        }
+
+        unsigned int Write(const std::string& filePath)
+        {
+            std::lock_guard<std::mutex> writeLock(m_writeMutex);
+
+            YAML::Node settings;
+            uint64_t version;
+            FuncLogCallback logCb;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const auto cached = m_files.find(filePath);
+                if (cached == m_files.end() || !cached->second.IsWritePending())
+                {
+                    return GAMEKIT_SUCCESS;
+                }
+
+                settings.reset(cached->second.Settings);
+                version = cached->second.SavedVersion;
+                logCb = cached->second.LogCb;
+            }
+
+            const unsigned int result = Utils::FileUtils::WriteYAMLToFile(settings, filePath, Configuration::DO_NOT_EDIT, logCb, SETTINGS_LOG_PREFIX);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            CachedSettings& cached = m_files[filePath];
+            cached.LastWrite = std::chrono::steady_clock::now();
+
+            // WriteYAMLToFile has already logged the error, the settings stay cached and pending
+            cached.WriteFailed = result != GAMEKIT_SUCCESS;
+            if (cached.WriteFailed)
+            {
+                return result;
+            }
+
+            cached.WrittenVersion = version;
+            if (!fingerprintFile(filePath, cached.FileSize, cached.ContentHash))
+            {
+                // Reparse whatever is on disk on the next load
+                cached.Loaded = cached.IsWritePending();
+            }
+
+            return result;
+        }
+    };
+
+    SettingsCache& getSettingsCache()
+    {
+        // Intentionally leaked, AwsApiInitializer::Shutdown() stops the writer through GameKitSettings::Shutdown()
+        static SettingsCache* settingsCache = new SettingsCache();
+        return *settingsCache;
+    }
+}
+
 #pragma region Public Methods
 GameKitSettings::GameKitSettings(const std::string& gamekitRoot, const std::string& pluginVersion, const std::string& shortGameName, const std::string& currentEnvironment, FuncLogCallback logCallback) :
     m_gamekitRootPath(gamekitRoot), m_gamekitPluginVersion(pluginVersion), m_shortGameName(shortGameName), m_currentEnvironment(currentEnvironment), m_logCb(logCallback)
@@ -38,9 +328,9 @@ GameKitSettings::GameKitSettings(const std::string& gamekitRoot, const std::stri
 
     // For the settings file, "not found" is a warning and not an error, because it never exists on the first run.
     std::string gamekitSettingsFile = GetSettingsFilePath();
-    if (boost::filesystem::exists(gamekitSettingsFile))
+    const unsigned int returnCode = getSettingsCache().Load(gamekitSettingsFile, m_gamekitYamlSettings, m_logCb);
+    if (returnCode != GAMEKIT_ERROR_SETTINGS_MISSING)
     {
-        const unsigned int returnCode = Utils::FileUtils::ReadFileAsYAML(gamekitSettingsFile, m_gamekitYamlSettings, m_logCb, "Plugin settings: ");
         if (returnCode == GAMEKIT_SUCCESS)
         {
             std::string msg = std::string("Plugin settings file loaded from ").append(gamekitSettingsFile);
@@ -62,42 +352,42 @@ GameKitSettings::~GameKitSettings()
 
 void GameKitSettings::SetGameName(const std::string& gameName)
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_GAME_KEY][GAMEKIT_SETTINGS_GAME_NAME] = gameName;
+    writableSettings()[GAMEKIT_SETTINGS_GAME_KEY][GAMEKIT_SETTINGS_GAME_NAME] = gameName;
 }
 
 void GameKitSettings::SetLastUsedRegion(const std::string& region)
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_LAST_USED_REGION] = region;
+    writableSettings()[GAMEKIT_SETTINGS_LAST_USED_REGION] = region;
 }
 
 void GameKitSettings::SetLastUsedEnvironment(const std::string& envCode)
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_LAST_USED_ENVIRONMENT][GAMEKIT_SETTINGS_LAST_USED_ENVIRONMENT_CODE] = envCode;
+    writableSettings()[GAMEKIT_SETTINGS_LAST_USED_ENVIRONMENT][GAMEKIT_SETTINGS_LAST_USED_ENVIRONMENT_CODE] = envCode;
 }
 
 void GameKitSettings::AddCustomEnvironment(const std::string& envCode, const std::string& envDescription)
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_ENVIRONMENTS_KEY][envCode][GAMEKIT_SETTINGS_ENVIRONMENT_DESCRIPTION] = envDescription;
+    writableSettings()[GAMEKIT_SETTINGS_ENVIRONMENTS_KEY][envCode][GAMEKIT_SETTINGS_ENVIRONMENT_DESCRIPTION] = envDescription;
 }
 
 void GameKitSettings::DeleteCustomEnvironment(const std::string& envCode)
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_ENVIRONMENTS_KEY].remove(envCode);
+    writableSettings()[GAMEKIT_SETTINGS_ENVIRONMENTS_KEY].remove(envCode);
 }
 
 void GameKitSettings::ActivateFeature(FeatureType featureType)
 {
-    m_gamekitYamlSettings[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_ACTIVE] = true;
+    writableSettings()[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_ACTIVE] = true;
 }
 
 void GameKitSettings::DeactivateFeature(FeatureType featureType)
 {
-    m_gamekitYamlSettings[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_ACTIVE] = false;
+    writableSettings()[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_ACTIVE] = false;
 }
 
 void GameKitSettings::SetFeatureVariables(FeatureType featureType, const std::map<std::string, std::string>& vars)
 {
-    YAML::Node featureVars = m_gamekitYamlSettings[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_VARS];
+    YAML::Node featureVars = writableSettings()[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_VARS];
     for (auto const& entry : vars)
     {
         featureVars[entry.first] = entry.second;
@@ -106,15 +396,18 @@ void GameKitSettings::SetFeatureVariables(FeatureType featureType, const std::ma
 
 void GameKitSettings::DeleteFeatureVariable(FeatureType featureType, std::string varName)
 {
-    m_gamekitYamlSettings[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_VARS].remove(varName);
+    writableSettings()[this->m_currentEnvironment][GAMEKIT_SETTINGS_FEATURES_KEY][GameKit::GetFeatureTypeString(featureType)][GAMEKIT_SETTINGS_FEATURE_VARS].remove(varName);
 }
 
 unsigned int GameKitSettings::SaveSettings()
 {
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_GAME_KEY][GAMEKIT_SETTINGS_SHORT_GAME_NAME] = m_shortGameName;
-    m_gamekitYamlSettings[GAMEKIT_SETTINGS_VERSION_KEY] = m_gamekitPluginVersion;
+    YAML::Node& settings = writableSettings();
+    settings[GAMEKIT_SETTINGS_GAME_KEY][GAMEKIT_SETTINGS_SHORT_GAME_NAME] = m_shortGameName;
+    settings[GAMEKIT_SETTINGS_VERSION_KEY] = m_gamekitPluginVersion;
 
-    const unsigned int resultCode = Utils::FileUtils::WriteYAMLToFile(m_gamekitYamlSettings, GetSettingsFilePath(), Configuration::DO_NOT_EDIT, m_logCb, "Plugin settings: ");
+    // The saved settings are shared from now on, the next modification works on a copy
+    const unsigned int resultCode = getSettingsCache().Save(GetSettingsFilePath(), settings, m_logCb);
+    m_ownsSettings = false;
     if (resultCode != GAMEKIT_SUCCESS)
     {
         return GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED;
@@ -241,17 +534,38 @@ std::string GameKitSettings::GetFeatureVariable(FeatureType featureType, std::st
 
 void GameKitSettings::Reload()
 {
+    // Write pending saves first, so the reloaded settings are the ones on disk
+    getSettingsCache().Write(GetSettingsFilePath());
+
     YAML::Node reloaded;
-    const unsigned int result = Utils::FileUtils::ReadFileAsYAML(GetSettingsFilePath(), reloaded, m_logCb, "Plugin settings: ");
+    const unsigned int result = getSettingsCache().Load(GetSettingsFilePath(), reloaded, m_logCb);
     if (result == GAMEKIT_SUCCESS)
     {
         m_gamekitYamlSettings.reset(reloaded);
+        m_ownsSettings = false;
         std::string msg = std::string("Reloaded plugin settings from ").append(this->GetSettingsFilePath());
         Logging::Log(m_logCb, Level::Warning, msg.c_str());
     }
+    else if (result == GAMEKIT_ERROR_SETTINGS_MISSING)
+    {
+        std::string msg = SETTINGS_LOG_PREFIX + "Failed to open file for reading " + this->GetSettingsFilePath();
+        Logging::Log(m_logCb, Level::Error, msg.c_str());
+    }
     // else ReadFileAsYAML has already logged the error
 }
 
+unsigned int GameKitSettings::FlushSettings()
+{
+    const unsigned int result = getSettingsCache().Write(GetSettingsFilePath());
+    return result == GAMEKIT_SUCCESS ? GAMEKIT_SUCCESS : GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED;
+}
+
+unsigned int GameKitSettings::Shutdown()
+{
+    const unsigned int result = getSettingsCache().Shutdown();
+    return result == GAMEKIT_SUCCESS ? GAMEKIT_SUCCESS : GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED;
+}
+
 std::string GameKitSettings::GetSettingsFilePath() const
 {
     return m_gamekitRootPath + "/" + m_shortGameName + "/" + GAMEKIT_SETTINGS_FILE;
@@ -437,3 +751,16 @@ unsigned int GameKitSettings::persistAwsProfiles(AWSConfigFileProfileConfigLoade
     return GAMEKIT_SUCCESS;
 }
 #pragma endregion
+
+#pragma region Private Methods
+YAML::Node& GameKitSettings::writableSettings()
+{
+    if (!m_ownsSettings)
+    {
+        m_gamekitYamlSettings.reset(YAML::Clone(m_gamekitYamlSettings));
+        m_ownsSettings = true;
+    }
+
+    return m_gamekitYamlSettings;
+}
+#pragma endregion
@@ -1,6 +1,17 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+// GameKit
 #include <aws/gamekit/core/logging.h>
 
 using namespace GameKit::Logger;
@@ -8,26 +19,408 @@ using namespace GameKit::Logger;
 #define CONTEXT_MARK_START "["
 #define CONTEXT_MARK_END "]~ "
 
+namespace
+{
+    // Messages that don't fit with their prefix are copied to the heap instead
+    static const size_t LOG_BUFFER_SIZE = 2048;
+
+    // Number of records the async queue holds before dropping new ones. Must be a power of two.
+    static const size_t ASYNC_LOG_CAPACITY = 2048;
+
+    // Queued messages up to this size, prefix included, are copied without allocating
+    static const size_t ASYNC_LOG_RESERVED_SIZE = 512;
+
+    static const std::chrono::milliseconds ASYNC_LOG_DELIVERY_INTERVAL(20);
+
+    std::atomic<unsigned int>& getMinimumLevel()
+    {
+        static std::atomic<unsigned int> minimumLevel((unsigned int)Level::None);
+        return minimumLevel;
+    }
+
+    std::atomic<int>& getDeliveryMode()
+    {
+        static std::atomic<int> deliveryMode((int)DeliveryMode::Synchronous);
+        return deliveryMode;
+    }
+
+    std::atomic<unsigned long long>& getDroppedCount()
+    {
+        static std::atomic<unsigned long long> droppedCount(0);
+        return droppedCount;
+    }
+
+    // Bounded multi-producer queue of log records. Producers never lock: each slot carries a sequence number telling
+    // whether it is free for the producer that claimed its position, or filled and ready for the consumer.
+    // Draining is serialized, so the background thread and GameKitFlushLogs() can both consume.
+    class AsyncLogQueue
+    {
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> Sequence;
+            FuncLogCallback Callback = nullptr;
+            Level LogLevel = Level::None;
+            std::string Message;
+        };
+
+        std::vector<Slot> m_slots;
+        alignas(64) std::atomic<size_t> m_enqueuePosition{ 0 };
+        alignas(64) size_t m_dequeuePosition = 0; // Guarded by m_drainMutex
+        std::mutex m_drainMutex;
+
+    public:
+        AsyncLogQueue() : m_slots(ASYNC_LOG_CAPACITY)
+        {
+            for (size_t i = 0; i < m_slots.size(); ++i)
+            {
+                m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+                m_slots[i].Message.reserve(ASYNC_LOG_RESERVED_SIZE);
+            }
+        }
+
+        bool TryPush(FuncLogCallback cb, Level level, const char* message, size_t size)
+        {
+            size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot& slot = m_slots[position & (ASYNC_LOG_CAPACITY - 1)];
+                const size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        slot.Callback = cb;
+                        slot.LogLevel = level;
+                        slot.Message.assign(message, size);
+                        slot.Sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // The consumer hasn't delivered the record written one lap ago, the queue is full
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        unsigned int Drain()
+        {
+            // A callback that flushes would wait on the lock its own thread holds, its records are delivered by the outer drain
+            thread_local bool draining = false;
+            if (draining)
+            {
+                return 0;
+            }
+
+            std::lock_guard<std::mutex> lock(m_drainMutex);
+            draining = true;
+            unsigned int delivered = 0;
+            for (;;)
+            {
+                Slot& slot = m_slots[m_dequeuePosition & (ASYNC_LOG_CAPACITY - 1)];
+                if (slot.Sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+                {
+                    draining = false;
+                    return delivered;
+                }
+
+                // The message string keeps its capacity so the slot can be refilled without allocating
+                slot.Callback((unsigned int)slot.LogLevel, slot.Message.c_str(), (int)slot.Message.size());
+                slot.Sequence.store(m_dequeuePosition + ASYNC_LOG_CAPACITY, std::memory_order_release);
+                ++m_dequeuePosition;
+                ++delivered;
+            }
+        }
+    };
+
+    class AsyncLogSink
+    {
+    private:
+        AsyncLogQueue m_queue;
+
+        std::mutex m_consumerMutex;
+        std::thread m_consumer; // Guarded by m_consumerMutex
+
+        std::mutex m_stopMutex;
+        std::condition_variable m_stopRequested;
+        bool m_stopConsumer = false; // Guarded by m_stopMutex
+
+        void deliverPeriodically()
+        {
+            std::unique_lock<std::mutex> lock(m_stopMutex);
+            while (!m_stopConsumer)
+            {
+                lock.unlock();
+                m_queue.Drain();
+                lock.lock();
+                m_stopRequested.wait_for(lock, ASYNC_LOG_DELIVERY_INTERVAL, [this]() { return m_stopConsumer; });
+            }
+        }
+
+        void stopConsumer()
+        {
+            if (!m_consumer.joinable())
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_stopMutex);
+                m_stopConsumer = true;
+            }
+            m_stopRequested.notify_one();
+            m_consumer.join();
+            m_stopConsumer = false;
+        }
+
+    public:
+        AsyncLogQueue& GetQueue()
+        {
+            return m_queue;
+        }
+
+        void SetDeliveryMode(DeliveryMode mode)
+        {
+            std::lock_guard<std::mutex> lock(m_consumerMutex);
+            getDeliveryMode().store((int)mode, std::memory_order_release);
+
+            if (mode == DeliveryMode::Background)
+            {
+                if (!m_consumer.joinable())
+                {
+                    m_consumer = std::thread(&AsyncLogSink::deliverPeriodically, this);
+                }
+                return;
+            }
+
+            stopConsumer();
+            if (mode == DeliveryMode::Synchronous)
+            {
+                // Records queued before the switch are delivered in order, ahead of the synchronous ones
+                m_queue.Drain();
+            }
+        }
+    };
+
+    std::mutex& getAsyncLogSinkMutex()
+    {
+        static std::mutex asyncLogSinkMutex;
+        return asyncLogSinkMutex;
+    }
+
+    std::atomic<AsyncLogSink*>& getPublishedAsyncLogSink()
+    {
+        static std::atomic<AsyncLogSink*> published(nullptr);
+        return published;
+    }
+
+    // The queue is only allocated once asynchronous delivery is requested. Sinks are intentionally leaked: a logging thread
+    // may still hold one after Logging::Shutdown(), and a static destructor would join the consumer under the loader lock.
+    AsyncLogSink* getAsyncLogSink(bool create)
+    {
+        AsyncLogSink* sink = getPublishedAsyncLogSink().load(std::memory_order_acquire);
+        if (sink != nullptr || !create)
+        {
+            return sink;
+        }
+
+        std::lock_guard<std::mutex> lock(getAsyncLogSinkMutex());
+        sink = getPublishedAsyncLogSink().load(std::memory_order_acquire);
+        if (sink == nullptr)
+        {
+            sink = new AsyncLogSink();
+            getPublishedAsyncLogSink().store(sink, std::memory_order_release);
+        }
+        return sink;
+    }
+
+    void deliver(FuncLogCallback cb, Level level, const char* message, size_t size)
+    {
+        if (getDeliveryMode().load(std::memory_order_acquire) == (int)DeliveryMode::Synchronous)
+        {
+            cb((unsigned int)level, message, (int)size);
+            return;
+        }
+
+        AsyncLogSink* sink = getAsyncLogSink(false);
+        if (sink == nullptr || !sink->GetQueue().TryPush(cb, level, message, size))
+        {
+            getDroppedCount().fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    const char* getThreadIdString()
+    {
+        // The id of a thread never changes, format it once
+        thread_local const std::string threadId = []()
+        {
+            std::ostringstream stream;
+            stream << std::this_thread::get_id();
+            return stream.str();
+        }();
+        return threadId.c_str();
+    }
+
+    void formatAndLog(FuncLogCallback cb, Level level, const char* message, size_t messageSize, const void* context, bool hasContext)
+    {
+        thread_local char buffer[LOG_BUFFER_SIZE];
+        thread_local bool bufferInUse = false;
+
+        if (message == nullptr)
+        {
+            message = "";
+            messageSize = 0;
+        }
+
+        // A callback that logs again would overwrite the message it is reading
+        if (bufferInUse)
+        {
+            std::ostringstream stream;
+            stream << CONTEXT_MARK_START;
+            if (hasContext)
+            {
+                stream << "0x" << std::hex << (uintptr_t)context << std::dec;
+            }
+            stream << "@" << getThreadIdString() << CONTEXT_MARK_END;
+            stream.write(message, messageSize);
+            const std::string nested = stream.str();
+            deliver(cb, level, nested.c_str(), nested.size());
+            return;
+        }
+
+        const int prefixSize = hasContext ?
+            snprintf(buffer, LOG_BUFFER_SIZE, CONTEXT_MARK_START "0x%" PRIxPTR "@%s" CONTEXT_MARK_END, (uintptr_t)context, getThreadIdString()) :
+            snprintf(buffer, LOG_BUFFER_SIZE, CONTEXT_MARK_START "@%s" CONTEXT_MARK_END, getThreadIdString());
+        if (prefixSize < 0)
+        {
+            return;
+        }
+
+        bufferInUse = true;
+        if ((size_t)prefixSize + messageSize < LOG_BUFFER_SIZE)
+        {
+            memcpy(buffer + prefixSize, message, messageSize);
+            buffer[prefixSize + messageSize] = '\0';
+            deliver(cb, level, buffer, prefixSize + messageSize);
+        }
+        else
+        {
+            std::string longMessage;
+            longMessage.reserve(prefixSize + messageSize);
+            longMessage.append(buffer, prefixSize).append(message, messageSize);
+            deliver(cb, level, longMessage.c_str(), longMessage.size());
+        }
+        bufferInUse = false;
+    }
+}
+
 #pragma region Public Methods
 void Logging::Log(FuncLogCallback cb, Level level, const char* message)
 {
-    if (cb != nullptr)
+    if (IsEnabled(cb, level))
     {
-        std::thread::id threadId = std::this_thread::get_id();
-        std::stringstream buffer;
-        buffer << CONTEXT_MARK_START << "@" << threadId << CONTEXT_MARK_END << message;
-        cb((unsigned int) level, buffer.str().c_str(), buffer.str().size());
+        formatAndLog(cb, level, message, message != nullptr ? strlen(message) : 0, nullptr, false);
     }
 }
 
 void Logging::Log(FuncLogCallback cb, Level level, const char* message, const void* context)
 {
-    if (cb != nullptr)
+    if (IsEnabled(cb, level))
+    {
+        formatAndLog(cb, level, message, message != nullptr ? strlen(message) : 0, context, true);
+    }
+}
+
+void Logging::Log(FuncLogCallback cb, Level level, const std::string& message)
+{
+    if (IsEnabled(cb, level))
+    {
+        formatAndLog(cb, level, message.c_str(), message.size(), nullptr, false);
+    }
+}
+
+void Logging::Log(FuncLogCallback cb, Level level, const std::string& message, const void* context)
+{
+    if (IsEnabled(cb, level))
+    {
+        formatAndLog(cb, level, message.c_str(), message.size(), context, true);
+    }
+}
+
+void Logging::SetMinimumLevel(unsigned int level)
+{
+    getMinimumLevel().store(level, std::memory_order_relaxed);
+}
+
+void Logging::SetMinimumLevel(Level level)
+{
+    SetMinimumLevel((unsigned int)level);
+}
+
+unsigned int Logging::GetMinimumLevel()
+{
+    return getMinimumLevel().load(std::memory_order_relaxed);
+}
+
+bool Logging::IsEnabled(FuncLogCallback cb, Level level)
+{
+    return cb != nullptr && (unsigned int)level >= getMinimumLevel().load(std::memory_order_relaxed);
+}
+
+void Logging::SetDeliveryMode(DeliveryMode mode)
+{
+    if (mode == DeliveryMode::Synchronous)
+    {
+        AsyncLogSink* sink = getAsyncLogSink(false);
+        if (sink == nullptr)
+        {
+            getDeliveryMode().store((int)mode, std::memory_order_release);
+        }
+        else
+        {
+            sink->SetDeliveryMode(mode);
+        }
+        return;
+    }
+
+    getAsyncLogSink(true)->SetDeliveryMode(mode);
+}
+
+DeliveryMode Logging::GetDeliveryMode()
+{
+    return (DeliveryMode)getDeliveryMode().load(std::memory_order_acquire);
+}
+
+unsigned int Logging::FlushLogs()
+{
+    AsyncLogSink* sink = getAsyncLogSink(false);
+    return sink != nullptr ? sink->GetQueue().Drain() : 0;
+}
+
+unsigned long long Logging::GetDroppedCount()
+{
+    return getDroppedCount().load(std::memory_order_relaxed);
+}
+
+void Logging::Shutdown()
+{
+    AsyncLogSink* sink = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(getAsyncLogSinkMutex());
+        sink = getPublishedAsyncLogSink().exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    if (sink != nullptr)
     {
-        std::thread::id threadId = std::this_thread::get_id();
-        std::stringstream buffer;
-        buffer << CONTEXT_MARK_START << context << "@" << threadId << CONTEXT_MARK_END << message;
-        cb((unsigned int) level, buffer.str().c_str(), buffer.str().size());
+        // Stops the consumer thread and delivers the records queued so far
+        sink->SetDeliveryMode(DeliveryMode::Synchronous);
     }
 }
 #pragma endregion
@@ -0,0 +1,359 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+
+// AWS SDK
+#include <aws/cloudformation/model/DescribeStackEventsRequest.h>
+#include <aws/cloudformation/model/DescribeStacksRequest.h>
+#include <aws/core/utils/DateTime.h>
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/internal/platform_string.h>
+#include <aws/gamekit/core/stack_watcher.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
+
+using namespace GameKit;
+using namespace GameKit::Logger;
+
+namespace CfnModel = Aws::CloudFormation::Model;
+
+namespace
+{
+    static const std::chrono::seconds DEFAULT_MIN_POLL_INTERVAL(1);
+    static const std::chrono::seconds DEFAULT_MAX_POLL_INTERVAL(15);
+
+    // A stack whose DescribeStacks calls keep failing with retryable errors is reported as failed after this many polls in a row,
+    // a few minutes at the default intervals
+    static const int MAX_CONSECUTIVE_POLL_FAILURES = 20;
+
+    // Maximum number of stacks polled at the same time
+    static const size_t MAX_CONCURRENT_POLLS = 4;
+
+    // Bounds the number of DescribeStackEvents calls of a single poll. Events beyond this are older than the stack operation in practice.
+    static const int MAX_EVENT_PAGES_PER_POLL = 10;
+
+    // Events older than the time the stack was watched, minus this tolerance for clock skew, belong to earlier operations
+    static const long long EVENT_CLOCK_SKEW_MILLIS = 5 * 60 * 1000;
+
+    static const char* const STACK_RESOURCE_TYPE = "AWS::CloudFormation::Stack";
+    static const char* const USER_INITIATED_REASON = "User Initiated";
+
+    // The first event of a create, update or delete operation is the stack itself going in progress because of the user
+    bool isOperationStartEvent(const CfnModel::StackEvent& event, const std::string& stackName)
+    {
+        const CfnModel::ResourceStatus status = event.GetResourceStatus();
+        return event.GetResourceType() == STACK_RESOURCE_TYPE &&
+            ToStdString(event.GetLogicalResourceId()) == stackName &&
+            event.GetResourceStatusReason() == USER_INITIATED_REASON &&
+            (status == CfnModel::ResourceStatus::CREATE_IN_PROGRESS ||
+                status == CfnModel::ResourceStatus::UPDATE_IN_PROGRESS ||
+                status == CfnModel::ResourceStatus::DELETE_IN_PROGRESS ||
+                status == CfnModel::ResourceStatus::IMPORT_IN_PROGRESS);
+    }
+
+    // The failed state of the operation a stack was last seen in, a stack that was never described is reported as failing its creation
+    CfnModel::StackStatus getFailedState(CfnModel::StackStatus status)
+    {
+        switch (status)
+        {
+        case CfnModel::StackStatus::DELETE_IN_PROGRESS:
+        case CfnModel::StackStatus::DELETE_FAILED:
+        case CfnModel::StackStatus::DELETE_COMPLETE:
+            return CfnModel::StackStatus::DELETE_FAILED;
+        case CfnModel::StackStatus::ROLLBACK_IN_PROGRESS:
+        case CfnModel::StackStatus::ROLLBACK_FAILED:
+        case CfnModel::StackStatus::ROLLBACK_COMPLETE:
+            return CfnModel::StackStatus::ROLLBACK_FAILED;
+        case CfnModel::StackStatus::UPDATE_IN_PROGRESS:
+        case CfnModel::StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS:
+        case CfnModel::StackStatus::UPDATE_COMPLETE:
+        case CfnModel::StackStatus::UPDATE_ROLLBACK_IN_PROGRESS:
+        case CfnModel::StackStatus::UPDATE_ROLLBACK_FAILED:
+        case CfnModel::StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS:
+        case CfnModel::StackStatus::UPDATE_ROLLBACK_COMPLETE:
+            return CfnModel::StackStatus::UPDATE_ROLLBACK_FAILED;
+        case CfnModel::StackStatus::IMPORT_IN_PROGRESS:
+        case CfnModel::StackStatus::IMPORT_COMPLETE:
+        case CfnModel::StackStatus::IMPORT_ROLLBACK_IN_PROGRESS:
+        case CfnModel::StackStatus::IMPORT_ROLLBACK_FAILED:
+        case CfnModel::StackStatus::IMPORT_ROLLBACK_COMPLETE:
+            return CfnModel::StackStatus::IMPORT_ROLLBACK_FAILED;
+        default:
+            return CfnModel::StackStatus::CREATE_FAILED;
+        }
+    }
+}
+
+struct StackWatcher::WatchedStack
+{
+    Aws::CloudFormation::CloudFormationClient* CfClient;
+    std::string StackName;
+    FuncLogCallback LogCb;
+    const void* LogContext;
+    std::promise<CfnModel::StackStatus> Result;
+
+    // Only accessed by the poller thread
+    CfnModel::StackStatus Status = CfnModel::StackStatus::NOT_SET;
+    Aws::String LastEventId;
+    long long OldestEventMillis;
+    std::chrono::milliseconds PollInterval;
+    int ConsecutivePollFailures = 0;
+
+    // Guarded by m_watchedStacksMutex
+    std::chrono::steady_clock::time_point NextPoll;
+};
+
+StackWatcher::StackWatcher(std::chrono::milliseconds minPollInterval, std::chrono::milliseconds maxPollInterval) :
+    m_minPollInterval(minPollInterval), m_maxPollInterval(std::max(minPollInterval, maxPollInterval))
+{}
+
+StackWatcher::~StackWatcher()
+{
+    Shutdown();
+}
+
+StackWatcher& StackWatcher::GetInstance()
+{
+    // Intentionally leaked: joining the poller from a static destructor can deadlock under the Windows loader lock.
+    // AwsApiInitializer::Shutdown() stops the poller instead.
+    static StackWatcher* instance = new StackWatcher(DEFAULT_MIN_POLL_INTERVAL, DEFAULT_MAX_POLL_INTERVAL);
+    return *instance;
+}
+
+void StackWatcher::Shutdown()
+{
+    std::thread poller;
+    {
+        std::lock_guard<std::mutex> lock(m_watchedStacksMutex);
+        m_stopPolling = true;
+        poller = std::move(m_poller);
+    }
+    m_watchedStacksChanged.notify_one();
+
+    // Polls in flight complete first, they are bounded by the client's timeouts
+    if (poller.joinable())
+    {
+        poller.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_watchedStacksMutex);
+    m_stopPolling = false;
+
+    // Waiters are released with the last status the poller saw, which no longer runs
+    for (const auto& stack : m_watchedStacks)
+    {
+        stack->Result.set_value(stack->Status);
+    }
+    m_watchedStacks.clear();
+}
+
+std::shared_future<CfnModel::StackStatus> StackWatcher::Watch(Aws::CloudFormation::CloudFormationClient* cfClient, const std::string& stackName, FuncLogCallback logCb, const void* logContext)
+{
+    auto stack = std::make_shared<WatchedStack>();
+    stack->CfClient = cfClient;
+    stack->StackName = stackName;
+    stack->LogCb = logCb;
+    stack->LogContext = logContext;
+    stack->OldestEventMillis = Aws::Utils::DateTime::Now().Millis() - EVENT_CLOCK_SKEW_MILLIS;
+    stack->PollInterval = m_minPollInterval;
+    stack->NextPoll = std::chrono::steady_clock::now();
+    std::shared_future<CfnModel::StackStatus> status = stack->Result.get_future().share();
+
+    std::lock_guard<std::mutex> lock(m_watchedStacksMutex);
+    m_watchedStacks.push_back(stack);
+    if (!m_pollerRunning)
+    {
+        // A poller that ran out of stacks has already released the lock for good, joining it can't deadlock
+        if (m_poller.joinable())
+        {
+            m_poller.join();
+        }
+
+        m_poller = std::thread(&StackWatcher::pollStacks, this);
+        m_pollerRunning = true;
+    }
+
+    m_watchedStacksChanged.notify_one();
+    return status;
+}
+
+bool StackWatcher::IsTerminalState(CfnModel::StackStatus status)
+{
+    return status == CfnModel::StackStatus::CREATE_FAILED ||
+        status == CfnModel::StackStatus::CREATE_COMPLETE ||
+        status == CfnModel::StackStatus::ROLLBACK_FAILED ||
+        status == CfnModel::StackStatus::ROLLBACK_COMPLETE ||
+        status == CfnModel::StackStatus::DELETE_FAILED ||
+        status == CfnModel::StackStatus::DELETE_COMPLETE ||
+        status == CfnModel::StackStatus::UPDATE_COMPLETE ||
+        status == CfnModel::StackStatus::UPDATE_ROLLBACK_FAILED ||
+        status == CfnModel::StackStatus::UPDATE_ROLLBACK_COMPLETE ||
+        status == CfnModel::StackStatus::IMPORT_COMPLETE ||
+        status == CfnModel::StackStatus::IMPORT_ROLLBACK_FAILED ||
+        status == CfnModel::StackStatus::IMPORT_ROLLBACK_COMPLETE;
+}
+
+void StackWatcher::pollStacks()
+{
+    std::unique_lock<std::mutex> lock(m_watchedStacksMutex);
+    while (!m_watchedStacks.empty() && !m_stopPolling)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        auto nextPoll = std::chrono::steady_clock::time_point::max();
+        std::vector<std::shared_ptr<WatchedStack>> dueStacks;
+        for (const auto& stack : m_watchedStacks)
+        {
+            if (stack->NextPoll <= now)
+            {
+                dueStacks.push_back(stack);
+            }
+            nextPoll = std::min(nextPoll, stack->NextPoll);
+        }
+
+        if (dueStacks.empty())
+        {
+            // Woken up early when a new stack is watched or the watcher shuts down
+            m_watchedStacksChanged.wait_until(lock, nextPoll);
+            continue;
+        }
+
+        lock.unlock();
+
+        // Stacks are only added while polling, so the due stacks are exclusively owned by this thread until they are relocked
+        std::vector<char> finished(dueStacks.size(), false);
+        std::vector<std::function<unsigned int()>> polls;
+        polls.reserve(dueStacks.size());
+        for (size_t i = 0; i < dueStacks.size(); ++i)
+        {
+            polls.push_back([&, i]()
+            {
+                finished[i] = pollStack(*dueStacks[i]);
+                return GAMEKIT_SUCCESS;
+            });
+        }
+        Utils::ParallelUtils::RunTasks(polls, MAX_CONCURRENT_POLLS);
+
+        lock.lock();
+        for (size_t i = 0; i < dueStacks.size(); ++i)
+        {
+            if (finished[i])
+            {
+                m_watchedStacks.erase(std::find(m_watchedStacks.begin(), m_watchedStacks.end(), dueStacks[i]));
+                dueStacks[i]->Result.set_value(dueStacks[i]->Status);
+            }
+            else
+            {
+                dueStacks[i]->NextPoll = std::chrono::steady_clock::now() + dueStacks[i]->PollInterval;
+            }
+        }
+    }
+
+    m_pollerRunning = false;
+}
+
+bool StackWatcher::pollStack(WatchedStack& stack) const
+{
+    const auto describeStacksOutcome = stack.CfClient->DescribeStacks(CfnModel::DescribeStacksRequest().WithStackName(ToAwsString(stack.StackName)));
+    if (!describeStacksOutcome.IsSuccess() && describeStacksOutcome.GetError().ShouldRetry())
+    {
+        // Throttled or a transient error, back off and give up on the stack if it lasts
+        if (++stack.ConsecutivePollFailures >= MAX_CONSECUTIVE_POLL_FAILURES)
+        {
+            stack.Status = getFailedState(stack.Status);
+            Logging::Log(stack.LogCb, Level::Error, "StackWatcher: DescribeStacks failed " + std::to_string(stack.ConsecutivePollFailures) + " times in a row for " + stack.StackName +
+                ", reporting it as failed: " + ToStdString(describeStacksOutcome.GetError().GetMessage()), stack.LogContext);
+            return true;
+        }
+
+        stack.PollInterval = std::min(stack.PollInterval * 2, m_maxPollInterval);
+
+        GAMEKIT_LOG(stack.LogCb, Level::Verbose, "StackWatcher: DescribeStacks failed for " + stack.StackName + ", retrying: " + ToStdString(describeStacksOutcome.GetError().GetMessage()), stack.LogContext);
+        return false;
+    }
+
+    stack.ConsecutivePollFailures = 0;
+
+    const CfnModel::StackStatus previousStatus = stack.Status;
+    if (describeStacksOutcome.IsSuccess() && !describeStacksOutcome.GetResult().GetStacks().empty())
+    {
+        stack.Status = describeStacksOutcome.GetResult().GetStacks().front().GetStackStatus();
+    }
+
+    // Always fetch events, including after the final status, so the events that completed the operation are logged
+    const bool progressed = logNewStackEvents(stack) || stack.Status != previousStatus;
+
+    // A stack that can no longer be described was deleted, its last status is the final one
+    if (!describeStacksOutcome.IsSuccess() || IsTerminalState(stack.Status))
+    {
+        return true;
+    }
+
+    stack.PollInterval = progressed ? m_minPollInterval : std::min(stack.PollInterval * 3 / 2, m_maxPollInterval);
+    return false;
+}
+
+bool StackWatcher::logNewStackEvents(WatchedStack& stack) const
+{
+    // Events are returned newest first, page until the newest event logged by the previous poll
+    std::vector<CfnModel::StackEvent> newEvents;
+    Aws::String nextToken;
+    bool reachedLoggedEvents = false;
+    for (int page = 0; page < MAX_EVENT_PAGES_PER_POLL && !reachedLoggedEvents; ++page)
+    {
+        auto describeStackEventsReq = CfnModel::DescribeStackEventsRequest().WithStackName(ToAwsString(stack.StackName));
+        if (!nextToken.empty())
+        {
+            describeStackEventsReq.SetNextToken(nextToken);
+        }
+
+        const auto outcome = stack.CfClient->DescribeStackEvents(describeStackEventsReq);
+        if (!outcome.IsSuccess())
+        {
+            break;
+        }
+
+        for (const CfnModel::StackEvent& event : outcome.GetResult().GetStackEvents())
+        {
+            if ((!stack.LastEventId.empty() && event.GetEventId() == stack.LastEventId) ||
+                (event.TimestampHasBeenSet() && event.GetTimestamp().Millis() < stack.OldestEventMillis))
+            {
+                reachedLoggedEvents = true;
+                break;
+            }
+
+            newEvents.push_back(event);
+
+            // Older events belong to previous operations on the stack
+            if (isOperationStartEvent(event, stack.StackName))
+            {
+                reachedLoggedEvents = true;
+                break;
+            }
+        }
+
+        nextToken = outcome.GetResult().GetNextToken();
+        if (nextToken.empty())
+        {
+            break;
+        }
+    }
+
+    if (newEvents.empty())
+    {
+        return false;
+    }
+
+    stack.LastEventId = newEvents.front().GetEventId();
+    for (auto event = newEvents.rbegin(); event != newEvents.rend(); ++event)
+    {
+        const std::string msg = stack.StackName + ": " + ToStdString(event->GetLogicalResourceId()) + " | " +
+            ToStdString(CfnModel::ResourceStatusMapper::GetNameForResourceStatus(event->GetResourceStatus())) + ": " +
+            ToStdString(event->GetResourceStatusReason());
+        Logging::Log(stack.LogCb, Level::Info, msg.c_str(), stack.LogContext);
+    }
+
+    return true;
+}
@@ -1,6 +1,10 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <algorithm>
+
+// GameKit
 #include <aws/gamekit/core/utils/count_ticker.h>
 
 using namespace GameKit::Utils;
@@ -16,6 +20,11 @@ void CountTicker::startNewInterval(int intervalSeconds)
     m_intervalTimeLeft = std::chrono::seconds(intervalSeconds);
 }
 
+void CountTicker::startNewInterval(std::chrono::milliseconds interval)
+{
+    m_intervalTimeLeft = interval;
+}
+
 void CountTicker::countDownInterval(std::chrono::milliseconds sleepTime)
 {
     m_intervalTimeLeft -= sleepTime;
@@ -25,4 +34,9 @@ bool CountTicker::isIntervalOver() const
 {
     return m_intervalTimeLeft.count() <= 0;
 }
+
+std::chrono::milliseconds CountTicker::getIntervalTimeLeft() const
+{
+    return (std::max)(m_intervalTimeLeft, std::chrono::milliseconds(0));
+}
 #pragma endregion
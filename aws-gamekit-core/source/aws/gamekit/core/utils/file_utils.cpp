@@ -1,10 +1,22 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <algorithm>
+#include <ctime>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+// AWS SDK
+#include <aws/core/utils/crypto/Sha256.h>
+
 // GameKit
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
 
 // Boost
 #include <boost/filesystem.hpp>
@@ -15,16 +27,239 @@
 using namespace GameKit::Utils;
 using namespace GameKit::Logger;
 
+namespace
+{
+    static const size_t MAX_FILE_HASH_WORKERS = 8;
+    static const size_t MAX_FILE_HASH_CACHE_ENTRIES = 100000;
+
+    // Files modified this close to the time they are hashed are not cached: a later write within the same
+    // second and with the same size would be indistinguishable, since last write times have a one second resolution.
+    static const std::time_t RACY_WRITE_SECONDS = 2;
+
+    static const char* FILE_HASH_CACHE_FILE_NAME = "gamekit_file_hashes.cache";
+
+    struct FileToHash
+    {
+        boost::filesystem::path Path;
+        std::string CacheKey;
+        uintmax_t FileSize = 0;
+        std::time_t LastWriteTime = 0;
+        bool Cacheable = false;
+        std::string Digest;
+    };
+
+    struct CachedFileDigest
+    {
+        uintmax_t FileSize;
+        std::time_t LastWriteTime;
+        std::string Digest;
+
+        // Position in the least recently used order, higher values were used more recently
+        uint64_t LastUsed;
+    };
+
+    struct FileHashCache
+    {
+        std::unordered_map<std::string, CachedFileDigest> Entries;
+        uint64_t UseCounter = 0;
+    };
+
+    std::mutex& getFileHashCacheMutex()
+    {
+        static std::mutex fileHashCacheMutex;
+        return fileHashCacheMutex;
+    }
+
+    std::string getFileHashCachePath()
+    {
+        boost::system::error_code errorCode;
+        const boost::filesystem::path tempDirectory = boost::filesystem::temp_directory_path(errorCode);
+        return errorCode ? std::string() : (tempDirectory / FILE_HASH_CACHE_FILE_NAME).string();
+    }
+
+    // Per-file digests keyed by absolute path, loaded from the temp directory on first use so they survive between runs.
+    // Each line of the cache file is "<size> <last write time> <digest> <path>", from the least to the most recently used.
+    // Must be called while holding getFileHashCacheMutex().
+    FileHashCache& getFileHashCache()
+    {
+        static FileHashCache fileHashCache;
+        static bool loaded = false;
+        if (!loaded)
+        {
+            loaded = true;
+            std::ifstream cacheFile(FileUtils::PathFromUtf8(getFileHashCachePath()));
+            CachedFileDigest entry;
+            std::string filePath;
+            while (cacheFile >> entry.FileSize >> entry.LastWriteTime >> entry.Digest && cacheFile.get() == ' ' && std::getline(cacheFile, filePath))
+            {
+                entry.LastUsed = ++fileHashCache.UseCounter;
+                fileHashCache.Entries[filePath] = entry;
+            }
+        }
+
+        return fileHashCache;
+    }
+
+    bool tryGetCachedFileDigest(FileToHash& file)
+    {
+        std::lock_guard<std::mutex> lock(getFileHashCacheMutex());
+        FileHashCache& cache = getFileHashCache();
+        const auto cached = cache.Entries.find(file.CacheKey);
+        if (cached == cache.Entries.end() || cached->second.FileSize != file.FileSize || cached->second.LastWriteTime != file.LastWriteTime)
+        {
+            return false;
+        }
+
+        cached->second.LastUsed = ++cache.UseCounter;
+        file.Digest = cached->second.Digest;
+        return true;
+    }
+
+    // Drops the least recently used entries above MAX_FILE_HASH_CACHE_ENTRIES. Must be called while holding getFileHashCacheMutex().
+    void evictFileDigests(FileHashCache& cache)
+    {
+        if (cache.Entries.size() <= MAX_FILE_HASH_CACHE_ENTRIES)
+        {
+            return;
+        }
+
+        std::vector<uint64_t> lastUsed;
+        lastUsed.reserve(cache.Entries.size());
+        for (const auto& entry : cache.Entries)
+        {
+            lastUsed.push_back(entry.second.LastUsed);
+        }
+
+        // use counters are unique, entries used before the oldest one to keep are evicted
+        const size_t evictedCount = cache.Entries.size() - MAX_FILE_HASH_CACHE_ENTRIES;
+        std::nth_element(lastUsed.begin(), lastUsed.begin() + evictedCount, lastUsed.end());
+        const uint64_t oldestKept = lastUsed[evictedCount];
+        for (auto entry = cache.Entries.begin(); entry != cache.Entries.end();)
+        {
+            entry = entry->second.LastUsed < oldestKept ? cache.Entries.erase(entry) : std::next(entry);
+        }
+    }
+
+    // Writes the whole cache to the temp directory. Must be called while holding getFileHashCacheMutex().
+    void saveFileDigests(const FileHashCache& cache, FuncLogCallback logCallback)
+    {
+        const std::string cachePath = getFileHashCachePath();
+        if (cachePath.empty())
+        {
+            Logging::Log(logCallback, Level::Warning, "FileUtils::CalculateDirectoryHash() Temp directory not found, file hashes are not saved.");
+            return;
+        }
+
+        // write to a temporary file first so concurrent processes never read a partially written cache
+        boost::system::error_code errorCode;
+        const boost::filesystem::path cacheFilePath(cachePath);
+        const boost::filesystem::path tempCachePath = cacheFilePath.parent_path() / boost::filesystem::unique_path(cacheFilePath.filename().string() + ".%%%%-%%%%-%%%%-%%%%.tmp", errorCode);
+        if (errorCode)
+        {
+            Logging::Log(logCallback, Level::Warning, "FileUtils::CalculateDirectoryHash() Failed to name a temporary file for the file hashes: " + errorCode.message());
+            return;
+        }
+
+        std::vector<std::pair<const std::string*, const CachedFileDigest*>> entries;
+        entries.reserve(cache.Entries.size());
+        for (const auto& entry : cache.Entries)
+        {
+            entries.emplace_back(&entry.first, &entry.second);
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const std::pair<const std::string*, const CachedFileDigest*>& left, const std::pair<const std::string*, const CachedFileDigest*>& right)
+        {
+            return left.second->LastUsed < right.second->LastUsed;
+        });
+
+        bool written = false;
+        {
+            std::ofstream cacheFile(FileUtils::PathFromUtf8(tempCachePath.string()), std::ios_base::out | std::ios_base::trunc);
+            for (const auto& entry : entries)
+            {
+                cacheFile << entry.second->FileSize << ' ' << entry.second->LastWriteTime << ' ' << entry.second->Digest << ' ' << *entry.first << '\n';
+            }
+
+            cacheFile.flush();
+            written = cacheFile.good();
+        }
+
+        if (!written)
+        {
+            Logging::Log(logCallback, Level::Warning, "FileUtils::CalculateDirectoryHash() Failed to write the file hashes to " + tempCachePath.string());
+            boost::filesystem::remove(tempCachePath, errorCode);
+            return;
+        }
+
+        boost::filesystem::rename(tempCachePath, cachePath, errorCode);
+        if (errorCode)
+        {
+            Logging::Log(logCallback, Level::Warning, "FileUtils::CalculateDirectoryHash() Failed to save the file hashes to " + cachePath + ": " + errorCode.message());
+            boost::filesystem::remove(tempCachePath, errorCode);
+        }
+    }
+
+    // Caches the digests calculated by one CalculateDirectoryHash() call, and saves the cache once if any of them was new
+    void cacheFileDigests(const std::vector<FileToHash>& files, FuncLogCallback logCallback)
+    {
+        std::lock_guard<std::mutex> lock(getFileHashCacheMutex());
+        FileHashCache& cache = getFileHashCache();
+
+        bool changed = false;
+        const std::time_t now = std::time(nullptr);
+        for (const FileToHash& file : files)
+        {
+            if (!file.Cacheable || file.Digest.empty() || file.LastWriteTime >= now - RACY_WRITE_SECONDS || file.CacheKey.find('\n') != std::string::npos)
+            {
+                continue;
+            }
+
+            CachedFileDigest& cached = cache.Entries[file.CacheKey];
+            if (cached.Digest != file.Digest || cached.FileSize != file.FileSize || cached.LastWriteTime != file.LastWriteTime)
+            {
+                cached = { file.FileSize, file.LastWriteTime, file.Digest, 0 };
+                changed = true;
+            }
+
+            cached.LastUsed = ++cache.UseCounter;
+        }
+
+        if (changed)
+        {
+            evictFileDigests(cache);
+            saveFileDigests(cache, logCallback);
+        }
+    }
+
+    // Returns the base64 encoded SHA-256 of a file's text, as read by FileUtils::ReadFileIntoString()
+    std::string calculateFileDigest(const boost::filesystem::path& filePath, FuncLogCallback logCallback)
+    {
+        Aws::Utils::Crypto::Sha256 sha256;
+        const Aws::Utils::Base64::Base64 base64;
+
+        std::ifstream sourceFile(FileUtils::PathFromUtf8(filePath.string()));
+        char signature[3] = {};
+        const bool hasUtf8Signature = sourceFile && sourceFile.read(signature, 3) && memcmp(signature, "\xEF\xBB\xBF", 3) == 0;
+        if (!sourceFile || hasUtf8Signature)
+        {
+            // rare case, the signature is not part of the text so hash the contents without it
+            std::string fileContents;
+            FileUtils::ReadFileIntoString(filePath.string(), fileContents, logCallback, "FileUtils::CalculateDirectoryHash()");
+            return ToStdString(base64.Encode(sha256.Calculate(ToAwsString(fileContents)).GetResult()));
+        }
+
+        // hashes the file in fixed size blocks from the beginning
+        sourceFile.clear();
+        const Aws::Utils::Crypto::HashResult fileHashResult = sha256.Calculate(sourceFile);
+        return ToStdString(base64.Encode(fileHashResult.GetResult()));
+    }
+}
+
 #pragma region Public Methods
 unsigned int FileUtils::CalculateDirectoryHash(const std::string& directoryPath, std::string& returnedString, FuncLogCallback logCallback)
 {
     using namespace boost::filesystem;
 
-    Aws::Utils::Crypto::Sha256 sha256;
-    const Aws::Utils::Base64::Base64 base64;
-
-    std::set<std::string> fileHashSet;
-
     const path dp(directoryPath);
 
     if(!is_directory(dp))
@@ -35,9 +270,12 @@ unsigned int FileUtils::CalculateDirectoryHash(const std::string& directoryPath,
             Logging::Log(logCallback, Level::Error, errorMessage.c_str());
         }
 
+        returnedString = "";
         return GAMEKIT_ERROR_DIRECTORY_NOT_FOUND;
     }
 
+    // collect the files and reuse the digests of files that didn't change since they were last hashed
+    std::vector<FileToHash> files;
     recursive_directory_iterator endIterator;
     for (recursive_directory_iterator dirIterator(dp); dirIterator != endIterator; ++dirIterator)
     {
@@ -45,22 +283,65 @@ unsigned int FileUtils::CalculateDirectoryHash(const std::string& directoryPath,
         const path cp = (*dirIterator);
         if (!is_directory(cp))
         {
-            std::string returnedValue = "";
-            ReadFileIntoString(cp.string(), returnedValue, logCallback, "FileUtils::CalculateDirectoryHash()");
-            Aws::String fileContents(returnedValue);
+            FileToHash file;
+            file.Path = cp;
+            boost::system::error_code sizeError;
+            boost::system::error_code timeError;
+            file.FileSize = file_size(cp, sizeError);
+            file.LastWriteTime = last_write_time(cp, timeError);
+            file.Cacheable = !sizeError && !timeError;
+            file.CacheKey = absolute(cp).string();
+            if (file.Cacheable)
+            {
+                tryGetCachedFileDigest(file);
+            }
 
-            const Aws::Utils::Crypto::HashResult fileHashResult = sha256.Calculate(ToAwsString(returnedValue));
-            fileHashSet.insert(ToStdString(base64.Encode(fileHashResult.GetResult())));
+            files.push_back(std::move(file));
         }
     }
 
+    // hash the remaining files on a worker pool, each file is streamed instead of loaded in memory
+    std::vector<std::function<unsigned int()>> tasks;
+    for (FileToHash& file : files)
+    {
+        if (file.Digest.empty())
+        {
+            tasks.push_back([&file, logCallback]()
+            {
+                file.Digest = calculateFileDigest(file.Path, logCallback);
+                return GAMEKIT_SUCCESS;
+            });
+        }
+    }
+
+    if (!tasks.empty())
+    {
+        const size_t workerCount = std::min<size_t>(std::max<unsigned int>(std::thread::hardware_concurrency(), 1), MAX_FILE_HASH_WORKERS);
+        const unsigned int result = ParallelUtils::RunTasks(tasks, workerCount);
+        if (result != GAMEKIT_SUCCESS)
+        {
+            Logging::Log(logCallback, Level::Warning, "FileUtils::CalculateDirectoryHash() Failed to hash files, result: " + std::to_string(result));
+        }
+
+        cacheFileDigests(files, logCallback);
+    }
+
+    // combine the sorted, de-duplicated file digests into the directory hash
+    std::set<std::string> fileHashSet;
+    for (const FileToHash& file : files)
+    {
+        fileHashSet.insert(file.Digest);
+    }
+
     std::string tempDirectoryHashString = "";
 
-    for (const auto fileHashString : fileHashSet)
+    for (const auto& fileHashString : fileHashSet)
     {
         tempDirectoryHashString.append(fileHashString);
     }
 
+    Aws::Utils::Crypto::Sha256 sha256;
+    const Aws::Utils::Base64::Base64 base64;
     const auto hashResult = sha256.Calculate(ToAwsString(tempDirectoryHashString));
 
     returnedString = ToStdString(base64.Encode(hashResult.GetResult()));
@@ -23,6 +23,7 @@ BaseHttpClient::BaseHttpClient(
     FuncLogCallback logCb) :
     m_clientName(clientName),
     m_httpClient(client),
+    m_requestMetrics(&RequestMetrics::GetEndpoint(clientName)),
     m_authorizationHeaderSetter(authSetter),
     m_attempsCount(0),
     m_isConnectionOk(true),
@@ -32,7 +33,7 @@ BaseHttpClient::BaseHttpClient(
     m_secondsInterval(retryIntervalSeconds),
     m_retryStrategy(retryStrategy),
     m_logCb(logCb),
-    m_requestPump(m_secondsInterval, std::bind(&BaseHttpClient::preProcessQueue, this), logCb),
+    m_requestPump(m_secondsInterval, std::bind(&BaseHttpClient::tickRequestPump, this), logCb),
     m_abortProcessingRequested(false),
     m_activeQueue(),
     m_pendingQueue(),
@@ -45,8 +46,10 @@ BaseHttpClient::BaseHttpClient(
 BaseHttpClient::~BaseHttpClient()
 {
     StopRetryBackgroundThread();
+
+    // The pump has finished its last request. Request processing is left enabled because the low level client is shared with other features.
     std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
-    m_httpClient->DisableRequestProcessing();
+    reportQueueDepth(0);
 
     if (!m_activeQueue.empty())
     {
@@ -73,6 +76,11 @@ void BaseHttpClient::SetCacheProcessedCallback(CACHE_PROCESSED_RECEIVER_HANDLE r
     m_cachedProcessedCb = cacheProcessedCallback;
 }
 
+void BaseHttpClient::SetUnauthorizedResponseHandler(UnauthorizedResponseHandler unauthorizedHandler)
+{
+    m_unauthorizedResponseHandler = unauthorizedHandler;
+}
+
 void BaseHttpClient::StartRetryBackgroundThread()
 {
     if (!m_requestPump.IsRunning())
@@ -320,14 +328,25 @@ bool BaseHttpClient::enqueuePending(std::shared_ptr<IOperation> operation)
     if (isPendingQueueBelowLimit())
     {
         m_pendingQueue.push_back(operation);
-        std::string message = "Pending queue size: " + std::to_string(m_pendingQueue.size());
-        Logging::Log(m_logCb, Level::Verbose, message.c_str());
+        GAMEKIT_LOG(m_logCb, Level::Verbose, "Pending queue size: " + std::to_string(m_pendingQueue.size()));
         return true;
     } // else, the request is dropped and an error has been logged
 
     return false;
 }
 
+void BaseHttpClient::tickRequestPump()
+{
+    preProcessQueue();
+
+    // Wake up exactly when the retry strategy allows the next retry, instead of polling it every interval
+    const std::chrono::milliseconds timeUntilRetry = m_retryStrategy->GetTimeUntilRetry();
+    if (timeUntilRetry.count() > 0)
+    {
+        m_requestPump.RescheduleNextTick(timeUntilRetry);
+    }
+}
+
 void BaseHttpClient::preProcessQueue()
 {
     // Add active and pending operations to a single queue.
@@ -339,9 +358,10 @@ void BaseHttpClient::preProcessQueue()
         size_t activeCount = m_activeQueue.size();
         size_t pendingCount = m_pendingQueue.size();
 
+        reportQueueDepth(activeCount + pendingCount);
         if ((activeCount + pendingCount) == 0)
         {
-            Logging::Log(m_logCb, Level::Verbose, "Queues are empty, nothing to process.");
+            GAMEKIT_LOG(m_logCb, Level::Verbose, "Queues are empty, nothing to process.");
 
             if (!m_isConnectionOk)
             {
@@ -361,8 +381,7 @@ void BaseHttpClient::preProcessQueue()
             return;
         }
 
-        std::string message = "Processing " + std::to_string(activeCount) + " operations in active queue, " + std::to_string(pendingCount) + " operations in pending queue";
-        Logging::Log(m_logCb, Level::Info, message.c_str());
+        GAMEKIT_LOG(m_logCb, Level::Info, "Processing " + std::to_string(activeCount) + " operations in active queue, " + std::to_string(pendingCount) + " operations in pending queue");
 
         // Append operations from active to pending queue to preserve order
         std::move(m_activeQueue.begin(), m_activeQueue.end(), std::back_inserter(m_pendingQueue));
@@ -378,12 +397,18 @@ void BaseHttpClient::preProcessQueue()
     processActiveQueue();
 }
 
+void BaseHttpClient::reportQueueDepth(size_t queueDepth)
+{
+    // Clients of the same name share the endpoint, each one adds the change of its own queues
+    m_requestMetrics->AddQueueDepth(static_cast<long long>(queueDepth) - static_cast<long long>(m_reportedQueueDepth));
+    m_reportedQueueDepth = queueDepth;
+}
+
 void BaseHttpClient::processActiveQueue()
 {
     // Send requests for each operation in the active queue. Stop sending events when failure occurs.
 
-    std::string message = "Processing active queue with " + std::to_string(m_activeQueue.size()) + " items";
-    Logging::Log(m_logCb, Level::Info, message.c_str());
+    GAMEKIT_LOG(m_logCb, Level::Info, "Processing active queue with " + std::to_string(m_activeQueue.size()) + " items");
     bool overrideConnectionStatus = true;
 
     do
@@ -452,6 +477,9 @@ void BaseHttpClient::processActiveQueue()
     {
         // not all items were sent, return and wait for next invocation
         Logging::Log(m_logCb, Level::Warning, "Not all items in the queue were sent, items will be retried.");
+
+        std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
+        reportQueueDepth(m_activeQueue.size() + m_pendingQueue.size());
     }
 }
 
@@ -473,6 +501,7 @@ void BaseHttpClient::DropAllCachedEvents()
     // Filter pending queue, using active as target queue.
     removeCachedFromQueue(&m_pendingQueue, &m_activeQueue);
     m_pendingQueue.clear();
+    reportQueueDepth(m_activeQueue.size());
 
     // Pending queue should be empty by now and active queue should now have all non cached operations
     if (!m_pendingQueue.empty())
@@ -523,7 +552,7 @@ bool BaseHttpClient::isPendingQueueBelowLimit() const
 
 RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> operation, bool isAsyncOperation, bool overrideConnectionStatus)
 {
-    Logging::Log(m_logCb, Level::Verbose, "MakeOperationRequest outgoing request");
+    GAMEKIT_LOG(m_logCb, Level::Verbose, "MakeOperationRequest outgoing request");
 
     m_authorizationHeaderSetter(operation->Request);
 
@@ -532,7 +561,7 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
     if (isAsyncOperation && m_requestPump.IsRunning())
     {
         // Enqueue
-        Logging::Log(m_logCb, Level::Verbose, "Async operation, adding request to queue.");
+        GAMEKIT_LOG(m_logCb, Level::Verbose, "Async operation, adding request to queue.");
         
         if (enqueuePending(operation))
         {
@@ -540,6 +569,7 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
         }
         else
         {
+            m_requestMetrics->RecordDrop();
             return RequestResult(RequestResultType::RequestDropped, std::shared_ptr<Aws::Http::HttpResponse>());
         }
     }
@@ -557,22 +587,47 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
             m_authorizationHeaderSetter(operation->Request);
         }
 
+        if (operation->Attempts > 1)
+        {
+            m_requestMetrics->RecordRetry();
+        }
+
         auto requestStart = std::chrono::steady_clock::now();
 
-        auto response = m_httpClient->MakeRequest(operation->Request);
+        auto response = RequestMetrics::MakeRequest(*m_httpClient, operation->Request, *m_requestMetrics);
 
         auto requestEnd = std::chrono::steady_clock::now();
         auto latencyMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(requestEnd - requestStart).count();
 
-        std::string message = "Made request for Operation with timestamp " + std::to_string(operation->Timestamp.count()) + ", Attempts " +
-            std::to_string(operation->Attempts) + ", Client-side latency (ms): " + std::to_string(latencyMilliseconds);
-        Logging::Log(m_logCb, Level::Verbose, message.c_str());
+        GAMEKIT_LOG(m_logCb, Level::Verbose, "Made request for Operation with timestamp " + std::to_string(operation->Timestamp.count()) + ", Attempts " +
+            std::to_string(operation->Attempts) + ", Client-side latency (ms): " + std::to_string(latencyMilliseconds));
+
+        // The authorization can expire before its scheduled refresh. Give the owner a chance to refresh it, then replay the request once.
+        if (response->GetResponseCode() == Aws::Http::HttpResponseCode::UNAUTHORIZED && m_unauthorizedResponseHandler != nullptr && m_unauthorizedResponseHandler(operation->Request))
+        {
+            Logging::Log(m_logCb, Level::Info, "Request was not authorized, replaying it with refreshed authorization.");
+
+            if (m_authorizationHeaderSetter != nullptr)
+            {
+                m_authorizationHeaderSetter(operation->Request);
+            }
+
+            // Rewind the body consumed by the first attempt
+            const std::shared_ptr<Aws::IOStream> body = operation->Request->GetContentBody();
+            if (body != nullptr)
+            {
+                body->clear();
+                body->seekg(0);
+            }
+
+            m_requestMetrics->RecordRetry();
+            response = RequestMetrics::MakeRequest(*m_httpClient, operation->Request, *m_requestMetrics);
+        }
 
         // Handle success
         if (response->GetResponseCode() == operation->ExpectedSuccessCode)
         {
-            std::string message = "Request succeeded in attempt " + std::to_string(operation->Attempts);
-            Logging::Log(m_logCb, Level::Verbose, message.c_str());
+            GAMEKIT_LOG(m_logCb, Level::Verbose, "Request succeeded in attempt " + std::to_string(operation->Attempts));
 
             m_retryStrategy->Reset();
 
@@ -599,6 +654,12 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
 
             m_retryStrategy->IncreaseThreshold();
 
+            const std::chrono::milliseconds retryAfter = GetRetryAfter(response);
+            if (retryAfter.count() > 0)
+            {
+                m_retryStrategy->SetRetryAfter(retryAfter);
+            }
+
             // Enqueue
             if (enqueuePending(operation))
             {
@@ -607,6 +668,7 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
             }
             else
             {
+                m_requestMetrics->RecordDrop();
                 return RequestResult(RequestResultType::RequestDropped, response);
             }
         }
@@ -636,6 +698,7 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
         {
             // Connection is unhealthy and enqueueing is not allowed, drop the request.
             Logging::Log(m_logCb, Level::Info, "Connection is Unhealthy, not enqueueing operation.");
+            m_requestMetrics->RecordDrop();
             return RequestResult(RequestResultType::RequestDropped, std::shared_ptr<Aws::Http::HttpResponse>());
         }
     }
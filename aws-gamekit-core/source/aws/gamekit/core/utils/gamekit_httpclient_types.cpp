@@ -1,12 +1,15 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <algorithm>
 
 // AWS SDK
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/StringUtils.h>
 
 // GameKit
@@ -21,6 +24,14 @@
 
 #define MAX_STR_READ_LEN 1024
 
+namespace
+{
+    static const char* const RETRY_AFTER_HEADER = "retry-after";
+
+    // Bounds a Retry-After delay, so a bogus value can't stall the retry queue for days
+    static const std::chrono::milliseconds MAX_RETRY_AFTER = std::chrono::minutes(15);
+}
+
 using namespace GameKit::Utils::HttpClient;
 using namespace GameKit::Utils::Serialization;
 
@@ -357,8 +368,51 @@ unsigned int RequestResult::ToErrorCode() const
 }
 #pragma endregion
 
+#pragma region Retry Public Methods
+std::chrono::milliseconds GameKit::Utils::HttpClient::GetRetryAfter(const std::shared_ptr<const Aws::Http::HttpResponse> response, std::chrono::system_clock::time_point now)
+{
+    if (response == nullptr || !response->HasHeader(RETRY_AFTER_HEADER))
+    {
+        return std::chrono::milliseconds(0);
+    }
+
+    const Aws::String value = Aws::Utils::StringUtils::Trim(response->GetHeader(RETRY_AFTER_HEADER).c_str());
+    if (value.empty())
+    {
+        return std::chrono::milliseconds(0);
+    }
+
+    std::chrono::milliseconds retryAfter(0);
+    if (std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        // Delay in seconds, clamped before converting to avoid overflows
+        const std::string seconds = value.size() > 6 ? "999999" : ToStdString(value);
+        retryAfter = std::chrono::seconds(std::stoll(seconds));
+    }
+    else
+    {
+        const Aws::Utils::DateTime retryDate(value, Aws::Utils::DateFormat::RFC822);
+        if (!retryDate.WasParseSuccessful())
+        {
+            return std::chrono::milliseconds(0);
+        }
+
+        retryAfter = std::chrono::milliseconds(retryDate.Millis()) - std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
+    }
+
+    return (std::max)(std::chrono::milliseconds(0), (std::min)(retryAfter, MAX_RETRY_AFTER));
+}
+#pragma endregion
+
 #pragma region ExponentialBackoffStrategy Public Methods
-ExponentialBackoffStrategy::ExponentialBackoffStrategy(unsigned int maxAttempts, FuncLogCallback logCb) : tickCounter(0), currentStep(0), retryThreshold(0), maxAttempts(maxAttempts), logCb(logCb)
+ExponentialBackoffStrategy::ExponentialBackoffStrategy(std::chrono::milliseconds minDelay, std::chrono::milliseconds maxDelay, FuncLogCallback logCb, SteadyClock clock) :
+    minDelay((std::max)(minDelay, std::chrono::milliseconds(1))),
+    maxDelay((std::max)(this->minDelay, maxDelay)),
+    currentDelay(this->minDelay),
+    retryTime(),
+    randomEngine(std::random_device()() ^ static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count())),
+    logCb(logCb),
+    clock(clock)
 {}
 
 ExponentialBackoffStrategy::~ExponentialBackoffStrategy()
@@ -366,28 +420,45 @@ ExponentialBackoffStrategy::~ExponentialBackoffStrategy()
 
 void ExponentialBackoffStrategy::IncreaseThreshold()
 {
-    currentStep++;
-    retryThreshold = pow(2, currentStep);
-    retryThreshold = (std::rand() % retryThreshold) + 1;
+    std::lock_guard<std::mutex> lock(strategyMutex);
 
-    std::string message = "ExponentialBackoffStrategy step " + std::to_string(currentStep) + ", next retry threshold " + std::to_string(retryThreshold);
-    Logging::Log(logCb, Level::Verbose, message.c_str());
+    // Decorrelated jitter: the next delay depends on the previous one, so clients that failed together drift apart
+    std::uniform_int_distribution<long long> delayDistribution(minDelay.count(), currentDelay.count() * 3);
+    currentDelay = (std::min)(maxDelay, std::chrono::milliseconds(delayDistribution(randomEngine)));
+    retryTime = clock() + currentDelay;
+
+    GAMEKIT_LOG(logCb, Level::Verbose, "ExponentialBackoffStrategy next retry in (ms) " + std::to_string(currentDelay.count()));
 }
 
 bool ExponentialBackoffStrategy::ShouldRetry()
 {
-    tickCounter++;
-
-    std::string message = "ExponentialBackoffStrategy tick counter " + std::to_string(tickCounter);
-    Logging::Log(logCb, Level::Verbose, message.c_str());
+    std::lock_guard<std::mutex> lock(strategyMutex);
 
-    return tickCounter >= retryThreshold || tickCounter >= maxAttempts;
+    return clock() >= retryTime;
 }
 
 void ExponentialBackoffStrategy::Reset()
 {
-    tickCounter = 0;
-    currentStep = 0;
-    retryThreshold = 0;
+    std::lock_guard<std::mutex> lock(strategyMutex);
+
+    currentDelay = minDelay;
+    retryTime = std::chrono::steady_clock::time_point();
+}
+
+void ExponentialBackoffStrategy::SetRetryAfter(std::chrono::milliseconds retryAfter)
+{
+    std::lock_guard<std::mutex> lock(strategyMutex);
+
+    retryTime = (std::max)(retryTime, clock() + retryAfter);
+
+    GAMEKIT_LOG(logCb, Level::Verbose, "ExponentialBackoffStrategy server requested retry after (ms) " + std::to_string(retryAfter.count()));
+}
+
+std::chrono::milliseconds ExponentialBackoffStrategy::GetTimeUntilRetry() const
+{
+    std::lock_guard<std::mutex> lock(strategyMutex);
+
+    const auto timeLeft = retryTime - clock();
+    return timeLeft.count() > 0 ? std::chrono::ceil<std::chrono::milliseconds>(timeLeft) : std::chrono::milliseconds(0);
 }
 #pragma endregion
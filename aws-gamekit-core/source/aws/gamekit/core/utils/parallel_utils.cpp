@@ -0,0 +1,64 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
+
+using namespace GameKit::Utils;
+
+unsigned int ParallelUtils::RunTasks(const std::vector<std::function<unsigned int()>>& tasks, size_t maxConcurrency)
+{
+    std::atomic<size_t> nextTask(0);
+    std::atomic<bool> failed(false);
+    std::mutex resultMutex;
+    unsigned int firstError = GAMEKIT_SUCCESS;
+
+    auto worker = [&]()
+    {
+        size_t taskIndex;
+        while (!failed && (taskIndex = nextTask++) < tasks.size())
+        {
+            const unsigned int result = tasks[taskIndex]();
+            if (result != GAMEKIT_SUCCESS)
+            {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (!failed)
+                {
+                    firstError = result;
+                    failed = true;
+                }
+            }
+        }
+    };
+
+    const size_t workerCount = std::min(std::max(maxConcurrency, (size_t)1), tasks.size());
+    if (workerCount <= 1)
+    {
+        worker();
+        return firstError;
+    }
+
+    // The calling thread is one of the workers
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t i = 1; i < workerCount; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread& thread : workers)
+    {
+        thread.join();
+    }
+
+    return firstError;
+}
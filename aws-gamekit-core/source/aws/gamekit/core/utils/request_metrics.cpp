@@ -0,0 +1,290 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+
+// GameKit
+#include <aws/gamekit/core/utils/request_metrics.h>
+
+using namespace GameKit::Utils;
+
+namespace
+{
+    // Open addressing table of endpoints. Slots only ever go from empty to set, which is what lets lookups skip the lock.
+    static const size_t ENDPOINT_TABLE_SIZE = 256;
+    static const size_t MAX_ENDPOINTS = ENDPOINT_TABLE_SIZE * 3 / 4;
+
+    // The last endpoint is kept for the one shared by the names that don't fit. Keep in sync with RequestMetrics::GetEndpoint()'s doc.
+    static const size_t MAX_NAMED_ENDPOINTS = MAX_ENDPOINTS - 1;
+    static const char* const OTHER_ENDPOINT_NAME = "Other";
+
+    struct EndpointTable
+    {
+        std::atomic<RequestMetrics::Endpoint*> Slots[ENDPOINT_TABLE_SIZE] = {};
+        std::mutex RegistrationMutex;
+        size_t EndpointCount = 0; // Guarded by RegistrationMutex
+    };
+
+    EndpointTable& getEndpointTable()
+    {
+        // Endpoints are never freed, so references handed out stay valid during static destruction
+        static EndpointTable* endpointTable = new EndpointTable();
+        return *endpointTable;
+    }
+
+    RequestMetrics::Endpoint* findEndpoint(EndpointTable& table, const std::string& name, size_t& returnedFreeSlot)
+    {
+        const size_t hash = std::hash<std::string>()(name);
+        for (size_t probe = 0; probe < ENDPOINT_TABLE_SIZE; ++probe)
+        {
+            const size_t slot = (hash + probe) % ENDPOINT_TABLE_SIZE;
+            RequestMetrics::Endpoint* endpoint = table.Slots[slot].load(std::memory_order_acquire);
+            if (endpoint == nullptr)
+            {
+                returnedFreeSlot = slot;
+                return nullptr;
+            }
+
+            if (endpoint->GetName() == name)
+            {
+                return endpoint;
+            }
+        }
+
+        returnedFreeSlot = ENDPOINT_TABLE_SIZE;
+        return nullptr;
+    }
+
+    // Must be called with RegistrationMutex held
+    RequestMetrics::Endpoint& registerEndpoint(EndpointTable& table, const std::string& name)
+    {
+        size_t freeSlot;
+        RequestMetrics::Endpoint* endpoint = findEndpoint(table, name, freeSlot);
+        if (endpoint != nullptr)
+        {
+            return *endpoint;
+        }
+
+        if (table.EndpointCount >= MAX_NAMED_ENDPOINTS && name != OTHER_ENDPOINT_NAME)
+        {
+            return registerEndpoint(table, OTHER_ENDPOINT_NAME);
+        }
+
+        endpoint = new RequestMetrics::Endpoint(name);
+        table.Slots[freeSlot].store(endpoint, std::memory_order_release);
+        ++table.EndpointCount;
+        return *endpoint;
+    }
+
+    unsigned long long getContentLength(const Aws::Http::HttpRequest& request)
+    {
+        return request.HasContentLength() ? std::strtoull(request.GetContentLength().c_str(), nullptr, 10) : 0;
+    }
+
+    unsigned long long getContentLength(const Aws::Http::HttpResponse& response)
+    {
+        return response.HasHeader(Aws::Http::CONTENT_LENGTH_HEADER) ? std::strtoull(response.GetHeader(Aws::Http::CONTENT_LENGTH_HEADER).c_str(), nullptr, 10) : 0;
+    }
+
+    unsigned long long read(std::atomic<unsigned long long>& counter, bool reset)
+    {
+        return reset ? counter.exchange(0, std::memory_order_relaxed) : counter.load(std::memory_order_relaxed);
+    }
+}
+
+#pragma region Endpoint
+RequestMetrics::Endpoint::Endpoint(std::string name) : m_name(std::move(name))
+{
+    for (std::atomic<unsigned long long>& bucket : m_latencyBuckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void RequestMetrics::Endpoint::RecordRequest(std::chrono::microseconds latency, Aws::Http::HttpResponseCode responseCode, unsigned long long bytesSent, unsigned long long bytesReceived)
+{
+    const unsigned long long microseconds = latency.count() > 0 ? (unsigned long long)latency.count() : 0;
+    const int code = static_cast<int>(responseCode);
+
+    m_requestCount.fetch_add(1, std::memory_order_relaxed);
+    if (code < 200 || code >= 300)
+    {
+        m_failedRequestCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_bytesSent.fetch_add(bytesSent, std::memory_order_relaxed);
+    m_bytesReceived.fetch_add(bytesReceived, std::memory_order_relaxed);
+
+    m_latencyBuckets[GetLatencyBucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    m_latencySum.fetch_add(microseconds, std::memory_order_relaxed);
+    unsigned long long max = m_latencyMax.load(std::memory_order_relaxed);
+    while (microseconds > max && !m_latencyMax.compare_exchange_weak(max, microseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RequestMetrics::Endpoint::RecordRetry()
+{
+    m_retryCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::Endpoint::RecordDrop()
+{
+    m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::Endpoint::RecordCacheHit()
+{
+    m_cacheHitCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::Endpoint::RecordCacheMiss()
+{
+    m_cacheMissCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::Endpoint::AddQueueDepth(long long delta)
+{
+    m_queueDepth.fetch_add(delta, std::memory_order_relaxed);
+}
+
+GameKit::RequestMetricsSnapshot RequestMetrics::Endpoint::Snapshot(bool reset)
+{
+    RequestMetricsSnapshot snapshot = {};
+    snapshot.endpoint = m_name.c_str();
+    snapshot.requestCount = read(m_requestCount, reset);
+    snapshot.failedRequestCount = read(m_failedRequestCount, reset);
+    snapshot.retryCount = read(m_retryCount, reset);
+    snapshot.droppedCount = read(m_droppedCount, reset);
+    snapshot.queueDepth = m_queueDepth.load(std::memory_order_relaxed);
+    snapshot.bytesSent = read(m_bytesSent, reset);
+    snapshot.bytesReceived = read(m_bytesReceived, reset);
+    snapshot.cacheHitCount = read(m_cacheHitCount, reset);
+    snapshot.cacheMissCount = read(m_cacheMissCount, reset);
+    snapshot.latencyMaxMicroseconds = read(m_latencyMax, reset);
+    const unsigned long long latencySum = read(m_latencySum, reset);
+
+    unsigned long long buckets[LATENCY_BUCKET_COUNT];
+    unsigned long long latencyCount = 0;
+    for (unsigned int i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+    {
+        buckets[i] = read(m_latencyBuckets[i], reset);
+        latencyCount += buckets[i];
+    }
+
+    if (latencyCount == 0)
+    {
+        return snapshot;
+    }
+
+    snapshot.latencyMeanMicroseconds = latencySum / latencyCount;
+
+    // Each percentile is the highest value of the bucket holding its rank, capped by the largest recorded value
+    const double percentiles[] = { 0.5, 0.9, 0.99 };
+    unsigned long long* const results[] = { &snapshot.latencyP50Microseconds, &snapshot.latencyP90Microseconds, &snapshot.latencyP99Microseconds };
+    unsigned long long cumulativeCount = 0;
+    size_t percentile = 0;
+    for (unsigned int i = 0; i < LATENCY_BUCKET_COUNT && percentile < 3; ++i)
+    {
+        cumulativeCount += buckets[i];
+        while (percentile < 3 && cumulativeCount >= std::max(1.0, std::ceil(percentiles[percentile] * latencyCount)))
+        {
+            *results[percentile] = std::min(GetLatencyBucketUpperBound(i), snapshot.latencyMaxMicroseconds);
+            ++percentile;
+        }
+    }
+
+    return snapshot;
+}
+
+unsigned int RequestMetrics::Endpoint::GetLatencyBucketIndex(unsigned long long microseconds)
+{
+    if (microseconds < LATENCY_SUB_BUCKET_COUNT)
+    {
+        return (unsigned int)microseconds;
+    }
+
+    if ((microseconds >> (LATENCY_MAX_EXPONENT + 1)) != 0)
+    {
+        return LATENCY_BUCKET_COUNT - 1;
+    }
+
+    unsigned int exponent = LATENCY_SUB_BUCKET_BITS;
+    while ((microseconds >> (exponent + 1)) != 0)
+    {
+        ++exponent;
+    }
+
+    // The highest bit selects the power of two, the next LATENCY_SUB_BUCKET_BITS bits select the sub-bucket
+    const unsigned int subBucket = (unsigned int)(microseconds >> (exponent - LATENCY_SUB_BUCKET_BITS)) - LATENCY_SUB_BUCKET_COUNT;
+    return LATENCY_SUB_BUCKET_COUNT * (exponent - LATENCY_SUB_BUCKET_BITS + 1) + subBucket;
+}
+
+unsigned long long RequestMetrics::Endpoint::GetLatencyBucketUpperBound(unsigned int bucketIndex)
+{
+    if (bucketIndex < LATENCY_SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+
+    const unsigned int exponent = bucketIndex / LATENCY_SUB_BUCKET_COUNT - 1 + LATENCY_SUB_BUCKET_BITS;
+    const unsigned long long subBucket = bucketIndex % LATENCY_SUB_BUCKET_COUNT;
+    return ((LATENCY_SUB_BUCKET_COUNT + subBucket + 1) << (exponent - LATENCY_SUB_BUCKET_BITS)) - 1;
+}
+#pragma endregion
+
+#pragma region RequestMetrics
+RequestMetrics::Endpoint& RequestMetrics::GetEndpoint(const std::string& name)
+{
+    EndpointTable& table = getEndpointTable();
+    size_t freeSlot;
+    Endpoint* endpoint = findEndpoint(table, name, freeSlot);
+    if (endpoint != nullptr)
+    {
+        return *endpoint;
+    }
+
+    // Another thread may register the same name in the meantime, registration looks it up again under the lock
+    std::lock_guard<std::mutex> lock(table.RegistrationMutex);
+    return registerEndpoint(table, name);
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> RequestMetrics::MakeRequest(Aws::Http::HttpClient& client, const std::shared_ptr<Aws::Http::HttpRequest>& request, Endpoint& endpoint)
+{
+    const auto requestStart = std::chrono::steady_clock::now();
+    std::shared_ptr<Aws::Http::HttpResponse> response = client.MakeRequest(request);
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - requestStart);
+
+    endpoint.RecordRequest(latency,
+        response != nullptr ? response->GetResponseCode() : Aws::Http::HttpResponseCode::REQUEST_NOT_MADE,
+        getContentLength(*request),
+        response != nullptr ? getContentLength(*response) : 0);
+
+    return response;
+}
+
+void RequestMetrics::Snapshot(std::vector<RequestMetricsSnapshot>& returnedSnapshots, bool reset)
+{
+    returnedSnapshots.clear();
+
+    EndpointTable& table = getEndpointTable();
+    for (std::atomic<Endpoint*>& slot : table.Slots)
+    {
+        Endpoint* endpoint = slot.load(std::memory_order_acquire);
+        if (endpoint != nullptr)
+        {
+            returnedSnapshots.push_back(endpoint->Snapshot(reset));
+        }
+    }
+
+    std::sort(returnedSnapshots.begin(), returnedSnapshots.end(), [](const RequestMetricsSnapshot& lhs, const RequestMetricsSnapshot& rhs)
+    {
+        return std::strcmp(lhs.endpoint, rhs.endpoint) < 0;
+    });
+}
+#pragma endregion
@@ -0,0 +1,154 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <ctime>
+#include <mutex>
+
+// GameKit
+#include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
+#include <aws/gamekit/core/model/template_consts.h>
+#include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/template_utils.h>
+
+// Boost
+#include <boost/filesystem.hpp>
+
+using namespace GameKit;
+using namespace GameKit::Utils;
+
+namespace
+{
+    struct CachedTemplate
+    {
+        uintmax_t FileSize;
+        std::time_t LastWriteTime;
+        std::shared_ptr<const ParsedTemplate> Template;
+    };
+
+    std::mutex& getTemplateCacheMutex()
+    {
+        static std::mutex templateCacheMutex;
+        return templateCacheMutex;
+    }
+
+    std::unordered_map<std::string, CachedTemplate>& getTemplateCache()
+    {
+        static std::unordered_map<std::string, CachedTemplate> templateCache;
+        return templateCache;
+    }
+}
+
+#pragma region ParsedTemplate
+ParsedTemplate::ParsedTemplate(std::string source) : m_source(std::move(source))
+{
+    size_t literalStart = 0;
+    size_t pos = 0;
+    while ((pos = m_source.find(TemplateVars::BEGIN_NO_ESCAPE, pos)) != std::string::npos)
+    {
+        // With more than two opening braces the placeholder starts at the last two, e.g. "{{{NAME}}" is "{" followed by "{{NAME}}"
+        size_t nameStart = pos + TemplateVars::BEGIN_NO_ESCAPE.size();
+        while (nameStart < m_source.size() && m_source[nameStart] == '{')
+        {
+            ++pos;
+            ++nameStart;
+        }
+
+        const size_t nameEnd = m_source.find_first_of("{}\r\n", nameStart);
+        if (nameEnd == std::string::npos)
+        {
+            break;
+        }
+
+        if (nameEnd == nameStart || m_source.compare(nameEnd, TemplateVars::END_NO_ESCAPE.size(), TemplateVars::END_NO_ESCAPE) != 0)
+        {
+            // Not a placeholder, keep scanning from the character that ended the name
+            pos = nameEnd;
+            continue;
+        }
+
+        if (pos > literalStart)
+        {
+            m_segments.push_back({ literalStart, pos - literalStart, std::string() });
+        }
+
+        const size_t placeholderEnd = nameEnd + TemplateVars::END_NO_ESCAPE.size();
+        m_segments.push_back({ pos, placeholderEnd - pos, m_source.substr(nameStart, nameEnd - nameStart) });
+        literalStart = pos = placeholderEnd;
+    }
+
+    if (literalStart < m_source.size())
+    {
+        m_segments.push_back({ literalStart, m_source.size() - literalStart, std::string() });
+    }
+}
+
+std::string ParsedTemplate::Render(const std::unordered_map<std::string, std::string>& values) const
+{
+    std::string rendered;
+    rendered.reserve(m_source.size());
+
+    for (const Segment& segment : m_segments)
+    {
+        if (!segment.Name.empty())
+        {
+            const auto value = values.find(segment.Name);
+            if (value != values.end())
+            {
+                rendered.append(value->second);
+                continue;
+            }
+        }
+
+        rendered.append(m_source, segment.Offset, segment.Length);
+    }
+
+    return rendered;
+}
+#pragma endregion
+
+#pragma region TemplateUtils
+unsigned int TemplateUtils::LoadTemplate(const std::string& filePath, std::shared_ptr<const ParsedTemplate>& returnedTemplate, FuncLogCallback logCallback)
+{
+    boost::system::error_code sizeError;
+    boost::system::error_code timeError;
+    const boost::filesystem::path path(filePath);
+    const uintmax_t fileSize = boost::filesystem::file_size(path, sizeError);
+    const std::time_t lastWriteTime = boost::filesystem::last_write_time(path, timeError);
+    const bool cacheable = !sizeError && !timeError;
+
+    if (cacheable)
+    {
+        std::lock_guard<std::mutex> lock(getTemplateCacheMutex());
+        const auto cached = getTemplateCache().find(filePath);
+        if (cached != getTemplateCache().end() && cached->second.FileSize == fileSize && cached->second.LastWriteTime == lastWriteTime)
+        {
+            returnedTemplate = cached->second.Template;
+            return GAMEKIT_SUCCESS;
+        }
+    }
+
+    // Parse outside the lock, concurrent loads of the same file simply parse it twice
+    std::string source;
+    const unsigned int result = FileUtils::ReadFileIntoString(filePath, source, logCallback, "TemplateUtils::LoadTemplate() ");
+    returnedTemplate = std::make_shared<const ParsedTemplate>(std::move(source));
+    if (result != GAMEKIT_SUCCESS)
+    {
+        return result;
+    }
+
+    if (cacheable)
+    {
+        std::lock_guard<std::mutex> lock(getTemplateCacheMutex());
+        getTemplateCache()[filePath] = { fileSize, lastWriteTime, returnedTemplate };
+    }
+
+    return GAMEKIT_SUCCESS;
+}
+
+void TemplateUtils::InvalidateTemplate(const std::string& filePath)
+{
+    std::lock_guard<std::mutex> lock(getTemplateCacheMutex());
+    getTemplateCache().erase(filePath);
+}
+#pragma endregion
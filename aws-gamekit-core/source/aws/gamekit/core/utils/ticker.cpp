@@ -1,6 +1,10 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <algorithm>
+
+// GameKit
 #include <aws/gamekit/core/utils/ticker.h>
 #include <aws/gamekit/core/utils/debug.h>
 
@@ -40,6 +44,18 @@ void GameKit::Utils::Ticker::OnDestroy()
 }
 #pragma endregion
 
+#pragma region Protected Methods
+void Ticker::startNewInterval(std::chrono::milliseconds interval)
+{
+    startNewInterval(static_cast<int>(std::chrono::ceil<std::chrono::seconds>(interval).count()));
+}
+
+std::chrono::milliseconds Ticker::getIntervalTimeLeft() const
+{
+    return std::chrono::milliseconds(TICKER_PULSE);
+}
+#pragma endregion
+
 #pragma region Public Methods
 void Ticker::Start()
 {
@@ -60,24 +76,26 @@ void Ticker::Start()
     m_isRunning = true;
     m_funcThread = std::thread([&]()
     {
-        std::chrono::milliseconds pulse{ TICKER_PULSE };
-        startNewInterval(m_interval);
+        const std::chrono::milliseconds pulse{ TICKER_PULSE };
+        startNewInterval(std::chrono::milliseconds(std::chrono::seconds(m_interval)));
 
         while (m_isRunning && !m_aborted)
         {
-            // Wake the ticker every TICKER_PULSE and count down the current interval
-            std::this_thread::sleep_for(pulse);
-            countDownInterval(pulse);
+            // Wake the ticker at least every TICKER_PULSE, or when the current interval ends, and count down the current interval
+            const std::chrono::milliseconds sleepTime = (std::max)(std::chrono::milliseconds(1), (std::min)(pulse, getIntervalTimeLeft()));
+            std::this_thread::sleep_for(sleepTime);
+            countDownInterval(sleepTime);
 
             if (isIntervalOver())
             {
                 // execute the tickFunc
+                m_nextTickDelay = std::chrono::milliseconds(0);
                 m_threadId = std::this_thread::get_id();
                 m_tickFunc();
                 m_threadId = std::thread::id();
 
                 // set the next intervalEndTime
-                startNewInterval(m_interval);
+                startNewInterval(m_nextTickDelay.count() > 0 ? m_nextTickDelay : std::chrono::milliseconds(std::chrono::seconds(m_interval)));
             }
         }
         Logging::Log(m_logCb, Level::Info, "Ticker::Stop(): Ticker loop exited.", this);
@@ -140,4 +158,13 @@ void Ticker::RescheduleLoop(int newInterval)
     buffer << "Ticker::RescheduleLoop(): Interval: " << m_interval;
     Logging::Log(m_logCb, Level::Info, buffer.str().c_str(), this);
 }
+void Ticker::RescheduleNextTick(std::chrono::milliseconds delay)
+{
+    // Check that this is called inside the tick function
+    GameKitInternalAssert(std::this_thread::get_id() == m_threadId);
+
+    m_nextTickDelay = delay;
+
+    GAMEKIT_LOG(m_logCb, Level::Verbose, "Ticker::RescheduleNextTick(): Delay (ms): " + std::to_string(delay.count()), this);
+}
 #pragma endregion
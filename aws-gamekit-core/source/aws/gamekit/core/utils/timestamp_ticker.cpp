@@ -13,7 +13,12 @@ TimestampTicker::~TimestampTicker()
 #pragma region Protected Methods
 void TimestampTicker::startNewInterval(int intervalSeconds)
 {
-    m_intervalEndTime = std::chrono::steady_clock::now() + std::chrono::seconds(intervalSeconds);
+    m_intervalEndTime = m_clock() + std::chrono::seconds(intervalSeconds);
+}
+
+void TimestampTicker::startNewInterval(std::chrono::milliseconds interval)
+{
+    m_intervalEndTime = m_clock() + interval;
 }
 
 void TimestampTicker::countDownInterval(std::chrono::milliseconds sleepTime)
@@ -23,6 +28,13 @@ void TimestampTicker::countDownInterval(std::chrono::milliseconds sleepTime)
 
 bool TimestampTicker::isIntervalOver() const
 {
-    return std::chrono::steady_clock::now() >= m_intervalEndTime;
+    return m_clock() >= m_intervalEndTime;
+}
+
+std::chrono::milliseconds TimestampTicker::getIntervalTimeLeft() const
+{
+    // Rounded up so the thread doesn't wake up a fraction of a millisecond before the end of the interval
+    const auto timeLeft = m_intervalEndTime - m_clock();
+    return timeLeft.count() > 0 ? std::chrono::ceil<std::chrono::milliseconds>(timeLeft) : std::chrono::milliseconds(0);
 }
 #pragma endregion
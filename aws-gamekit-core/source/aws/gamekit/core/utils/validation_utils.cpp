@@ -5,6 +5,61 @@
 
 using namespace GameKit::Utils;
 
+namespace
+{
+    // Set of accepted characters, indexed by the unsigned value of the character
+    struct CharacterClass
+    {
+        bool Accepted[256];
+    };
+
+    // Alphanumeric characters plus the given symbols, the same set as the bracket expression "[a-zA-Z0-9<symbols>]"
+    constexpr CharacterClass makeCharacterClass(const char* symbols)
+    {
+        CharacterClass characterClass{};
+        for (int c = 'a'; c <= 'z'; ++c)
+        {
+            characterClass.Accepted[c] = true;
+            characterClass.Accepted[c - 'a' + 'A'] = true;
+        }
+
+        for (int c = '0'; c <= '9'; ++c)
+        {
+            characterClass.Accepted[c] = true;
+        }
+
+        for (const char* symbol = symbols; *symbol != '\0'; ++symbol)
+        {
+            characterClass.Accepted[static_cast<unsigned char>(*symbol)] = true;
+        }
+
+        return characterClass;
+    }
+
+    // Built at compile time, replace the patterns "[a-zA-Z0-9-_.~]+", "[a-zA-Z0-9-_.*'()]+" and PRIMARY_IDENTIFIER_REGEX
+    constexpr CharacterClass URL_PARAM_CHARACTERS = makeCharacterClass("-_.~");
+    constexpr CharacterClass S3_KEY_PARAM_CHARACTERS = makeCharacterClass("-_.*'()");
+    constexpr CharacterClass PRIMARY_IDENTIFIER_CHARACTERS = makeCharacterClass("-_.");
+
+    bool hasOnlyCharacters(const char* str, size_t length, const CharacterClass& characterClass)
+    {
+        // Accumulate without branching so the compiler can unroll the loop, strings are at most a few hundred characters
+        const unsigned char* characters = reinterpret_cast<const unsigned char*>(str);
+        bool valid = true;
+        for (size_t i = 0; i < length; ++i)
+        {
+            valid &= characterClass.Accepted[characters[i]];
+        }
+
+        return valid;
+    }
+
+    bool isValidParam(const char* str, size_t length, size_t minLength, size_t maxLength, const CharacterClass& characterClass)
+    {
+        return length >= minLength && length <= maxLength && hasOnlyCharacters(str, length, characterClass);
+    }
+}
+
 #pragma region Public Methods
 std::string ValidationUtils::UrlEncode(const std::string& urlParameter) {
     std::ostringstream escaped;
@@ -55,30 +110,34 @@ bool ValidationUtils::IsValidString(const std::string& str, const std::regex& pa
 
 bool ValidationUtils::IsValidUrlParam(const std::string& urlParam)
 {
-    if (urlParam.length() < MIN_URL_PARAM_CHARS || urlParam.length() > MAX_URL_PARAM_CHARS)
-    {
-        return false;
-    }
-    return ValidationUtils::IsValidString(urlParam, std::regex("[a-zA-Z0-9-_.~]+"));
+    return isValidParam(urlParam.c_str(), urlParam.length(), MIN_URL_PARAM_CHARS, MAX_URL_PARAM_CHARS, URL_PARAM_CHARACTERS);
 }
 
 bool ValidationUtils::IsValidS3KeyParam(const std::string& s3KeyParam)
 {
-    if (s3KeyParam.length() < MIN_S3_PARAM_CHARS || s3KeyParam.length() > MAX_S3_PARAM_CHARS)
-    {
-        return false;
-    }
-    return ValidationUtils::IsValidString(s3KeyParam, std::regex("[a-zA-Z0-9-_.*'()]+"));
+    return isValidParam(s3KeyParam.c_str(), s3KeyParam.length(), MIN_S3_PARAM_CHARS, MAX_S3_PARAM_CHARS, S3_KEY_PARAM_CHARACTERS);
 }
 
 bool ValidationUtils::IsValidPrimaryIdentifier(const std::string& identifier)
 {
-    if (identifier.length() < MIN_PRIMARY_IDENTIFIER_CHARS || identifier.length() > MAX_PRIMARY_IDENTIFIER_CHARS)
+    return isValidParam(identifier.c_str(), identifier.length(), MIN_PRIMARY_IDENTIFIER_CHARS, MAX_PRIMARY_IDENTIFIER_CHARS, PRIMARY_IDENTIFIER_CHARACTERS);
+}
+
+bool ValidationUtils::IsValidPrimaryIdentifier(const char* identifier)
+{
+    if (identifier == nullptr)
     {
         return false;
     }
 
-    return ValidationUtils::IsValidString(identifier, std::regex(PRIMARY_IDENTIFIER_REGEX));
+    // Don't scan past the longest valid identifier
+    size_t length = 0;
+    while (length <= static_cast<size_t>(MAX_PRIMARY_IDENTIFIER_CHARS) && identifier[length] != '\0')
+    {
+        ++length;
+    }
+
+    return isValidParam(identifier, length, MIN_PRIMARY_IDENTIFIER_CHARS, MAX_PRIMARY_IDENTIFIER_CHARS, PRIMARY_IDENTIFIER_CHARACTERS);
 }
 
 #pragma endregion
@@ -3,10 +3,26 @@
 
 // Standard library
 #include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+
+// AWS SDK
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 // GameKit
+#include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
 #include <aws/gamekit/core/zipper.h>
 
 // Boost
@@ -22,10 +38,313 @@
 
 using namespace GameKit;
 
+// Defined with the miniz implementation details at the end of this file
+static mz_bool mz_zip_writer_set_last_file_modified_time(mz_zip_archive* pZip, const char* pSrc_filename);
+
+namespace
+{
+    // Files are read, hashed and compressed in batches on a worker pool, then written to the archive in directory order.
+    // A batch holds files until their total size reaches this limit, or a single file of any size.
+    static const size_t MAX_ZIP_WORKERS = 4;
+    static const uintmax_t MAX_ZIP_BATCH_BYTES = 64ull * 1024 * 1024;
+
+    // Largest file miniz can add without zip64 support
+    static const uintmax_t MAX_ZIP_ENTRY_BYTES = 0xFFFFFFFF;
+
+    // When the entry cache grows past this size, the least recently used entries are deleted until it is half this size
+    static const uintmax_t MAX_ENTRY_CACHE_BYTES = 1024ull * 1024 * 1024;
+
+    static const char* ENTRY_CACHE_DIRECTORY_NAME = "gamekit_zip_entries";
+    static const char* ENTRY_CACHE_FILE_EXTENSION = ".deflate";
+
+    // Cached entries start with this header, so an empty or truncated entry is never mistaken for a valid one.
+    // The header is followed by the deflated data, or by nothing when deflating doesn't make the file smaller and it is stored as is.
+    static const unsigned char ENTRY_CACHE_MAGIC[] = { 'G', 'K', 'Z', '1' };
+    static const unsigned char ENTRY_CACHE_STORED = 0;
+    static const unsigned char ENTRY_CACHE_DEFLATED = 1;
+    static const size_t ENTRY_CACHE_HEADER_SIZE = sizeof(ENTRY_CACHE_MAGIC) + 1;
+
+    struct PreparedEntry
+    {
+        std::string FilePath;
+        std::string PathInZip;
+        uintmax_t FileSize = 0;
+        std::vector<unsigned char> Data; // deflated data, or the file itself when Stored is true
+        mz_uint64 UncompressedSize = 0;
+        mz_uint32 Crc32 = 0;
+        bool Prepared = false;
+        bool Deflated = false; // when Deflated and Stored are false the file is added by miniz directly, files of 3 bytes or less are always stored uncompressed
+        bool Stored = false;
+        bool FromCache = false;
+    };
+
+    std::mutex& getEntryCacheMutex()
+    {
+        static std::mutex entryCacheMutex;
+        return entryCacheMutex;
+    }
+
+    // Cached entries end up in deployed packages, so the default cache is only used when no other user can write to it.
+    // Returns an empty path, which disables the cache, when it can't be created that way.
+    std::string getDefaultEntryCacheDirectory()
+    {
+        boost::system::error_code errorCode;
+        const boost::filesystem::path tempDirectory = boost::filesystem::temp_directory_path(errorCode);
+        if (errorCode)
+        {
+            return std::string();
+        }
+
+#ifdef _WIN32
+        // The temp directory is already in the user's profile
+        const boost::filesystem::path cacheDirectory = tempDirectory / ENTRY_CACHE_DIRECTORY_NAME;
+        boost::filesystem::create_directories(cacheDirectory, errorCode);
+        return errorCode ? std::string() : Utils::FileUtils::PathToUtf8(cacheDirectory.native());
+#else
+        // The temp directory is shared by every user, each one gets a private cache directory in it
+        const boost::filesystem::path cacheDirectory = tempDirectory / (std::string(ENTRY_CACHE_DIRECTORY_NAME) + "-" + std::to_string(getuid()));
+        if (mkdir(cacheDirectory.c_str(), S_IRWXU) != 0 && errno != EEXIST)
+        {
+            return std::string();
+        }
+
+        // A directory created by someone else, or a link to one, is not used
+        struct stat status;
+        if (lstat(cacheDirectory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode) || status.st_uid != getuid() || (status.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+        {
+            return std::string();
+        }
+
+        return cacheDirectory.native();
+#endif
+    }
+
+    std::string& getEntryCacheDirectoryUnlocked()
+    {
+        static std::string entryCacheDirectory = getDefaultEntryCacheDirectory();
+        return entryCacheDirectory;
+    }
+
+    // Deletes the least recently used entries when the cache is too large. Runs once per process and cache directory.
+    void trimEntryCache(const std::string& cacheDirectory)
+    {
+        static std::string trimmedDirectory;
+        {
+            std::lock_guard<std::mutex> lock(getEntryCacheMutex());
+            if (trimmedDirectory == cacheDirectory)
+            {
+                return;
+            }
+            trimmedDirectory = cacheDirectory;
+        }
+
+        boost::system::error_code errorCode;
+        std::vector<std::pair<std::time_t, boost::filesystem::path>> entries;
+        uintmax_t totalSize = 0;
+        for (boost::filesystem::directory_iterator dirIterator(Utils::FileUtils::PathFromUtf8(cacheDirectory), errorCode), endIterator; !errorCode && dirIterator != endIterator; dirIterator.increment(errorCode))
+        {
+            const boost::filesystem::path cp = (*dirIterator);
+            totalSize += boost::filesystem::file_size(cp, errorCode);
+            entries.emplace_back(boost::filesystem::last_write_time(cp, errorCode), cp);
+        }
+
+        if (totalSize <= MAX_ENTRY_CACHE_BYTES)
+        {
+            return;
+        }
+
+        std::sort(entries.begin(), entries.end());
+        for (const auto& entry : entries)
+        {
+            if (totalSize <= MAX_ENTRY_CACHE_BYTES / 2)
+            {
+                break;
+            }
+
+            const uintmax_t entrySize = boost::filesystem::file_size(entry.second, errorCode);
+            if (boost::filesystem::remove(entry.second, errorCode))
+            {
+                totalSize -= std::min(totalSize, entrySize);
+            }
+        }
+    }
+
+    // Content address of an uncompressed file: hex SHA-256 of its data
+    std::string getEntryCacheKey(const std::vector<unsigned char>& data)
+    {
+        // hash the file in place rather than copy it into a string
+        Aws::Utils::Stream::PreallocatedStreamBuf dataStreamBuf(const_cast<unsigned char*>(data.data()), data.size());
+        Aws::IOStream dataStream(&dataStreamBuf);
+
+        Aws::Utils::Crypto::Sha256 sha256;
+        const auto hashResult = sha256.Calculate(dataStream);
+        return ToStdString(Aws::Utils::HashingUtils::HexEncode(hashResult.GetResult()));
+    }
+
+    // Cached data is only used when it inflates back to exactly the file it is added for
+    bool isValidDeflatedData(const std::vector<unsigned char>& deflatedData, size_t dataOffset, mz_uint64 uncompressedSize, mz_uint32 crc32)
+    {
+        std::vector<unsigned char> inflatedData((size_t)uncompressedSize);
+        size_t inputSize = deflatedData.size() - dataOffset;
+        size_t outputSize = inflatedData.size();
+
+        tinfl_decompressor decompressor;
+        tinfl_init(&decompressor);
+        const tinfl_status status = tinfl_decompress(&decompressor, deflatedData.data() + dataOffset, &inputSize, inflatedData.data(), inflatedData.data(), &outputSize, TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+
+        return status == TINFL_STATUS_DONE && inputSize == deflatedData.size() - dataOffset && outputSize == uncompressedSize
+            && (mz_uint32)mz_crc32(MZ_CRC32_INIT, inflatedData.data(), outputSize) == crc32;
+    }
+
+    bool readFile(const std::string& filePath, std::vector<unsigned char>& returnedData)
+    {
+        std::ifstream file(Utils::FileUtils::PathFromUtf8(filePath), std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+        if (!file)
+        {
+            return false;
+        }
+
+        const std::streamoff size = file.tellg();
+        if (size < 0)
+        {
+            return false;
+        }
+
+        returnedData.resize((size_t)size);
+        file.seekg(0, std::ios_base::beg);
+        return size == 0 || file.read((char*)returnedData.data(), size).good();
+    }
+
+    // Writes to a temporary file first so concurrent readers never see a partially written entry
+    void writeCachedEntry(const boost::filesystem::path& entryPath, unsigned char entryType, const std::vector<unsigned char>& compressedData)
+    {
+        boost::system::error_code errorCode;
+        boost::filesystem::create_directories(entryPath.parent_path(), errorCode);
+
+        const boost::filesystem::path tempPath = entryPath.parent_path() / boost::filesystem::unique_path(entryPath.filename().native() + boost::filesystem::path(".%%%%-%%%%-%%%%-%%%%.tmp").native(), errorCode);
+        if (errorCode)
+        {
+            return;
+        }
+
+        {
+            std::ofstream file(tempPath.native(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+            file.write((const char*)ENTRY_CACHE_MAGIC, sizeof(ENTRY_CACHE_MAGIC));
+            file.put((char)entryType);
+            file.write((const char*)compressedData.data(), compressedData.size());
+            if (!file)
+            {
+                file.close();
+                boost::filesystem::remove(tempPath, errorCode);
+                return;
+            }
+        }
+
+        boost::filesystem::rename(tempPath, entryPath, errorCode);
+        if (errorCode)
+        {
+            boost::filesystem::remove(tempPath, errorCode);
+        }
+    }
+
+    // Reads and deflates a file, or copies its compressed data from the entry cache once it is verified against the file
+    void prepareEntry(PreparedEntry& entry, const std::string& cacheDirectory)
+    {
+        if (entry.FileSize > MAX_ZIP_ENTRY_BYTES)
+        {
+            // too large for miniz which will reject it, don't read it in memory
+            entry.Prepared = true;
+            return;
+        }
+
+        std::vector<unsigned char> data;
+        if (!readFile(entry.FilePath, data))
+        {
+            return;
+        }
+
+        entry.Prepared = true;
+        if (data.size() <= 3 || data.size() > MAX_ZIP_ENTRY_BYTES)
+        {
+            // stored uncompressed, or too large for miniz which will reject it
+            return;
+        }
+
+        entry.UncompressedSize = data.size();
+        entry.Crc32 = (mz_uint32)mz_crc32(MZ_CRC32_INIT, data.data(), data.size());
+
+        boost::filesystem::path entryPath;
+        if (!cacheDirectory.empty())
+        {
+            entryPath = boost::filesystem::path(Utils::FileUtils::PathFromUtf8(cacheDirectory)) / (getEntryCacheKey(data) + ENTRY_CACHE_FILE_EXTENSION);
+
+            std::vector<unsigned char> cachedEntry;
+            if (readFile(Utils::FileUtils::PathToUtf8(entryPath.native()), cachedEntry)
+                && cachedEntry.size() >= ENTRY_CACHE_HEADER_SIZE
+                && std::equal(std::begin(ENTRY_CACHE_MAGIC), std::end(ENTRY_CACHE_MAGIC), cachedEntry.begin()))
+            {
+                const unsigned char entryType = cachedEntry[sizeof(ENTRY_CACHE_MAGIC)];
+                const bool isStored = entryType == ENTRY_CACHE_STORED && cachedEntry.size() == ENTRY_CACHE_HEADER_SIZE;
+                const bool isDeflated = entryType == ENTRY_CACHE_DEFLATED && isValidDeflatedData(cachedEntry, ENTRY_CACHE_HEADER_SIZE, entry.UncompressedSize, entry.Crc32);
+                if (isStored || isDeflated)
+                {
+                    // mark the entry as recently used
+                    boost::system::error_code errorCode;
+                    boost::filesystem::last_write_time(entryPath, std::time(nullptr), errorCode);
+                    entry.FromCache = true;
+                    if (isStored)
+                    {
+                        entry.Data = std::move(data);
+                        entry.Stored = true;
+                    }
+                    else
+                    {
+                        cachedEntry.erase(cachedEntry.begin(), cachedEntry.begin() + ENTRY_CACHE_HEADER_SIZE);
+                        entry.Data = std::move(cachedEntry);
+                        entry.Deflated = true;
+                    }
+
+                    return;
+                }
+            }
+
+            // missing, truncated or corrupt entries are compressed again and overwritten below
+        }
+
+        // same parameters miniz uses when it compresses files itself
+        size_t compressedSize = 0;
+        void* compressedData = tdefl_compress_mem_to_heap(data.data(), data.size(), &compressedSize, tdefl_create_comp_flags_from_zip_params(MZ_DEFAULT_LEVEL, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+        if (compressedData == nullptr)
+        {
+            return;
+        }
+
+        if (compressedSize < data.size())
+        {
+            entry.Data.assign((unsigned char*)compressedData, (unsigned char*)compressedData + compressedSize);
+            entry.Deflated = true;
+        }
+        else
+        {
+            entry.Data = std::move(data);
+            entry.Stored = true;
+        }
+        mz_free(compressedData);
+
+        if (!entryPath.empty())
+        {
+            static const std::vector<unsigned char> storedEntry;
+            writeCachedEntry(entryPath, entry.Deflated ? ENTRY_CACHE_DEFLATED : ENTRY_CACHE_STORED, entry.Deflated ? entry.Data : storedEntry);
+        }
+    }
+}
+
 #pragma region Constructors/Destructor
 Zipper::Zipper(const std::string& sourcePath, const std::string& zipFileName)
 {
     m_sourcePath = sourcePath;
+    m_compressedEntryCount = 0;
+    m_cachedEntryCount = 0;
 
     m_zipFile = new mz_zip_archive{};
     if (!mz_zip_writer_init_file((mz_zip_archive*)m_zipFile, zipFileName.c_str(), 0))
@@ -55,6 +374,7 @@ bool Zipper::AddDirectoryToZipFile(const std::string& directoryPath)
         return false;
     }
 
+    std::vector<std::string> filePaths;
     boost::filesystem::recursive_directory_iterator endIterator;
     for (boost::filesystem::recursive_directory_iterator dirIterator(dp); dirIterator != endIterator; ++dirIterator)
     {
@@ -63,14 +383,11 @@ bool Zipper::AddDirectoryToZipFile(const std::string& directoryPath)
         if (!boost::filesystem::is_directory(cp))
         {
             // Add to zip file; path will become relative to root used to create Zipper instance
-            if (!AddFileToZipFile(Utils::FileUtils::PathToUtf8(cp.native())))
-            {
-                return false;
-            }
+            filePaths.push_back(Utils::FileUtils::PathToUtf8(cp.native()));
         }
     }
 
-    return true;
+    return addFilesToZipFile(filePaths);
 }
 
 bool Zipper::AddFileToZipFile(const std::string& filePath)
@@ -80,16 +397,7 @@ bool Zipper::AddFileToZipFile(const std::string& filePath)
         return false;
     }
 
-    // Compute relative path and store that as filename inside the zip
-    std::string pathInZip = filePath;
-    NormalizePathInZip(pathInZip, m_sourcePath);
-
-    if (pathInZip.length() >= MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE)
-    {
-        return false;
-    }
-
-    return mz_zip_writer_add_file((mz_zip_archive*)m_zipFile, pathInZip.c_str(), filePath.c_str(), nullptr, 0, MZ_DEFAULT_COMPRESSION);
+    return addFilesToZipFile({ filePath });
 }
 
 bool Zipper::CloseZipFile()
@@ -109,6 +417,28 @@ bool Zipper::CloseZipFile()
     return finalized && finished;
 }
 
+size_t Zipper::GetCompressedEntryCount() const
+{
+    return m_compressedEntryCount;
+}
+
+size_t Zipper::GetCachedEntryCount() const
+{
+    return m_cachedEntryCount;
+}
+
+void Zipper::SetEntryCacheDirectory(const std::string& directoryPath)
+{
+    std::lock_guard<std::mutex> lock(getEntryCacheMutex());
+    getEntryCacheDirectoryUnlocked() = directoryPath;
+}
+
+std::string Zipper::GetEntryCacheDirectory()
+{
+    std::lock_guard<std::mutex> lock(getEntryCacheMutex());
+    return getEntryCacheDirectoryUnlocked();
+}
+
 // Determine relative path to be stored internally. On Windows, replace the preferred path "\" with "/"
 void Zipper::NormalizePathInZip(std::string& inOutPathInZip, const std::string& relativeSourcePath)
 {
@@ -147,6 +477,109 @@ void Zipper::NormalizePathInZip(std::string& inOutPathInZip, const std::string&
 }
 #pragma endregion
 
+#pragma region Private Methods
+bool Zipper::addFilesToZipFile(const std::vector<std::string>& filePaths)
+{
+    std::string cacheDirectory;
+    {
+        std::lock_guard<std::mutex> lock(getEntryCacheMutex());
+        cacheDirectory = getEntryCacheDirectoryUnlocked();
+    }
+
+    if (!cacheDirectory.empty())
+    {
+        trimEntryCache(cacheDirectory);
+    }
+
+    size_t batchStart = 0;
+    while (batchStart < filePaths.size())
+    {
+        std::vector<PreparedEntry> entries;
+        uintmax_t batchBytes = 0;
+        for (size_t i = batchStart; i < filePaths.size() && (entries.empty() || batchBytes < MAX_ZIP_BATCH_BYTES); ++i)
+        {
+            PreparedEntry entry;
+            entry.FilePath = filePaths[i];
+
+            // Compute relative path and store that as filename inside the zip
+            entry.PathInZip = entry.FilePath;
+            NormalizePathInZip(entry.PathInZip, m_sourcePath);
+            if (entry.PathInZip.length() >= MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE)
+            {
+                return false;
+            }
+
+            // files that can't be sized are still read, they are counted as empty
+            boost::system::error_code errorCode;
+            entry.FileSize = boost::filesystem::file_size(Utils::FileUtils::PathFromUtf8(entry.FilePath), errorCode);
+            if (errorCode)
+            {
+                entry.FileSize = 0;
+            }
+            else if (entry.FileSize <= MAX_ZIP_ENTRY_BYTES)
+            {
+                batchBytes += entry.FileSize;
+            }
+
+            entries.push_back(std::move(entry));
+        }
+        batchStart += entries.size();
+
+        std::vector<std::function<unsigned int()>> tasks;
+        for (PreparedEntry& entry : entries)
+        {
+            tasks.push_back([&entry, &cacheDirectory]()
+            {
+                prepareEntry(entry, cacheDirectory);
+                return GAMEKIT_SUCCESS;
+            });
+        }
+
+        Utils::ParallelUtils::RunTasks(tasks, MAX_ZIP_WORKERS);
+
+        for (const PreparedEntry& entry : entries)
+        {
+            if (!entry.Prepared)
+            {
+                return false;
+            }
+
+            mz_zip_archive* zipFile = (mz_zip_archive*)m_zipFile;
+            if (!entry.Deflated && !entry.Stored)
+            {
+                if (!mz_zip_writer_add_file(zipFile, entry.PathInZip.c_str(), entry.FilePath.c_str(), nullptr, 0, MZ_DEFAULT_COMPRESSION))
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            // copy the deflated data verbatim, or store the file when deflating doesn't make it smaller,
+            // then keep the file's own timestamp like mz_zip_writer_add_file() does
+            const mz_bool added = entry.Deflated
+                ? mz_zip_writer_add_mem_ex(zipFile, entry.PathInZip.c_str(), entry.Data.data(), entry.Data.size(), nullptr, 0, MZ_DEFAULT_LEVEL | MZ_ZIP_FLAG_COMPRESSED_DATA, entry.UncompressedSize, entry.Crc32)
+                : mz_zip_writer_add_mem_ex(zipFile, entry.PathInZip.c_str(), entry.Data.data(), entry.Data.size(), nullptr, 0, MZ_NO_COMPRESSION, 0, 0);
+            if (!added || !mz_zip_writer_set_last_file_modified_time(zipFile, entry.FilePath.c_str()))
+            {
+                return false;
+            }
+
+            if (entry.FromCache)
+            {
+                ++m_cachedEntryCount;
+            }
+            else
+            {
+                ++m_compressedEntryCount;
+            }
+        }
+    }
+
+    return true;
+}
+#pragma endregion
+
 #pragma region Implementation details for miniz
 static FILE* mz_fopen(const char* pFilenameUtf8, const char* pMode)
 {
@@ -188,4 +621,23 @@ static int mz_stat(const char* pFilenameUtf8, struct stat* pStat)
 
 #include "miniz.inc"
 
+// Sets the modified time of the last file added to the archive, in both its local and central directory headers
+static mz_bool mz_zip_writer_set_last_file_modified_time(mz_zip_archive* pZip, const char* pSrc_filename)
+{
+    mz_uint16 dos_time = 0, dos_date = 0;
+    if ((!pZip) || (!pZip->m_pState) || (pZip->m_total_files == 0) || (!mz_zip_get_file_modified_time(pSrc_filename, &dos_time, &dos_date)))
+        return MZ_FALSE;
+
+    mz_zip_internal_state* pState = pZip->m_pState;
+    mz_uint8* pCentral_header = &MZ_ZIP_ARRAY_ELEMENT(&pState->m_central_dir, mz_uint8, MZ_ZIP_ARRAY_ELEMENT(&pState->m_central_dir_offsets, mz_uint32, pZip->m_total_files - 1));
+    MZ_WRITE_LE16(pCentral_header + MZ_ZIP_CDH_FILE_TIME_OFS, dos_time);
+    MZ_WRITE_LE16(pCentral_header + MZ_ZIP_CDH_FILE_DATE_OFS, dos_date);
+
+    mz_uint8 local_time_and_date[4];
+    MZ_WRITE_LE16(local_time_and_date, dos_time);
+    MZ_WRITE_LE16(local_time_and_date + 2, dos_date);
+    const mz_uint64 local_header_ofs = MZ_READ_LE32(pCentral_header + MZ_ZIP_CDH_LOCAL_HEADER_OFS);
+    return pZip->m_pWrite(pZip->m_pIO_opaque, local_header_ofs + MZ_ZIP_LDH_FILE_TIME_OFS, local_time_and_date, sizeof(local_time_and_date)) == sizeof(local_time_and_date);
+}
+
 #pragma endregion
@@ -9,6 +9,7 @@
 // GameKit
 #include <aws/gamekit/core/gamekit_feature.h>
 #include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 #include <aws/gamekit/authentication/gamekit_session_manager.h>
 
 namespace GameKit
@@ -57,6 +58,8 @@ namespace GameKit
             FuncLogCallback m_logCb = nullptr;
             std::shared_ptr<Aws::Http::HttpClient>* m_httpClient = nullptr;
 
+            std::shared_ptr<Aws::Http::HttpResponse> makeRequestWithRetries(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& currentFunctionName, Utils::RequestMetrics::Endpoint& metrics) const;
+
         public:
             typedef std::unordered_map<std::string, std::string> CallerParams;
             typedef std::chrono::milliseconds MillisecondDelay;
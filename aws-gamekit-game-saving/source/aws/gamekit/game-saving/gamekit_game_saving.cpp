@@ -4,8 +4,10 @@
 // AWS SDK
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 // GameKit
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/game-saving/gamekit_game_saving.h>
 
@@ -50,13 +52,14 @@ GameSaving::GameSaving(Authentication::GameKitSessionManager* sessionManager, Fu
     GameKit::AwsApiInitializer::Initialize(m_logCb, this);
 
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
-    clientConfig.region = m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_IDENTITY_REGION];
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = m_sessionManager->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
     // Extend timeouts to account for cold lambda starts
     clientConfig.connectTimeoutMs = TIMEOUT;
     clientConfig.httpRequestTimeoutMs = TIMEOUT;
     clientConfig.requestTimeoutMs = TIMEOUT;
-    m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    m_httpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 
     m_currentTimeProvider = std::make_shared<Utils::AwsCurrentTimeProvider>();
 
@@ -111,7 +114,7 @@ unsigned int GameSaving::GetAllSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receive
         m_syncedSlots.at(slot.first).slotSyncStatus = SlotSyncStatus::SHOULD_UPLOAD_LOCAL;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL];
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::GameStateCloudSaving);
 
     // apply bounds to pageSize
     pageSize = pageSize > MAX_PAGE_SIZE ? MAX_PAGE_SIZE : pageSize;
@@ -256,7 +259,7 @@ unsigned int GameSaving::DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavin
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slotName;
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::GameStateCloudSaving) + "/" + slotName;
 
     JsonValue jsonBody;
     unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_DELETE, "DeleteSlot", jsonBody);
@@ -378,9 +381,7 @@ unsigned int GameSaving::LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingD
 #pragma region Private Methods
 bool GameSaving::isPlayerLoggedIn(const std::string& methodName) const
 {
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-
-    if (idToken.empty())
+    if (m_sessionManager->GetTokenSnapshot()->Get(GameKit::TokenType::IdToken).empty())
     {
         const std::string message = "GameSaving::" + methodName + "() No ID token in session.";
         Logging::Log(m_logCb, Level::Error, message.c_str());
@@ -397,7 +398,7 @@ unsigned int GameSaving::getSlotSyncStatusInternal(CachedSlot& slot)
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slot.slotName;
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::GameStateCloudSaving) + "/" + slot.slotName;
 
     JsonValue jsonBody;
     unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "GetSlotSyncStatus", jsonBody);
@@ -440,11 +441,10 @@ unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slo
         return GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE;
     }
 
-    // convert the databuffer
-    const std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(model.slotName);
-    objectStream->write((char*)model.data, model.dataSize);
-    objectStream->flush();
-    unsigned int size = (unsigned int)objectStream->tellp();
+    // stream the data buffer in place, the stream buffer outlives the request which is sent synchronously below
+    Aws::Utils::Stream::PreallocatedStreamBuf slotDataStreamBuf(model.data, model.dataSize);
+    const std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::IOStream>(model.slotName, &slotDataStreamBuf);
+    const unsigned int size = model.dataSize;
 
     if (!model.overrideSync)
     {
@@ -486,7 +486,7 @@ unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slo
     // This value must be present in both the request to generate the presigned S3 url, as well as
     // when uploading to S3 using the presigned url.
     const std::string hash = getSha256(*objectStream);
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + model.slotName + "/upload_url";
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::GameStateCloudSaving) + "/" + model.slotName + "/upload_url";
 
     // Encode the metadata using base64, allowing non-ascii characters when sent to S3
     const std::string encodedMetadata = EncodingUtils::EncodeBase64(model.metadata);
@@ -536,7 +536,7 @@ unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slo
     intConverter << size;
     putRequest->SetContentLength(intConverter.str());
 
-    const std::shared_ptr<Aws::Http::HttpResponse> putResponse = m_httpClient->MakeRequest(putRequest);
+    const std::shared_ptr<Aws::Http::HttpResponse> putResponse = Utils::RequestMetrics::MakeRequest(*m_httpClient, putRequest, Utils::RequestMetrics::GetEndpoint("GameSaving.UploadSlotToS3"));
     if (putResponse->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
     {
         const std::string errorMessage = "Error: GameSaving::uploadLocalSlot() returned with http response code: " + std::to_string(static_cast<int>(putResponse->GetResponseCode()));
@@ -723,7 +723,7 @@ unsigned int GameSaving::getPresignedS3UrlForSlot(const char* slotName, const un
 
     std::stringstream urlTtlString;
     urlTtlString << urlTtl;
-    const std::string lambdaFunctionUri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slotName + "/download_url?time_to_live=" + urlTtlString.str();
+    const std::string lambdaFunctionUri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::GameStateCloudSaving) + "/" + slotName + "/download_url?time_to_live=" + urlTtlString.str();
 
     JsonValue jsonBody;
     const unsigned int returnCode = m_caller.CallApiGateway(lambdaFunctionUri, Aws::Http::HttpMethod::HTTP_GET, "getPresignedS3UrlForSlot", jsonBody);
@@ -746,7 +746,7 @@ unsigned int GameSaving::getPresignedS3UrlForSlot(const char* slotName, const un
 unsigned int GameSaving::downloadSlotFromS3(const std::string& presignedSlotDownloadUrl, std::shared_ptr<Aws::Http::HttpResponse>& returnedResponse) const
 {
     const std::shared_ptr<Aws::Http::HttpRequest> request = CreateHttpRequest(ToAwsString(presignedSlotDownloadUrl), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    const std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    const std::shared_ptr<Aws::Http::HttpResponse> response = Utils::RequestMetrics::MakeRequest(*m_httpClient, request, Utils::RequestMetrics::GetEndpoint("GameSaving.DownloadSlotFromS3"));
 
     if (response->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
     {
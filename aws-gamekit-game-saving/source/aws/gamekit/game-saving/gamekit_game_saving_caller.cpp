@@ -32,7 +32,8 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
     const CallerParams& queryStringParams,
     const CallerParams& headerParams) const
 {
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
     if (idToken.empty())
     {
         const std::string message = "GameSaving::" + currentFunctionName + "() No ID token in session.";
@@ -56,25 +57,21 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
     }
 
     // attempt to make the http request
-    std::shared_ptr<Aws::Http::HttpResponse> response;
-    for (int tries = 0; tries < RETRIES; ++tries)
-    {
-        response = (*m_httpClient)->MakeRequest(request);
+    Utils::RequestMetrics::Endpoint& metrics = Utils::RequestMetrics::GetEndpoint("GameSaving." + currentFunctionName);
+    std::shared_ptr<Aws::Http::HttpResponse> response = makeRequestWithRetries(request, currentFunctionName, metrics);
 
-        // if the request failed for any reason other than the request was not made (results from a cold lambda) then do not retry
-        if (response->GetResponseCode() != Aws::Http::HttpResponseCode::REQUEST_NOT_MADE)
-        {
-            break;
-        }
-
-        // increase the delay between each retry
-        int delay = (1 << tries) * SCALING_FACTOR;
-
-        const std::string message = "GameSaving::" + currentFunctionName + "() - http request was not made, retrying call after " + std::to_string(delay) + " ms";
+    // the id token can expire before its scheduled refresh, refresh it and replay the request once
+    if (response->GetResponseCode() == Aws::Http::HttpResponseCode::UNAUTHORIZED &&
+        m_sessionManager->RefreshTokensNow(sessionTokens->Version) == GAMEKIT_SUCCESS)
+    {
+        const std::string message = "GameSaving::" + currentFunctionName + "() - request was not authorized, retrying call with refreshed id token";
         Logger::Logging::Log(m_logCb, Level::Info, message.c_str());
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        request->SetAwsAuthorization(ToAwsString(m_sessionManager->GetTokenSnapshot()->Get(GameKit::TokenType::IdToken)));
+        metrics.RecordRetry();
+        response = makeRequestWithRetries(request, currentFunctionName, metrics);
     }
+
     if (response->GetResponseCode() == Aws::Http::HttpResponseCode::NO_CONTENT)
     {
         return GAMEKIT_SUCCESS;
@@ -122,3 +119,35 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
     return GAMEKIT_SUCCESS;
 }
 #pragma endregion
+
+#pragma region Private Methods
+std::shared_ptr<Aws::Http::HttpResponse> GameKit::GameSaving::Caller::makeRequestWithRetries(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& currentFunctionName, Utils::RequestMetrics::Endpoint& metrics) const
+{
+    std::shared_ptr<Aws::Http::HttpResponse> response;
+    for (int tries = 0; tries < RETRIES; ++tries)
+    {
+        if (tries > 0)
+        {
+            metrics.RecordRetry();
+        }
+
+        response = Utils::RequestMetrics::MakeRequest(**m_httpClient, request, metrics);
+
+        // if the request failed for any reason other than the request was not made (results from a cold lambda) then do not retry
+        if (response->GetResponseCode() != Aws::Http::HttpResponseCode::REQUEST_NOT_MADE)
+        {
+            break;
+        }
+
+        // increase the delay between each retry
+        int delay = (1 << tries) * SCALING_FACTOR;
+
+        const std::string message = "GameSaving::" + currentFunctionName + "() - http request was not made, retrying call after " + std::to_string(delay) + " ms";
+        Logger::Logging::Log(m_logCb, Level::Info, message.c_str());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    }
+
+    return response;
+}
+#pragma endregion
@@ -33,6 +33,8 @@
  * The following methods support sign in through a federated identity provider:
  * - GameKitGetFederatedLoginUrl()
  * - GameKitPollAndRetrieveFederatedTokens()
+ * - GameKitPollAndRetrieveFederatedTokensAsync()
+ * - GameKitCancelFederatedLogin()
  * - GameKitGetFederatedIdToken()
  * - GameKitIdentityLogout()
  *
@@ -232,6 +234,37 @@ extern "C"
      */
     GAMEKIT_API unsigned int GameKitPollAndRetrieveFederatedTokens(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, GameKit::FederatedIdentityProvider identityProvider, const char* requestId, int timeout);
 
+    /**
+     * @brief Same as GameKitPollAndRetrieveFederatedTokens(), but returns immediately and waits for the player to sign in on a background thread.
+     *
+     * @details Login completion is checked frequently at first, then less often, so the player is signed in shortly after they complete the login in the browser.
+     *
+     * @details Only one asynchronous login can be in progress per Identity instance: calling this method again cancels the previous login.
+     * Call GameKitCancelFederatedLogin() to cancel the login, for example when the player closes the login screen.
+     *
+     * @param identityInstance A pointer to an Identity instance created with GameKitIdentityInstanceCreateWithSessionManager().
+     * @param identityProvider The federated identity provider to get the login URL for.
+     * @param requestId The unique request identifier returned in the callback function of GameKitGetFederatedLoginUrl().
+     * @param timeout The number of seconds before the login will stop polling and will complete with failure.
+     * @param dispatchReceiver (Optional) This pointer will be passed to the callback function as the `dispatchReceiver`.
+     * @param resultCallback (Optional) The callback function to invoke from the background thread when the login completes. It receives the status codes
+     * listed in GameKitPollAndRetrieveFederatedTokens(), or GAMEKIT_ERROR_REQUEST_CANCELLED if the login was cancelled.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The login was started.
+     * - GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER: The specified federated identity provider is invalid or is not yet supported.
+     * - GAMEKIT_ERROR_SETTINGS_MISSING: One or more settings required for calling the backend are missing and the backend wasn't called. Verify the feature is deployed and the config is correct.
+     */
+    GAMEKIT_API unsigned int GameKitPollAndRetrieveFederatedTokensAsync(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, GameKit::FederatedIdentityProvider identityProvider, const char* requestId, int timeout, DISPATCH_RECEIVER_HANDLE dispatchReceiver, GameKit::FuncFederatedLoginResultCallback resultCallback);
+
+    /**
+     * @brief Cancel the login started with GameKitPollAndRetrieveFederatedTokensAsync(), if any.
+     *
+     * @details This method returns immediately. The login's callback is invoked with GAMEKIT_ERROR_REQUEST_CANCELLED unless the login already completed.
+     *
+     * @param identityInstance A pointer to an Identity instance created with GameKitIdentityInstanceCreateWithSessionManager().
+     */
+    GAMEKIT_API void GameKitCancelFederatedLogin(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance);
+
     /**
      * @brief Get the player's authorized Id token for the specified federated identity provider.
      *
@@ -19,6 +19,7 @@
 #include <aws/gamekit/core/api.h>
 #include <aws/gamekit/core/logging.h>
 #include <aws/gamekit/core/awsclients/api_initializer.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 #include <aws/gamekit/identity/federated_identity_provider.h>
 
 // Boost
@@ -42,7 +43,14 @@ namespace GameKit
             FacebookIdentityProvider(std::map<std::string, std::string>& clientSettings, const std::shared_ptr<Aws::Http::HttpClient> httpClient, FuncLogCallback logCb);
             ~FacebookIdentityProvider();
             LoginUrlResponseInternal GetLoginUrl() override;
-            unsigned int PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation) override;
+            /**
+             * @brief Checks if the login started with GetLoginUrl() has completed, until it completes or the timeout expires.
+             *
+             * @details Checks are frequent at first and back off up to every 5 seconds, so a quick login is noticed quickly.
+             * When the backend holds a check open until the login completes (long polling), the next check is made right away.
+             * @param cancellation (Optional) Cancels the poll from another thread. When cancelled, GAMEKIT_ERROR_REQUEST_CANCELLED is returned.
+            */
+            unsigned int PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation, std::shared_ptr<FederatedLoginCancellation> cancellation = nullptr) override;
             unsigned int RetrieveTokens(const std::string& location, std::string& tokens) override;
         };
     }
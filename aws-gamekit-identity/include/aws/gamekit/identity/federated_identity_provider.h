@@ -4,6 +4,10 @@
 #pragma once
 
 // Standard Library
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 
 // AWS SDK
@@ -24,6 +28,43 @@ namespace GameKit
             std::string loginUrl;
         };
 
+        /**
+         * @brief Lets another thread cancel an in-progress IFederatedIdentityProvider::PollForCompletion().
+         *
+         * @details Cancel() wakes up a poll that is waiting between two checks, so cancellation takes effect immediately
+         * instead of after the next poll interval.
+         */
+        class FederatedLoginCancellation
+        {
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_cancelledCondition;
+            bool m_isCancelled = false;
+
+        public:
+            inline void Cancel()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_isCancelled = true;
+                }
+                m_cancelledCondition.notify_all();
+            }
+
+            inline bool IsCancelled()
+            {
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                return m_isCancelled;
+            }
+
+            // Blocks for the given duration, or until Cancel() is called. Returns true if cancelled.
+            inline bool WaitFor(std::chrono::milliseconds duration)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                return m_cancelledCondition.wait_for(lock, duration, [this]() { return m_isCancelled; });
+            }
+        };
+
         class IFederatedIdentityProvider
         {
         public:
@@ -31,7 +72,7 @@ namespace GameKit
             IFederatedIdentityProvider(std::map<std::string, std::string> clientSettings, FuncLogCallback logCb) {};
             virtual ~IFederatedIdentityProvider() {};
             virtual LoginUrlResponseInternal GetLoginUrl() = 0;
-            virtual unsigned int PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation) = 0;
+            virtual unsigned int PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation, std::shared_ptr<FederatedLoginCancellation> cancellation) = 0;
             virtual unsigned int RetrieveTokens(const std::string& location, std::string& tokens) = 0;
         };
 
@@ -4,8 +4,13 @@
 #pragma once
 
 // Standard Library
+#include <atomic>
+#include <future>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 // AWS SDK
 #include <aws/cognito-idp/CognitoIdentityProviderClient.h>
@@ -34,6 +39,7 @@
 #include <aws/gamekit/core/logging.h>
 #include <aws/gamekit/core/awsclients/api_initializer.h>
 #include <aws/gamekit/core/awsclients/default_clients.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
 #include <aws/gamekit/identity/facebook_identity_provider.h>
 #include <aws/gamekit/identity/federated_identity_provider.h>
 #include <aws/gamekit/identity/gamekit_identity_models.h>
@@ -86,6 +92,34 @@ namespace GameKit
             bool m_awsClientsInitializedInternally;
             std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
 
+            // Profile returned by GetUser(), valid for as long as the session tokens it was retrieved with
+            struct CachedUserProfile
+            {
+                uint64_t TokenVersion = 0;
+                Aws::String UserId;
+                Aws::String CreatedAt;
+                Aws::String UpdatedAt;
+                Aws::String FbExternalId;
+                Aws::String FbRefId;
+                Aws::String UserName;
+                Aws::String UserEmail;
+            };
+            std::shared_ptr<const CachedUserProfile> m_cachedUserProfile; // Only accessed with std::atomic_load/std::atomic_store
+
+            static void dispatchUserProfile(const CachedUserProfile& profile, const DISPATCH_RECEIVER_HANDLE receiver, const GameKit::FuncIdentityGetUserResponseCallback responseCallback);
+
+            // Background federated login started with PollAndRetrieveFacebookTokensAsync(), guarded by m_federatedLoginMutex
+            std::mutex m_federatedLoginMutex;
+            std::thread m_federatedLoginThread;
+            std::shared_ptr<FederatedLoginCancellation> m_federatedLoginCancellation;
+
+            // Cancels the background federated login, if any, and hands over its thread. Must be called while holding m_federatedLoginMutex.
+            std::thread cancelFederatedLogin();
+
+            // Waits for a thread handed over by cancelFederatedLogin() to finish. Must be called without holding m_federatedLoginMutex,
+            // the login's result callback may take it.
+            static void joinFederatedLogin(std::thread& loginThread);
+
         public:
             Identity(FuncLogCallback logCallback, Authentication::GameKitSessionManager* sessionManager);
             ~Identity();
@@ -117,7 +151,38 @@ namespace GameKit
              * - GAMEKIT_ERROR_REQUEST_TIMED_OUT: PollForCompletion timed out waiting for Facebook login completion.
              * - GAMEKIT_ERROR_SETTINGS_MISSING: One or more settings required for calling the backend are missing and the backend wasn't called.
             */
-            unsigned int PollFacebookLoginCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation);
+            unsigned int PollFacebookLoginCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation, std::shared_ptr<FederatedLoginCancellation> cancellation = nullptr);
+
+            /**
+             * @brief Waits for the user to complete signing in at the URL from GetFacebookLoginUrl(), then stores their tokens in the session manager.
+             *
+             * @param requestId Unique request identifier from GetFacebookLoginUrl()
+             * @param timeout Amount of time in seconds before the request expires.
+             * @param cancellation (Optional) Cancels the login from another thread.
+             * @return The result code of the operation, see PollFacebookLoginCompletion() and RetrieveFacebookTokens().
+             * - GAMEKIT_ERROR_REQUEST_CANCELLED: The login was cancelled before it completed.
+            */
+            unsigned int PollAndRetrieveFacebookTokens(const std::string& requestId, int timeout, std::shared_ptr<FederatedLoginCancellation> cancellation = nullptr);
+
+            /**
+             * @brief Same as PollAndRetrieveFacebookTokens(), but returns immediately and waits for the login on a background thread.
+             *
+             * @details Only one asynchronous login can be in progress per Identity instance: starting a new one cancels the previous one.
+             * Use CancelFederatedLogin() to cancel it, for example when the player closes the login screen.
+             * @param dispatchReceiver (Optional) This pointer will be passed to the callback function as the `dispatchReceiver`.
+             * @param resultCallback (Optional) Invoked from the background thread with the result of the login.
+             * @return The result code of the operation.
+             * - GAMEKIT_SUCCESS: The login was started.
+             * - GAMEKIT_ERROR_SETTINGS_MISSING: One or more settings required for calling the backend are missing and the backend wasn't called.
+            */
+            unsigned int PollAndRetrieveFacebookTokensAsync(const std::string& requestId, int timeout, DISPATCH_RECEIVER_HANDLE dispatchReceiver, FuncFederatedLoginResultCallback resultCallback);
+
+            /**
+             * @brief Cancels the login started with PollAndRetrieveFacebookTokensAsync(), if any.
+             *
+             * @details Returns immediately. The login's callback is invoked with GAMEKIT_ERROR_REQUEST_CANCELLED unless it already completed.
+            */
+            void CancelFederatedLogin();
 
             /**
              * @brief Retrieves and stores authorized tokens from the facebook identity provider in the session manager.
@@ -166,4 +166,12 @@ namespace GameKit
      * @param GetUserResponse GetUser response struct.
     */
     typedef void(*FuncIdentityGetUserResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const GameKit::GetUserResponse* getUserResponse);
+
+    /**
+     * @brief A static dispatcher function pointer that receives the result of an asynchronous federated login.
+     *
+     * @param dispatchReceiver A pointer to an instance of a class where the results will be dispatched to.
+     * @param result The GameKit status code of the login, see GameKitPollAndRetrieveFederatedTokens() for the possible values.
+    */
+    typedef void(*FuncFederatedLoginResultCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, unsigned int result);
 }
\ No newline at end of file
@@ -85,23 +85,32 @@ unsigned int GameKitGetFederatedLoginUrl(GAMEKIT_IDENTITY_INSTANCE_HANDLE identi
 GAMEKIT_API unsigned int GameKitPollAndRetrieveFederatedTokens(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, GameKit::FederatedIdentityProvider identityProvider, const char* requestId, int timeout)
 {
     Identity* instance = (Identity*)(GameKit::GameKitFeature*)identityInstance;
-    std::string encryptedLocation;
-    unsigned int result;
 
     if (identityProvider == GameKit::FederatedIdentityProvider::Facebook)
     {
-        result = instance->PollFacebookLoginCompletion(requestId, timeout, encryptedLocation);
-        if (encryptedLocation == "" || result != GameKit::GAMEKIT_SUCCESS)
-        {
-            return result;
-        }
+        return instance->PollAndRetrieveFacebookTokens(requestId, timeout);
+    }
+
+    return GameKit::GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER;
+}
+
+GAMEKIT_API unsigned int GameKitPollAndRetrieveFederatedTokensAsync(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, GameKit::FederatedIdentityProvider identityProvider, const char* requestId, int timeout, DISPATCH_RECEIVER_HANDLE dispatchReceiver, GameKit::FuncFederatedLoginResultCallback resultCallback)
+{
+    Identity* instance = (Identity*)(GameKit::GameKitFeature*)identityInstance;
 
-        return instance->RetrieveFacebookTokens(encryptedLocation);
+    if (identityProvider == GameKit::FederatedIdentityProvider::Facebook)
+    {
+        return instance->PollAndRetrieveFacebookTokensAsync(requestId, timeout, dispatchReceiver, resultCallback);
     }
 
     return GameKit::GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER;
 }
 
+GAMEKIT_API void GameKitCancelFederatedLogin(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
+{
+    ((Identity*)((GameKit::GameKitFeature*)identityInstance))->CancelFederatedLogin();
+}
+
 GAMEKIT_API unsigned int GameKitGetFederatedIdToken(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, GameKit::FederatedIdentityProvider identityProvider, DISPATCH_RECEIVER_HANDLE dispatchReceiver, CharPtrCallback responseCallback)
 {
     Identity* instance = (Identity*)(GameKit::GameKitFeature*)identityInstance;
@@ -6,6 +6,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 
 // GameKit
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/identity/facebook_identity_provider.h>
 
@@ -13,6 +14,11 @@ using namespace Aws::Utils;
 using namespace GameKit;
 using namespace GameKit::Logger;
 
+// Most players complete the login within seconds of opening the URL: check quickly at first, then back off
+static const std::chrono::milliseconds INITIAL_POLL_INTERVAL(500);
+static const std::chrono::milliseconds MAX_POLL_INTERVAL(5000);
+static const double POLL_INTERVAL_GROWTH = 1.5;
+
 GameKit::Identity::FacebookIdentityProvider::FacebookIdentityProvider(std::map<std::string, std::string>& clientSettings, FuncLogCallback logCb)
     :m_clientSettings(clientSettings), m_logCb(logCb)
 {
@@ -25,7 +31,7 @@ GameKit::Identity::FacebookIdentityProvider::FacebookIdentityProvider(std::map<s
     clientConfig.connectTimeoutMs = TIMEOUT;
     clientConfig.httpRequestTimeoutMs = TIMEOUT;
     clientConfig.requestTimeoutMs = TIMEOUT;
-    m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    m_httpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 }
 
 GameKit::Identity::FacebookIdentityProvider::FacebookIdentityProvider(std::map<std::string, std::string>& clientSettings, const std::shared_ptr<Aws::Http::HttpClient> httpClient, FuncLogCallback logCb)
@@ -60,15 +66,23 @@ GameKit::Identity::LoginUrlResponseInternal GameKit::Identity::FacebookIdentityP
     return LoginUrlResponseInternal{ gamekitStatus, requestId, ToStdString(respBody.str()) };
 }
 
-unsigned int GameKit::Identity::FacebookIdentityProvider::PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation)
+unsigned int GameKit::Identity::FacebookIdentityProvider::PollForCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation, std::shared_ptr<FederatedLoginCancellation> cancellation)
 {
-    std::time_t startTime = std::time(nullptr);
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
+    const std::string payload = "{\"request_id\": \"" + requestId + "\"}";
+    std::chrono::milliseconds pollInterval = INITIAL_POLL_INTERVAL;
     std::shared_ptr <Aws::Http::HttpResponse> resp;
     Aws::Http::HttpResponseCode respCode;
 
     while(true)
     {
-        std::string payload = "{\"request_id\": \"" + requestId + "\"}";
+        if (cancellation != nullptr && cancellation->IsCancelled())
+        {
+            Logging::Log(m_logCb, Level::Info, "FacebookIdentityProvider::PollForCompletion() cancelled.");
+            return GameKit::GAMEKIT_ERROR_REQUEST_CANCELLED;
+        }
+
+        const std::chrono::steady_clock::time_point checkStart = std::chrono::steady_clock::now();
         resp = this->makeRequest("/fblogincheck", Aws::Http::HttpMethod::HTTP_POST, payload);
         respCode = resp->GetResponseCode();
 
@@ -77,16 +91,30 @@ unsigned int GameKit::Identity::FacebookIdentityProvider::PollForCompletion(cons
             break;
         }
 
-        // sleep for 5 seconds before checking again
-        std::this_thread::sleep_for(std::chrono::seconds(5));
-
         // current time is past timeout, break out of the loop
-        std::time_t currentTime = std::time(nullptr);
-        if (currentTime - startTime > timeout)
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now >= deadline)
         {
             Logging::Log(m_logCb, Level::Error, "FacebookIdentityProvider::PollForCompletion() timed out waiting for Facebook login completion.");
             return GameKit::GAMEKIT_ERROR_REQUEST_TIMED_OUT;
         }
+
+        // the interval counts from the start of the check: if the backend held the check open, poll again right away
+        const std::chrono::steady_clock::time_point nextCheck = std::min(checkStart + pollInterval, deadline);
+        if (nextCheck > now)
+        {
+            const std::chrono::milliseconds delay = std::chrono::duration_cast<std::chrono::milliseconds>(nextCheck - now);
+            if (cancellation != nullptr)
+            {
+                cancellation->WaitFor(delay);
+            }
+            else
+            {
+                std::this_thread::sleep_for(delay);
+            }
+        }
+
+        pollInterval = std::min(MAX_POLL_INTERVAL, std::chrono::milliseconds(static_cast<long long>(pollInterval.count() * POLL_INTERVAL_GROWTH)));
     }
 
     if (respCode != Aws::Http::HttpResponseCode::OK)
@@ -147,6 +175,7 @@ std::shared_ptr <Aws::Http::HttpResponse> GameKit::Identity::FacebookIdentityPro
     request->SetContentLength(StringUtils::to_string(payload.size()));
     request->SetContentType("application/json");
 
-    std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    // The paths are fixed, e.g. "/fbloginurl", so each one is its own endpoint
+    std::shared_ptr<Aws::Http::HttpResponse> response = GameKit::Utils::RequestMetrics::MakeRequest(*m_httpClient, request, GameKit::Utils::RequestMetrics::GetEndpoint("Identity.Facebook" + path));
     return response;
 }
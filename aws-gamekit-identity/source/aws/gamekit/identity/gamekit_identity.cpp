@@ -1,6 +1,7 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/identity/gamekit_identity.h>
 
@@ -19,19 +20,27 @@ GameKit::Identity::Identity::Identity(FuncLogCallback logCb, Authentication::Gam
 
     static const long TIMEOUT = 7000;
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
-    clientConfig.region = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    const std::shared_ptr<const GameKit::Authentication::ClientSettingsSnapshot> clientSettings = m_sessionManager->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(clientSettings->GetSettings(), clientConfig);
+    clientConfig.region = clientSettings->GetIdentityRegion().c_str();
     // Extend timeouts to account for cold lambda starts
     clientConfig.connectTimeoutMs = TIMEOUT;
     clientConfig.httpRequestTimeoutMs = TIMEOUT;
     clientConfig.requestTimeoutMs = TIMEOUT;
-    m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
+    m_httpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 
     InitializeDefaultAwsClients();
 }
 
 GameKit::Identity::Identity::~Identity()
 {
+    std::thread federatedLoginThread;
+    {
+        const std::lock_guard<std::mutex> lock(m_federatedLoginMutex);
+        federatedLoginThread = cancelFederatedLogin();
+    }
+    joinFederatedLogin(federatedLoginThread);
+
     if (m_awsClientsInitializedInternally)
     {
         delete(m_cognitoClient);
@@ -84,7 +93,7 @@ unsigned int GameKit::Identity::Identity::Register(UserRegistration userRegistra
     }
 
     auto request = CognitoModel::SignUpRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithUsername(userRegistration.userName)
         .WithPassword(userRegistration.password)
         .WithUserAttributes(Aws::Vector<CognitoModel::AttributeType>{
@@ -116,7 +125,7 @@ unsigned int GameKit::Identity::Identity::ConfirmRegistration(ConfirmRegistratio
     }
 
     auto request = CognitoModel::ConfirmSignUpRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithUsername(confirmationRequest.userName)
         .WithConfirmationCode(confirmationRequest.confirmationCode);
 
@@ -143,7 +152,7 @@ unsigned int GameKit::Identity::Identity::ResendConfirmationCode(ResendConfirmat
     }
 
     auto request = CognitoModel::ResendConfirmationCodeRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithUsername(resendConfirmationRequest.userName);
 
     auto outcome = m_cognitoClient->ResendConfirmationCode(request);
@@ -177,7 +186,7 @@ unsigned int GameKit::Identity::Identity::Login(UserLogin userLogin)
     }
 
     CognitoModel::InitiateAuthRequest request = CognitoModel::InitiateAuthRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithAuthFlow(CognitoModel::AuthFlowType::USER_PASSWORD_AUTH)
         .AddAuthParameters("USERNAME", Aws::String(userLogin.userName))
         .AddAuthParameters("PASSWORD", Aws::String(userLogin.password));
@@ -229,7 +238,7 @@ unsigned int GameKit::Identity::Identity::Logout()
         return GAMEKIT_ERROR_LOGOUT_FAILED;
     }
 
-    std::string client_id = m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID];
+    std::string client_id = m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId();
 
     auto revokeRequest = CognitoModel::RevokeTokenRequest()
         .WithToken(refreshToken.c_str())
@@ -247,6 +256,7 @@ unsigned int GameKit::Identity::Identity::Logout()
     m_sessionManager->DeleteToken(GameKit::TokenType::AccessToken);
     m_sessionManager->DeleteToken(GameKit::TokenType::IdToken);
     m_sessionManager->DeleteToken(GameKit::TokenType::RefreshToken);
+    std::atomic_store(&m_cachedUserProfile, std::shared_ptr<const CachedUserProfile>());
     return GAMEKIT_SUCCESS;
 }
 
@@ -260,7 +270,7 @@ unsigned int GameKit::Identity::Identity::ForgotPassword(ForgotPasswordRequest f
     }
 
     auto request = CognitoModel::ForgotPasswordRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithUsername(forgotPasswordRequest.userName);
 
     auto outcome = m_cognitoClient->ForgotPassword(request);
@@ -293,7 +303,7 @@ unsigned int GameKit::Identity::Identity::ConfirmForgotPassword(ConfirmForgotPas
     }
 
     auto request = CognitoModel::ConfirmForgotPasswordRequest()
-        .WithClientId(m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID].c_str())
+        .WithClientId(m_sessionManager->GetClientSettingsSnapshot()->GetUserPoolClientId().c_str())
         .WithUsername(confirmForgotPasswordRequest.userName)
         .WithPassword(confirmForgotPasswordRequest.newPassword)
         .WithConfirmationCode(confirmForgotPasswordRequest.confirmationCode);
@@ -318,18 +328,40 @@ unsigned int GameKit::Identity::Identity::GetUser(const DISPATCH_RECEIVER_HANDLE
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
     if (idToken.empty())
     {
         Logging::Log(m_logCb, Level::Info, "Identity::GetUser() No user is currently logged in.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
     }
 
-    std::string fullUri = m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_IDENTITY_API_GATEWAY_BASE_URL] + "/getuser";
+    // The profile is cached until the tokens change, which happens on login, logout and token refresh
+    GameKit::Utils::RequestMetrics::Endpoint& metrics = GameKit::Utils::RequestMetrics::GetEndpoint("Identity.GetUser");
+    const std::shared_ptr<const CachedUserProfile> cachedProfile = std::atomic_load(&m_cachedUserProfile);
+    if (cachedProfile != nullptr && cachedProfile->TokenVersion == sessionTokens->Version)
+    {
+        metrics.RecordCacheHit();
+        dispatchUserProfile(*cachedProfile, receiver, responseCallback);
+        return GAMEKIT_SUCCESS;
+    }
+    metrics.RecordCacheMiss();
+
+    // Get email address from cognito while the profile is retrieved from the backend.
+    // On early return, the future's destructor waits for the Cognito call to complete.
+    const Aws::String accessToken = ToAwsString(sessionTokens->Get(GameKit::TokenType::AccessToken));
+    std::future<CognitoModel::GetUserOutcome> getUserOutcomeFuture = std::async(std::launch::async, [this, accessToken]()
+    {
+        CognitoModel::GetUserRequest getUserRequest;
+        getUserRequest.SetAccessToken(accessToken);
+        return m_cognitoClient->GetUser(getUserRequest);
+    });
+
+    std::string fullUri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::Identity) + "/getuser";
     std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(ToAwsString(fullUri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
     request->SetAuthorization(ToAwsString(idToken));
 
-    std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    std::shared_ptr<Aws::Http::HttpResponse> response = GameKit::Utils::RequestMetrics::MakeRequest(*m_httpClient, request, metrics);
     if (response->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
     {
         auto errorMessage = "Error: Identity::GetUser() returned with http response code: " + std::to_string(static_cast<int>(response->GetResponseCode()));
@@ -347,14 +379,6 @@ unsigned int GameKit::Identity::Identity::GetUser(const DISPATCH_RECEIVER_HANDLE
         return GAMEKIT_ERROR_PARSE_JSON_FAILED;
     }
 
-    Aws::String responseUserId;
-    Aws::String responseCreatedAt;
-    Aws::String responseUpdatedAt;
-    Aws::String responseFbExternalId;
-    Aws::String responseFbRefId;
-    Aws::String responseUserName;
-    Aws::String responseUserEmail;
-
     const JsonView view = value.View().GetObject("data");
 
     if (!view.KeyExists(GameKit::Identity::USER_ID))
@@ -364,48 +388,36 @@ unsigned int GameKit::Identity::Identity::GetUser(const DISPATCH_RECEIVER_HANDLE
         return GAMEKIT_ERROR_PARSE_JSON_FAILED;
     }
 
-    responseUserId = view.GetString(GameKit::Identity::USER_ID);
-    responseCreatedAt = view.GetString(GameKit::Identity::USER_CREATED_AT);
-    responseUpdatedAt = view.GetString(GameKit::Identity::USER_UPDATED_AT);
-    responseFbExternalId = view.GetString(GameKit::Identity::USER_FB_EXTERNAL_ID);
-    responseFbRefId = view.GetString(GameKit::Identity::USER_FB_REF_ID);
-    responseUserName = view.GetString(GameKit::Identity::USER_NAME);
-
-    // Get email address from cognito
-    CognitoModel::GetUserRequest getUserRequest;
-    std::string accessToken = m_sessionManager->GetToken(GameKit::TokenType::AccessToken);
-    getUserRequest.SetAccessToken(ToAwsString(accessToken));
-    CognitoModel::GetUserOutcome getUserOutcome{ m_cognitoClient->GetUser(getUserRequest) };
+    std::shared_ptr<CachedUserProfile> profile = std::make_shared<CachedUserProfile>();
+    profile->TokenVersion = sessionTokens->Version;
+    profile->UserId = view.GetString(GameKit::Identity::USER_ID);
+    profile->CreatedAt = view.GetString(GameKit::Identity::USER_CREATED_AT);
+    profile->UpdatedAt = view.GetString(GameKit::Identity::USER_UPDATED_AT);
+    profile->FbExternalId = view.GetString(GameKit::Identity::USER_FB_EXTERNAL_ID);
+    profile->FbRefId = view.GetString(GameKit::Identity::USER_FB_REF_ID);
+    profile->UserName = view.GetString(GameKit::Identity::USER_NAME);
 
+    CognitoModel::GetUserOutcome getUserOutcome{ getUserOutcomeFuture.get() };
     if (getUserOutcome.IsSuccess())
     {
-        CognitoModel::GetUserResult getUserResult{ getUserOutcome.GetResult() };
-        for (const auto& attribute : getUserResult.GetUserAttributes())
+        for (const auto& attribute : getUserOutcome.GetResult().GetUserAttributes())
         {
             if (attribute.GetName() == GameKit::Identity::USER_EMAIL)
             {
-                responseUserEmail = attribute.GetValue();
+                profile->UserEmail = attribute.GetValue();
             }
         }
+
+        // Only a complete profile is cached, a missing email is retried on the next call
+        std::atomic_store(&m_cachedUserProfile, std::shared_ptr<const CachedUserProfile>(profile));
     }
     else
     {
-        Aws::String errorMessage = Aws::String("Warning: Identity:GetUser() Failed to retrive user email address: ").append(value.GetErrorMessage());
+        Aws::String errorMessage = Aws::String("Warning: Identity:GetUser() Failed to retrive user email address: ").append(getUserOutcome.GetError().GetMessage());
         Logging::Log(m_logCb, Level::Warning, errorMessage.c_str());
     }
 
-    GetUserResponse getUserResponse = { responseUserId.c_str(),
-                                        responseCreatedAt.c_str(),
-                                        responseUpdatedAt.c_str(),
-                                        responseFbExternalId.c_str(),
-                                        responseFbRefId.c_str(),
-                                        responseUserName.c_str(),
-                                        responseUserEmail.c_str() };
-
-    if ( nullptr != receiver && nullptr != responseCallback)
-    {
-        responseCallback(receiver, &getUserResponse);
-    }
+    dispatchUserProfile(*profile, receiver, responseCallback);
     return GAMEKIT_SUCCESS;
 }
 
@@ -432,7 +444,7 @@ unsigned int GameKit::Identity::Identity::GetFacebookLoginUrl(DISPATCH_RECEIVER_
     return GameKit::GAMEKIT_SUCCESS;
 }
 
-unsigned int GameKit::Identity::Identity::PollFacebookLoginCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation)
+unsigned int GameKit::Identity::Identity::PollFacebookLoginCompletion(const std::string& requestId, int timeout, std::string& encryptedLocation, std::shared_ptr<FederatedLoginCancellation> cancellation)
 {
     if (!m_sessionManager->AreSettingsLoaded(FeatureType::Identity))
     {
@@ -440,7 +452,58 @@ unsigned int GameKit::Identity::Identity::PollFacebookLoginCompletion(const std:
     }
 
     FacebookIdentityProvider provider = FederatedIdentityProviderFactory<FacebookIdentityProvider>::CreateProviderWithHttpClient(m_sessionManager->GetClientSettings(), m_httpClient, m_logCb);
-    return provider.PollForCompletion(requestId, timeout, encryptedLocation);
+    return provider.PollForCompletion(requestId, timeout, encryptedLocation, cancellation);
+}
+
+unsigned int GameKit::Identity::Identity::PollAndRetrieveFacebookTokens(const std::string& requestId, int timeout, std::shared_ptr<FederatedLoginCancellation> cancellation)
+{
+    std::string encryptedLocation;
+    const unsigned int result = PollFacebookLoginCompletion(requestId, timeout, encryptedLocation, cancellation);
+    if (encryptedLocation == "" || result != GameKit::GAMEKIT_SUCCESS)
+    {
+        return result;
+    }
+
+    return RetrieveFacebookTokens(encryptedLocation);
+}
+
+unsigned int GameKit::Identity::Identity::PollAndRetrieveFacebookTokensAsync(const std::string& requestId, int timeout, DISPATCH_RECEIVER_HANDLE dispatchReceiver, FuncFederatedLoginResultCallback resultCallback)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::Identity))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+
+    // The previous login is joined after releasing the lock, its result callback may call back into this class
+    std::thread previousLoginThread;
+    {
+        const std::lock_guard<std::mutex> lock(m_federatedLoginMutex);
+        previousLoginThread = cancelFederatedLogin();
+
+        const std::shared_ptr<FederatedLoginCancellation> cancellation = std::make_shared<FederatedLoginCancellation>();
+        m_federatedLoginCancellation = cancellation;
+        m_federatedLoginThread = std::thread([this, requestId, timeout, dispatchReceiver, resultCallback, cancellation]()
+        {
+            const unsigned int result = PollAndRetrieveFacebookTokens(requestId, timeout, cancellation);
+            if (resultCallback != nullptr)
+            {
+                resultCallback(dispatchReceiver, result);
+            }
+        });
+    }
+    joinFederatedLogin(previousLoginThread);
+
+    return GAMEKIT_SUCCESS;
+}
+
+void GameKit::Identity::Identity::CancelFederatedLogin()
+{
+    const std::lock_guard<std::mutex> lock(m_federatedLoginMutex);
+    if (m_federatedLoginCancellation != nullptr)
+    {
+        Logging::Log(m_logCb, Level::Info, "Identity::CancelFederatedLogin() Cancelling federated login.");
+        m_federatedLoginCancellation->Cancel();
+    }
 }
 
 unsigned int GameKit::Identity::Identity::RetrieveFacebookTokens(const std::string& location)
@@ -476,7 +539,54 @@ void GameKit::Identity::Identity::InitializeDefaultAwsClients()
     m_awsClientsInitializedInternally = true;
     Aws::Client::ClientConfiguration clientConfig;
     m_cognitoClient = DefaultClients::GetDefaultCognitoIdentityProviderClient(GameKit::DefaultClients::GetDefaultClientConfigurationWithRegion(
-        m_sessionManager->GetClientSettings(),
+        m_sessionManager->GetClientSettingsSnapshot()->GetSettings(),
         ClientSettings::Authentication::SETTINGS_IDENTITY_REGION));
 }
 #pragma endregion
+
+#pragma region Private Methods
+void GameKit::Identity::Identity::dispatchUserProfile(const CachedUserProfile& profile, const DISPATCH_RECEIVER_HANDLE receiver, const GameKit::FuncIdentityGetUserResponseCallback responseCallback)
+{
+    GetUserResponse getUserResponse = { profile.UserId.c_str(),
+                                        profile.CreatedAt.c_str(),
+                                        profile.UpdatedAt.c_str(),
+                                        profile.FbExternalId.c_str(),
+                                        profile.FbRefId.c_str(),
+                                        profile.UserName.c_str(),
+                                        profile.UserEmail.c_str() };
+
+    if ( nullptr != receiver && nullptr != responseCallback)
+    {
+        responseCallback(receiver, &getUserResponse);
+    }
+}
+
+std::thread GameKit::Identity::Identity::cancelFederatedLogin()
+{
+    if (m_federatedLoginCancellation != nullptr)
+    {
+        m_federatedLoginCancellation->Cancel();
+        m_federatedLoginCancellation = nullptr;
+    }
+
+    return std::move(m_federatedLoginThread);
+}
+
+void GameKit::Identity::Identity::joinFederatedLogin(std::thread& loginThread)
+{
+    if (!loginThread.joinable())
+    {
+        return;
+    }
+
+    // The result callback may start a new login, a thread cannot wait for itself to finish
+    if (loginThread.get_id() == std::this_thread::get_id())
+    {
+        loginThread.detach();
+    }
+    else
+    {
+        loginThread.join();
+    }
+}
+#pragma endregion
@@ -81,12 +81,23 @@ namespace GameKit
         class GAMEKIT_API UserGameplayData : public GameKitFeature, public IUserGameplayDataFeature
         {
             private:
+                // Authorization header value built from the id token of a given session tokens version
+                struct CachedAuthorizationHeader
+                {
+                    uint64_t TokenVersion = 0;
+                    Aws::String Value;
+                };
+
                 Authentication::GameKitSessionManager* m_sessionManager;
                 std::shared_ptr<UserGameplayDataHttpClient> m_customHttpClient;
                 UserGameplayDataClientSettings m_clientSettings;
+                std::shared_ptr<const CachedAuthorizationHeader> m_cachedAuthorizationHeader; // Only accessed with std::atomic_load/std::atomic_store
 
                 void initializeClient();
                 void setAuthorizationHeader(std::shared_ptr<Aws::Http::HttpRequest> request);
+
+                // Called by the http client when a request is rejected with 401 Unauthorized. Returns true if the request should be replayed.
+                bool refreshAuthorization(std::shared_ptr<const Aws::Http::HttpRequest> rejectedRequest);
                 void setPaginationLimit(std::shared_ptr<Aws::Http::HttpRequest> request, unsigned int paginationLimit);
 
                 /**
@@ -111,7 +111,7 @@ namespace GameKit
         unsigned int RetryStrategy;
 
         /**
-         * @brief Maximum retry threshold for Exponential Backoff. Forces a retry even if exponential backoff is set to a greater value. Default is 32. Uses default if set to 0.
+         * @brief Maximum delay between retries for Exponential Backoff, in multiples of RetryIntervalSeconds. A longer delay is only used when requested by the server with a Retry-After header. Default is 32. Uses default if set to 0.
          */
         unsigned int MaxExponentialRetryThreshold;
 
@@ -6,6 +6,7 @@
 #include <aws/core/utils/StringUtils.h>
 
 // GameKit
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 #include <aws/gamekit/core/internal/platform_string.h>
 #include <aws/gamekit/core/utils/validation_utils.h>
 #include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data.h>
@@ -86,9 +87,10 @@ unsigned int UserGameplayData::AddUserGameplayData(UserGameplayDataBundle userGa
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + userGameplayDataBundle.bundleName;
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -160,8 +162,9 @@ unsigned int UserGameplayData::ListUserGameplayDataBundles(DISPATCH_RECEIVER_HAN
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] + LIST_BUNDLES_PATH;
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) + LIST_BUNDLES_PATH;
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -259,10 +262,11 @@ unsigned int UserGameplayData::GetUserGameplayDataBundle(char* bundleName, DISPA
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + bundleName;
 
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -361,11 +365,12 @@ unsigned int UserGameplayData::GetUserGameplayDataBundleItem(UserGameplayDataBun
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + userGameplayDataBundleItem.bundleName +
         BUNDLE_ITEMS_PATH_PART + userGameplayDataBundleItem.bundleItemKey;
 
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -427,10 +432,11 @@ unsigned int UserGameplayData::UpdateUserGameplayDataBundleItem(UserGameplayData
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + userGameplayDataBundleItemValue.bundleName +
         BUNDLE_ITEMS_PATH_PART + userGameplayDataBundleItemValue.bundleItemKey;
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -471,8 +477,9 @@ unsigned int UserGameplayData::DeleteAllUserGameplayData()
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL];
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -509,9 +516,10 @@ unsigned int UserGameplayData::DeleteUserGameplayDataBundle(char* bundleName)
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    const std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + bundleName;
-    const auto& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -556,9 +564,10 @@ unsigned int UserGameplayData::DeleteUserGameplayDataBundleItems(UserGameplayDat
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
     }
 
-    std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+    std::string uri = m_sessionManager->GetClientSettingsSnapshot()->GetBaseUrl(FeatureType::UserGameplayData) +
         BUNDLES_PATH_PART + deleteItemsRequest.bundleName;
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+    const std::string& idToken = sessionTokens->Get(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
@@ -680,13 +689,14 @@ void UserGameplayData::initializeClient()
 
     // Low level client settings
     Aws::Client::ClientConfiguration clientConfig;
-    GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
+    const std::shared_ptr<const Authentication::ClientSettingsSnapshot> sessionClientSettings = m_sessionManager->GetClientSettingsSnapshot();
+    GameKit::DefaultClients::SetDefaultClientConfiguration(sessionClientSettings->GetSettings(), clientConfig);
     clientConfig.connectTimeoutMs = m_clientSettings.ClientTimeoutSeconds * 1000;
     clientConfig.httpRequestTimeoutMs = m_clientSettings.ClientTimeoutSeconds * 1000;
     clientConfig.requestTimeoutMs = m_clientSettings.ClientTimeoutSeconds * 1000;
-    clientConfig.region = m_sessionManager->GetClientSettings()[ClientSettings::Authentication::SETTINGS_IDENTITY_REGION].c_str();
+    clientConfig.region = sessionClientSettings->GetIdentityRegion().c_str();
 
-    auto lowLevelHttpClient = Aws::Http::CreateHttpClient(clientConfig);
+    auto lowLevelHttpClient = SharedHttpClients::Get(clientConfig, m_logCb);
 
     // High level settings for custom client
     auto strategyBuilder = [&]()
@@ -696,7 +706,8 @@ void UserGameplayData::initializeClient()
         switch (strategyType)
         {
         case StrategyType::ExponentialBackoff:
-            retryLogic = std::make_shared<ExponentialBackoffStrategy>(m_clientSettings.MaxExponentialRetryThreshold, m_logCb);
+            retryLogic = std::make_shared<ExponentialBackoffStrategy>(std::chrono::seconds(m_clientSettings.RetryIntervalSeconds),
+                std::chrono::seconds(m_clientSettings.RetryIntervalSeconds * m_clientSettings.MaxExponentialRetryThreshold), m_logCb);
             break;
         case StrategyType::ConstantInterval:
             retryLogic = std::make_shared<ConstantIntervalStrategy>();
@@ -714,12 +725,53 @@ void UserGameplayData::initializeClient()
     auto retryStrategy = strategyBuilder();
     m_customHttpClient = std::make_shared<UserGameplayDataHttpClient>(
         lowLevelHttpClient, authSetter, m_clientSettings.RetryIntervalSeconds, retryStrategy, m_clientSettings.MaxRetryQueueSize, m_logCb);
+    m_customHttpClient->SetUnauthorizedResponseHandler(std::bind(&UserGameplayData::refreshAuthorization, this, std::placeholders::_1));
 }
 
 void UserGameplayData::setAuthorizationHeader(std::shared_ptr<HttpRequest> request)
 {
-    std::string value = "Bearer " + m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    request->SetHeaderValue(HEADER_AUTHORIZATION, ToAwsString(value));
+    // Rebuild the header only when the tokens changed since it was last built, this is called for every request and retry
+    std::shared_ptr<const CachedAuthorizationHeader> cachedHeader = std::atomic_load(&m_cachedAuthorizationHeader);
+    const uint64_t tokenVersion = m_sessionManager->GetTokenVersion();
+    if (cachedHeader == nullptr || cachedHeader->TokenVersion != tokenVersion)
+    {
+        const std::shared_ptr<const Authentication::SessionTokens> sessionTokens = m_sessionManager->GetTokenSnapshot();
+        std::shared_ptr<CachedAuthorizationHeader> newHeader = std::make_shared<CachedAuthorizationHeader>();
+        newHeader->TokenVersion = sessionTokens->Version;
+        newHeader->Value = "Bearer " + ToAwsString(sessionTokens->Get(GameKit::TokenType::IdToken));
+
+        // Only move the cache forward, the version of the cached header identifies the tokens rejected requests were sent with
+        std::shared_ptr<const CachedAuthorizationHeader> expectedHeader = cachedHeader;
+        cachedHeader = newHeader;
+        while (!std::atomic_compare_exchange_weak(&m_cachedAuthorizationHeader, &expectedHeader, cachedHeader))
+        {
+            if (expectedHeader != nullptr && expectedHeader->TokenVersion >= newHeader->TokenVersion)
+            {
+                break;
+            }
+        }
+    }
+
+    request->SetHeaderValue(HEADER_AUTHORIZATION, cachedHeader->Value);
+}
+
+bool UserGameplayData::refreshAuthorization(std::shared_ptr<const HttpRequest> rejectedRequest)
+{
+    const std::shared_ptr<const CachedAuthorizationHeader> cachedHeader = std::atomic_load(&m_cachedAuthorizationHeader);
+    if (cachedHeader == nullptr)
+    {
+        return m_sessionManager->RefreshTokensNow(m_sessionManager->GetTokenVersion()) == GAMEKIT_SUCCESS;
+    }
+
+    // A request sent with a header other than the cached one was authorized with older tokens, which were already replaced.
+    // Replaying it with the current tokens is enough, refreshing again would discard tokens that were never rejected.
+    if (!rejectedRequest->HasHeader(HEADER_AUTHORIZATION.c_str()) || rejectedRequest->GetHeaderValue(HEADER_AUTHORIZATION.c_str()) != cachedHeader->Value)
+    {
+        return true;
+    }
+
+    // The request was sent with the cached header, so its version identifies the rejected tokens
+    return m_sessionManager->RefreshTokensNow(cachedHeader->TokenVersion) == GAMEKIT_SUCCESS;
 }
 
 void UserGameplayData::setPaginationLimit(std::shared_ptr<HttpRequest> request, unsigned int paginationLimit)
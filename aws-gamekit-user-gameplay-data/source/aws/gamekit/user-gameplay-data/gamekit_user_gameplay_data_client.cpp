@@ -119,9 +119,8 @@ RequestResult UserGameplayDataHttpClient::MakeRequest(UserGameplayDataOperationT
 
     auto result = this->makeOperationRequest(operation, isAsync, false);
 
-    std::string message = "UserGameplayDataHttpClient::MakeRequest with operation " + std::to_string((int)operationType) +
-        ", async " + std::to_string(isAsync) + ", bundle " + bundle + ", item " + itemKey + result.ToString();
-    Logging::Log(m_logCb, Level::Verbose, message.c_str());
+    GAMEKIT_LOG(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::MakeRequest with operation " + std::to_string((int)operationType) +
+        ", async " + std::to_string(isAsync) + ", bundle " + bundle + ", item " + itemKey + result.ToString());
 
     return result;
 }
@@ -130,7 +129,7 @@ RequestResult UserGameplayDataHttpClient::MakeRequest(UserGameplayDataOperationT
 #pragma region UserGameplayDataHttpClient Private/Protected Methods
 void UserGameplayDataHttpClient::filterQueue(OperationQueue* queue, OperationQueue* filtered)
 {
-    Logging::Log(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::FilterQueue");
+    GAMEKIT_LOG(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::FilterQueue");
     std::map<std::string, std::deque<UserGameplayDataOperation*>> temp;
     unsigned int operationsDiscarded = 0;
 
@@ -166,13 +165,13 @@ void UserGameplayDataHttpClient::filterQueue(OperationQueue* queue, OperationQue
 
             if (!operation->ItemKey.empty() && !previousOperation->ItemKey.empty())
             {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
+                GAMEKIT_LOG(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
                 previousOperation->Discard = true;
                 queueWithSameKey.pop_back();
             }
             else if (operation->Type == UserGameplayDataOperationType::Delete)
             {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
+                GAMEKIT_LOG(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
                 previousOperation->Discard = true;
                 queueWithSameKey.pop_back();
             }
@@ -190,8 +189,7 @@ void UserGameplayDataHttpClient::filterQueue(OperationQueue* queue, OperationQue
         }
     }
 
-    std::string message = "UserGameplayDataHttpClient::FilterQueue. Discarded " + std::to_string(operationsDiscarded) + " operations.";
-    Logging::Log(m_logCb, Level::Info, message.c_str());
+    GAMEKIT_LOG(m_logCb, Level::Info, "UserGameplayDataHttpClient::FilterQueue. Discarded " + std::to_string(operationsDiscarded) + " operations.");
 }
 
 bool UserGameplayDataHttpClient::shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const
@@ -209,9 +207,8 @@ bool UserGameplayDataHttpClient::isOperationRetryable(const std::shared_ptr<IOpe
     bool attemptsExhausted = ugpdOperation->MaxAttempts != OPERATION_ATTEMPTS_NO_LIMIT && ugpdOperation->Attempts > ugpdOperation->MaxAttempts;
     bool isResponseRetryable = BaseHttpClient::isResponseCodeRetryable(response->GetResponseCode());
 
-    std::string message = "UserGameplayDataHttpClient::IsOperationRetryable: Attempts exhausted " + std::to_string(attemptsExhausted) +
-        ", Type " + std::to_string(int(ugpdOperation->Type)) + ", IsResponseCodeRetryable " + std::to_string(isResponseRetryable);
-    Logging::Log(m_logCb, Level::Verbose, message.c_str());
+    GAMEKIT_LOG(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::IsOperationRetryable: Attempts exhausted " + std::to_string(attemptsExhausted) +
+        ", Type " + std::to_string(int(ugpdOperation->Type)) + ", IsResponseCodeRetryable " + std::to_string(isResponseRetryable));
 
     return !attemptsExhausted &&
         ugpdOperation->Type != UserGameplayDataOperationType::Get &&
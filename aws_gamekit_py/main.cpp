@@ -1,3 +1,4 @@
+#include <climits>
 #include <iostream>
 
 #include <pybind11/pybind11.h>
@@ -23,6 +24,14 @@
  * and will free the pointer when it is done (at the end of a test).
  *
  * https://pybind11.readthedocs.io/en/stable/advanced/functions.html#return-value-policies
+ *
+ * Every function calling into GameKit releases the GIL for the duration of the call, so Python threads can drive
+ * many instances in parallel. Dispatchers therefore collect results into C++ types, which are converted to Python
+ * objects once the GIL is re-acquired. The log callback is the only Python code called from GameKit, and acquires
+ * the GIL itself. A single instance handle must not be used from several threads at the same time.
+ *
+ * Long-running functions also have an `_async` variant returning an awaitable, which runs the blocking call on
+ * the event loop's default executor.
  */
 
 namespace py = pybind11;
@@ -57,8 +66,15 @@ namespace gkpy_shim
             pyLog = logFunc;
         };
 
+        // Called from threads that released the GIL and from GameKit background threads
         void log(unsigned int l, const char* m, int s)
         {
+            if (!Py_IsInitialized())
+            {
+                return;
+            }
+
+            py::gil_scoped_acquire acquire;
             if (pyLog != nullptr)
             {
                 pyLog(l, m);
@@ -66,6 +82,21 @@ namespace gkpy_shim
         }
     }
 
+    namespace async
+    {
+        // Define `<name>_async` on the module, returning an awaitable that runs `<name>` on the running event loop's default executor.
+        // `<name>` must release the GIL, otherwise the executor threads would serialize on it.
+        void def_async(py::module& module, const char* name)
+        {
+            const py::object function = module.attr(name);
+            module.def((std::string(name) + "_async").c_str(), [function](py::args args)
+            {
+                const py::object loop = py::module::import("asyncio").attr("get_running_loop")();
+                return loop.attr("run_in_executor")(py::none(), py::module::import("functools").attr("partial")(function, *args));
+            });
+        }
+    }
+
     enum handle_type
     {
         // Core
@@ -261,15 +292,18 @@ namespace gkpy_shim
 
         py::str get_aws_account_id(const std::string& accessKey, const std::string &secretKey)
         {
-            py::str accountId;
+            std::string accountId;
             auto getAccountIdDispatcher = [&](const char* response)
             {
-                accountId = py::str(response);
+                accountId = response;
             };
             typedef LambdaDispatcher<decltype(getAccountIdDispatcher), void, const char*> GetAccountIdDispatcher;
 
-            GameKitGetAwsAccountId(&getAccountIdDispatcher, GetAccountIdDispatcher::Dispatch, accessKey.c_str(), secretKey.c_str(), gkpy_shim::logging::log);
-            return accountId;
+            {
+                py::gil_scoped_release release;
+                GameKitGetAwsAccountId(&getAccountIdDispatcher, GetAccountIdDispatcher::Dispatch, accessKey.c_str(), secretKey.c_str(), gkpy_shim::logging::log);
+            }
+            return py::str(accountId);
         }
 
         gamekit_feature_resources_instance_handle resources_instance_create(models::account_info accountInfo, models::account_credentials credentials, FeatureType featureType, const std::string& root_path, const std::string& plugin_path)
@@ -393,14 +427,19 @@ namespace gkpy_shim
             models::get_user_response userResponse;
             auto getUserInfoDispatcher = [&](const GetUserResponse* response)
             {
-                userResponse.user_id = py::str(response->userId);
-                userResponse.updated_at = py::str(response->updatedAt);
-                userResponse.created_at = py::str(response->createdAt);
-                userResponse.facebook_external_id = py::str(response->facebookExternalId);
-                userResponse.facebook_ref_id = py::str(response->facebookRefId);
+                userResponse.user_id = response->userId;
+                userResponse.updated_at = response->updatedAt;
+                userResponse.created_at = response->createdAt;
+                userResponse.facebook_external_id = response->facebookExternalId;
+                userResponse.facebook_ref_id = response->facebookRefId;
             };
             typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const GetUserResponse*> GetUserInfoDispatcher;
-            unsigned int status = GameKitIdentityGetUser(identity_handle.low_level_handle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch);
+
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitIdentityGetUser(identity_handle.low_level_handle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch);
+            }
             return py::make_tuple(status, userResponse);
         }
     }
@@ -435,7 +474,7 @@ namespace gkpy_shim
 
         py::tuple list_achievements(gamekit_achievement_instance_handle achievements_handle, unsigned int page_size, bool wait_for_all_pages)
         {
-            py::list results;
+            std::vector<models::achievement> results;
             auto listAchievementsDispatcher = [&](const char* response)
             {
                 const std::string jsonData = std::string(response);
@@ -448,14 +487,17 @@ namespace gkpy_shim
                     JsonView achievement = achievements.GetItem(i);
                     if (achievement.IsObject())
                     {
-                        models::achievement a{ py::str(achievement.GetString("achievementId")), py::str(achievement.GetString("title")) };
-                        results.append(a);
+                        results.emplace_back(achievement.GetString("achievementId"), achievement.GetString("title"));
                     }
                 }
             };
             typedef LambdaDispatcher<decltype(listAchievementsDispatcher), void, const char*> ListAchievementsDispatcher;
 
-            unsigned int status = GameKitListAchievements(achievements_handle.low_level_handle, page_size, wait_for_all_pages, &listAchievementsDispatcher, ListAchievementsDispatcher::Dispatch);
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitListAchievements(achievements_handle.low_level_handle, page_size, wait_for_all_pages, &listAchievementsDispatcher, ListAchievementsDispatcher::Dispatch);
+            }
             return py::make_tuple(status, results);
         }
 
@@ -472,7 +514,11 @@ namespace gkpy_shim
                 achievement.title = data.GetString("title");
             };
             typedef LambdaDispatcher<decltype(getAchievementsDispatcher), void, const char*> GetAchievementsDispatcher;
-            unsigned int status = GameKitGetAchievement(achievements_handle.low_level_handle, achievement_id.c_str(), &getAchievementsDispatcher, GetAchievementsDispatcher::Dispatch);
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitGetAchievement(achievements_handle.low_level_handle, achievement_id.c_str(), &getAchievementsDispatcher, GetAchievementsDispatcher::Dispatch);
+            }
             return py::make_tuple(status, achievement);
         }
     }
@@ -536,14 +582,18 @@ namespace gkpy_shim
         //  as the GameKit function doesn't return fully hydrated bundles
         py::tuple list_user_gameplay_data_bundles(gamekit_user_game_data_instance_handle user_gameplay_data_handle)
         {
-            py::list bundles;
+            std::vector<std::string> bundles;
             auto bundlesDispatcher = [&](const char* charPtr)
             {
-                bundles.append(py::str(charPtr));
+                bundles.push_back(charPtr);
             };
 
             typedef LambdaDispatcher<decltype(bundlesDispatcher), void, const char*> BundlesDispatcher;
-            unsigned int status = GameKitListUserGameplayDataBundles(user_gameplay_data_handle.low_level_handle, &bundlesDispatcher, BundlesDispatcher::Dispatch);
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitListUserGameplayDataBundles(user_gameplay_data_handle.low_level_handle, &bundlesDispatcher, BundlesDispatcher::Dispatch);
+            }
             return py::make_tuple(status, bundles);
         }
 
@@ -558,7 +608,11 @@ namespace gkpy_shim
             typedef LambdaDispatcher<decltype(bundleSetter), void, const char*, const char*> BundleSetter;
 
             // act
-            unsigned int status = GameKitGetUserGameplayDataBundle(user_gameplay_data_handle.low_level_handle, bundle_name, &bundleSetter, BundleSetter::Dispatch);
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitGetUserGameplayDataBundle(user_gameplay_data_handle.low_level_handle, bundle_name, &bundleSetter, BundleSetter::Dispatch);
+            }
             return py::make_tuple(status, models::user_gameplay_data_bundle{ std::string(bundle_name), pairs });
         }
 
@@ -606,6 +660,47 @@ namespace gkpy_shim
             };
         }
 
+        // Contiguous view of a Python object supporting the buffer protocol (bytes, bytearray, memoryview, numpy arrays, ...).
+        // GameKit reads or writes the object's memory in place, and the object can't be resized while the view is held.
+        class contiguous_buffer
+        {
+        private:
+            Py_buffer view;
+
+        public:
+            contiguous_buffer(const py::object& object, bool writable)
+            {
+                if (PyObject_GetBuffer(object.ptr(), &view, PyBUF_C_CONTIGUOUS | (writable ? PyBUF_WRITABLE : 0)) != 0)
+                {
+                    throw py::error_already_set();
+                }
+
+                if (static_cast<size_t>(view.len) > UINT_MAX)
+                {
+                    PyBuffer_Release(&view);
+                    throw py::value_error("Buffer is larger than the maximum slot size");
+                }
+            }
+
+            ~contiguous_buffer()
+            {
+                PyBuffer_Release(&view);
+            }
+
+            contiguous_buffer(const contiguous_buffer&) = delete;
+            contiguous_buffer& operator=(const contiguous_buffer&) = delete;
+
+            uint8_t* data() const
+            {
+                return static_cast<uint8_t*>(view.buf);
+            }
+
+            unsigned int size() const
+            {
+                return static_cast<unsigned int>(view.len);
+            }
+        };
+
         gamekit_game_saving_instance_handle game_saving_instance_create(gamekit_session_manager_instance_handle session_handle)
         {
             // fake our reads and writes for faster testing without mucking up our filesystem
@@ -631,7 +726,7 @@ namespace gkpy_shim
 
         py::tuple get_all_slot_sync_statuses(gamekit_game_saving_instance_handle game_saving_handle)
         {
-            py::list slots;
+            std::vector<models::slot> slots;
 
             auto slotCallback = [&slots](const Slot* syncedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
             {
@@ -640,12 +735,16 @@ namespace gkpy_shim
                     models::slot slot{};
                     // We can hydrate this more later if we need further testing
                     slot.slot_name = std::string(syncedSlots[i].slotName);
-                    slots.append(slot);
+                    slots.push_back(slot);
                 }
             };
             typedef LambdaDispatcher<decltype(slotCallback), void, const Slot*, unsigned int, bool, unsigned int> SlotsDispatcher;
 
-            unsigned int status = GameKitGetAllSlotSyncStatuses(game_saving_handle.low_level_handle, &slotCallback, SlotsDispatcher::Dispatch, true, 100);
+            unsigned int status;
+            {
+                py::gil_scoped_release release;
+                status = GameKitGetAllSlotSyncStatuses(game_saving_handle.low_level_handle, &slotCallback, SlotsDispatcher::Dispatch, true, 100);
+            }
             return py::make_tuple(status, slots);
         }
 
@@ -659,10 +758,97 @@ namespace gkpy_shim
             };
             typedef LambdaDispatcher<decltype(slotCallback), void, const Slot*, unsigned int, const Slot*, unsigned int> SlotsDispatcher;
 
-            unsigned int result = GameKitSaveSlot(game_saving_handle.low_level_handle, &slotCallback, SlotsDispatcher::Dispatch, slot.ToGameSavingModel());
+            unsigned int result;
+            {
+                py::gil_scoped_release release;
+                result = GameKitSaveSlot(game_saving_handle.low_level_handle, &slotCallback, SlotsDispatcher::Dispatch, slot.ToGameSavingModel());
+            }
             return py::make_tuple(result, returnSlot);
         }
 
+        // Uploads the slot straight from the memory of `data`, which can be any contiguous buffer
+        py::tuple save_slot_from_buffer(gamekit_game_saving_instance_handle game_saving_handle, const std::string& slot_name, const py::buffer& data, const std::string& metadata, int64_t epoch_time, bool override_sync, const std::string& local_slot_information_file_path)
+        {
+            const contiguous_buffer buffer(data, false);
+            models::slot returnSlot{};
+
+            auto slotCallback = [&returnSlot](const Slot* syncedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
+            {
+                returnSlot.slot_name = std::string(slot->slotName);
+            };
+            typedef LambdaDispatcher<decltype(slotCallback), void, const Slot*, unsigned int, const Slot*, unsigned int> SlotsDispatcher;
+
+            // GameKit only reads the data when saving
+            const GameSavingModel model(slot_name.c_str(), metadata.c_str(), epoch_time, override_sync, buffer.data(), buffer.size(), local_slot_information_file_path.c_str());
+
+            unsigned int result;
+            {
+                py::gil_scoped_release release;
+                result = GameKitSaveSlot(game_saving_handle.low_level_handle, &slotCallback, SlotsDispatcher::Dispatch, model);
+            }
+            return py::make_tuple(result, returnSlot);
+        }
+
+        // Returns a tuple of (status, memoryview of the downloaded slot or None).
+        // The slot is downloaded straight into `into` when given, which must be a writable contiguous buffer at least as large as the cloud slot.
+        // Otherwise a bytearray of the slot's cloud size is allocated, which costs an extra GetSlotSyncStatus call.
+        py::tuple load_slot(gamekit_game_saving_instance_handle game_saving_handle, const std::string& slot_name, py::object into, bool override_sync, const std::string& local_slot_information_file_path)
+        {
+            unsigned int status;
+            if (into.is_none())
+            {
+                int64_t sizeCloud = 0;
+                auto slotCallback = [&sizeCloud](const Slot* syncedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
+                {
+                    sizeCloud = slot->sizeCloud;
+                };
+                typedef LambdaDispatcher<decltype(slotCallback), void, const Slot*, unsigned int, const Slot*, unsigned int> SlotDispatcher;
+
+                {
+                    py::gil_scoped_release release;
+                    status = GameKitGetSlotSyncStatus(game_saving_handle.low_level_handle, &slotCallback, SlotDispatcher::Dispatch, slot_name.c_str());
+                }
+                if (status != GAMEKIT_SUCCESS)
+                {
+                    return py::make_tuple(status, py::none());
+                }
+
+                into = py::reinterpret_steal<py::object>(PyByteArray_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(sizeCloud)));
+                if (!into)
+                {
+                    throw py::error_already_set();
+                }
+            }
+
+            unsigned int loadedSize = 0;
+            {
+                const contiguous_buffer buffer(into, true);
+
+                auto dataCallback = [&loadedSize](const Slot* syncedSlots, unsigned int slotCount, const Slot* slot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
+                {
+                    // `data` is the buffer itself, nothing to copy
+                    loadedSize = dataSize;
+                };
+                typedef LambdaDispatcher<decltype(dataCallback), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> DataDispatcher;
+
+                const GameSavingModel model(slot_name.c_str(), "", 0, override_sync, buffer.data(), buffer.size(), local_slot_information_file_path.c_str());
+
+                py::gil_scoped_release release;
+                status = GameKitLoadSlot(game_saving_handle.low_level_handle, &dataCallback, DataDispatcher::Dispatch, model);
+            }
+            if (status != GAMEKIT_SUCCESS)
+            {
+                return py::make_tuple(status, py::none());
+            }
+
+            const py::object view = py::reinterpret_steal<py::object>(PyMemoryView_FromObject(into.ptr()));
+            if (!view)
+            {
+                throw py::error_already_set();
+            }
+            return py::make_tuple(status, py::object(view[py::slice(0, loadedSize, 1)]));
+        }
+
         // Sending nullptr for callbacks as we don't care for a copy of the slot when we're done
         unsigned int delete_slot(gamekit_game_saving_instance_handle game_saving_handle, std::string slot_name)
         {
@@ -710,77 +896,91 @@ PYBIND11_MODULE(aws_gamekit_py, m)
     logging.def("set_py_log", &gkpy_shim::logging::set_py_log);
 
     // Core exports functions
-    core.def("initialize_aws_sdk", &gkpy_shim::core_exports::initialize_aws_sdk);
+    core.def("initialize_aws_sdk", &gkpy_shim::core_exports::initialize_aws_sdk, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_instance_create", &gkpy_shim::core_exports::account_instance_create);
+    core.def("account_instance_create", &gkpy_shim::core_exports::account_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_instance_create_with_root_paths", &gkpy_shim::core_exports::account_instance_create_with_root_paths);
+    core.def("account_instance_create_with_root_paths", &gkpy_shim::core_exports::account_instance_create_with_root_paths, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_instance_release", &gkpy_shim::core_exports::account_instance_release);
+    core.def("account_instance_release", &gkpy_shim::core_exports::account_instance_release, py::call_guard<py::gil_scoped_release>());
 
-    core.def("settings_instance_create", &gkpy_shim::core_exports::settings_instance_create);
+    core.def("settings_instance_create", &gkpy_shim::core_exports::settings_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    core.def("settings_instance_release", &gkpy_shim::core_exports::settings_instance_release);
+    core.def("settings_instance_release", &gkpy_shim::core_exports::settings_instance_release, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_has_valid_credentials", &gkpy_shim::core_exports::account_has_valid_credentials);
+    core.def("account_has_valid_credentials", &gkpy_shim::core_exports::account_has_valid_credentials, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_instance_bootstrap", &gkpy_shim::core_exports::account_instance_bootstrap);
+    core.def("account_instance_bootstrap", &gkpy_shim::core_exports::account_instance_bootstrap, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_instance_bootstrap");
 
-    core.def("settings_set_feature_variables", &gkpy_shim::core_exports::settings_set_feature_variables);
+    core.def("settings_set_feature_variables", &gkpy_shim::core_exports::settings_set_feature_variables, py::call_guard<py::gil_scoped_release>());
 
-    core.def("save_settings", &gkpy_shim::core_exports::save_settings);
+    core.def("save_settings", &gkpy_shim::core_exports::save_settings, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_save_feature_instance_templates", &gkpy_shim::core_exports::account_save_feature_instance_templates);
+    core.def("account_save_feature_instance_templates", &gkpy_shim::core_exports::account_save_feature_instance_templates, py::call_guard<py::gil_scoped_release>());
 
-    core.def("account_upload_all_dashboards", &gkpy_shim::core_exports::account_upload_all_dashboards);
+    core.def("account_upload_all_dashboards", &gkpy_shim::core_exports::account_upload_all_dashboards, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_upload_all_dashboards");
 
-    core.def("account_upload_layers", &gkpy_shim::core_exports::account_upload_layers);
+    core.def("account_upload_layers", &gkpy_shim::core_exports::account_upload_layers, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_upload_layers");
 
-    core.def("account_upload_functions", &gkpy_shim::core_exports::account_upload_functions);
+    core.def("account_upload_functions", &gkpy_shim::core_exports::account_upload_functions, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_upload_functions");
 
-    core.def("account_create_or_update_main_stack", &gkpy_shim::core_exports::account_create_or_update_main_stack);
+    core.def("account_create_or_update_main_stack", &gkpy_shim::core_exports::account_create_or_update_main_stack, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_create_or_update_main_stack");
 
-    core.def("account_create_or_update_stacks", &gkpy_shim::core_exports::account_create_or_update_stacks);
+    core.def("account_create_or_update_stacks", &gkpy_shim::core_exports::account_create_or_update_stacks, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_create_or_update_stacks");
 
-    core.def("account_deploy_api_gateway_stage", &gkpy_shim::core_exports::account_deploy_api_gateway_stage);
+    core.def("account_deploy_api_gateway_stage", &gkpy_shim::core_exports::account_deploy_api_gateway_stage, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "account_deploy_api_gateway_stage");
 
     core.def("get_aws_account_id", &gkpy_shim::core_exports::get_aws_account_id);
+    gkpy_shim::async::def_async(core, "get_aws_account_id");
 
-    core.def("resources_instance_create", &gkpy_shim::core_exports::resources_instance_create);
+    core.def("resources_instance_create", &gkpy_shim::core_exports::resources_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    core.def("resources_instance_create_or_update_stack", &gkpy_shim::core_exports::resources_instance_create_or_update_stack);
+    core.def("resources_instance_create_or_update_stack", &gkpy_shim::core_exports::resources_instance_create_or_update_stack, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "resources_instance_create_or_update_stack");
 
-    core.def("resources_save_cloud_formation_instance", &gkpy_shim::core_exports::resources_save_cloud_formation_instance);
+    core.def("resources_save_cloud_formation_instance", &gkpy_shim::core_exports::resources_save_cloud_formation_instance, py::call_guard<py::gil_scoped_release>());
 
-    core.def("resources_save_layer_instances", &gkpy_shim::core_exports::resources_save_layer_instances);
+    core.def("resources_save_layer_instances", &gkpy_shim::core_exports::resources_save_layer_instances, py::call_guard<py::gil_scoped_release>());
 
-    core.def("resources_save_function_instances", &gkpy_shim::core_exports::resources_save_function_instances);
+    core.def("resources_save_function_instances", &gkpy_shim::core_exports::resources_save_function_instances, py::call_guard<py::gil_scoped_release>());
 
-    core.def("resources_upload_feature_layers", &gkpy_shim::core_exports::resources_upload_feature_layers);
+    core.def("resources_upload_feature_layers", &gkpy_shim::core_exports::resources_upload_feature_layers, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "resources_upload_feature_layers");
 
-    core.def("resources_upload_feature_functions", &gkpy_shim::core_exports::resources_upload_feature_functions);
+    core.def("resources_upload_feature_functions", &gkpy_shim::core_exports::resources_upload_feature_functions, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "resources_upload_feature_functions");
 
-    core.def("resources_instance_delete_stack", &gkpy_shim::core_exports::resources_instance_delete_stack);
+    core.def("resources_instance_delete_stack", &gkpy_shim::core_exports::resources_instance_delete_stack, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(core, "resources_instance_delete_stack");
 
-    core.def("resources_instance_release", &gkpy_shim::core_exports::resources_instance_release);
+    core.def("resources_instance_release", &gkpy_shim::core_exports::resources_instance_release, py::call_guard<py::gil_scoped_release>());
 
     // Authentication module
     py::module authentication = m.def_submodule("authentication", "Authentication submodule");
 
-    authentication.def("session_manager_instance_create", &gkpy_shim::session_exports::session_manager_instance_create);
+    authentication.def("session_manager_instance_create", &gkpy_shim::session_exports::session_manager_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    authentication.def("session_manager_instance_release", &gkpy_shim::session_exports::session_manager_instance_release);
+    authentication.def("session_manager_instance_release", &gkpy_shim::session_exports::session_manager_instance_release, py::call_guard<py::gil_scoped_release>());
 
     // Identity module
     py::module identity = m.def_submodule("identity", "Identity submodule");
 
-    identity.def("identity_instance_create_with_session_manager", &gkpy_shim::identity_exports::identity_instance_create_with_session_manager);
+    identity.def("identity_instance_create_with_session_manager", &gkpy_shim::identity_exports::identity_instance_create_with_session_manager, py::call_guard<py::gil_scoped_release>());
 
-    identity.def("identity_instance_release", &gkpy_shim::identity_exports::identity_instance_release);
+    identity.def("identity_instance_release", &gkpy_shim::identity_exports::identity_instance_release, py::call_guard<py::gil_scoped_release>());
 
-    identity.def("identity_login", &gkpy_shim::identity_exports::identity_login);
+    identity.def("identity_login", &gkpy_shim::identity_exports::identity_login, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(identity, "identity_login");
 
     identity.def("identity_get_user", &gkpy_shim::identity_exports::identity_get_user);
+    gkpy_shim::async::def_async(identity, "identity_get_user");
 
     py::module identity_models = identity.def_submodule("model", "Identity Models submodule");
     py::class_<gkpy_shim::identity_exports::models::user_login>(identity_models, "user_login")
@@ -800,13 +1000,15 @@ PYBIND11_MODULE(aws_gamekit_py, m)
     // Achievements module
     py::module achievements = m.def_submodule("achievements", "Achievements submodule");
 
-    achievements.def("achievements_instance_create", &gkpy_shim::achievements_exports::achievements_instance_create);
+    achievements.def("achievements_instance_create", &gkpy_shim::achievements_exports::achievements_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    achievements.def("achievements_instance_release", &gkpy_shim::achievements_exports::achievements_instance_release);
+    achievements.def("achievements_instance_release", &gkpy_shim::achievements_exports::achievements_instance_release, py::call_guard<py::gil_scoped_release>());
 
     achievements.def("list_achievements", &gkpy_shim::achievements_exports::list_achievements);
+    gkpy_shim::async::def_async(achievements, "list_achievements");
 
     achievements.def("get_achievement", &gkpy_shim::achievements_exports::get_achievement);
+    gkpy_shim::async::def_async(achievements, "get_achievement");
 
     py::module achievement_models = achievements.def_submodule("model", "Achievements Models submodule");
     py::class_<gkpy_shim::achievements_exports::models::achievement>(achievement_models, "achievement")
@@ -818,19 +1020,24 @@ PYBIND11_MODULE(aws_gamekit_py, m)
     // UserGameplayData module
     py::module user_gameplay_data = m.def_submodule("user_gameplay_data", "UserGameplayData submodule");
 
-    user_gameplay_data.def("user_gameplay_data_instance_create", &gkpy_shim::user_gameplay_data_exports::user_gameplay_data_instance_create);
+    user_gameplay_data.def("user_gameplay_data_instance_create", &gkpy_shim::user_gameplay_data_exports::user_gameplay_data_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    user_gameplay_data.def("user_gameplay_data_instance_release", &gkpy_shim::user_gameplay_data_exports::user_gameplay_data_instance_release);
+    user_gameplay_data.def("user_gameplay_data_instance_release", &gkpy_shim::user_gameplay_data_exports::user_gameplay_data_instance_release, py::call_guard<py::gil_scoped_release>());
 
-    user_gameplay_data.def("add_user_gameplay_data", &gkpy_shim::user_gameplay_data_exports::add_user_gameplay_data);
+    user_gameplay_data.def("add_user_gameplay_data", &gkpy_shim::user_gameplay_data_exports::add_user_gameplay_data, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(user_gameplay_data, "add_user_gameplay_data");
 
     user_gameplay_data.def("list_user_gameplay_data_bundles", &gkpy_shim::user_gameplay_data_exports::list_user_gameplay_data_bundles);
+    gkpy_shim::async::def_async(user_gameplay_data, "list_user_gameplay_data_bundles");
 
     user_gameplay_data.def("get_user_gameplay_data_bundle", &gkpy_shim::user_gameplay_data_exports::get_user_gameplay_data_bundle);
+    gkpy_shim::async::def_async(user_gameplay_data, "get_user_gameplay_data_bundle");
 
-    user_gameplay_data.def("delete_user_gameplay_data_bundle", &gkpy_shim::user_gameplay_data_exports::delete_user_gameplay_data_bundle);
+    user_gameplay_data.def("delete_user_gameplay_data_bundle", &gkpy_shim::user_gameplay_data_exports::delete_user_gameplay_data_bundle, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(user_gameplay_data, "delete_user_gameplay_data_bundle");
 
-    user_gameplay_data.def("delete_all_user_gameplay_data", &gkpy_shim::user_gameplay_data_exports::delete_all_user_gameplay_data);
+    user_gameplay_data.def("delete_all_user_gameplay_data", &gkpy_shim::user_gameplay_data_exports::delete_all_user_gameplay_data, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(user_gameplay_data, "delete_all_user_gameplay_data");
 
     py::module user_gameplay_data_models = user_gameplay_data.def_submodule("model", "User Gameplay Data Models submodule");
     py::class_<gkpy_shim::user_gameplay_data_exports::models::user_gameplay_data_bundle>(user_gameplay_data_models, "user_gameplay_data_bundle")
@@ -842,15 +1049,24 @@ PYBIND11_MODULE(aws_gamekit_py, m)
     // GameSaving module
     py::module game_saving = m.def_submodule("game_saving", "GameSaving submodule");
 
-    game_saving.def("game_saving_instance_create", &gkpy_shim::game_saving_exports::game_saving_instance_create);
+    game_saving.def("game_saving_instance_create", &gkpy_shim::game_saving_exports::game_saving_instance_create, py::call_guard<py::gil_scoped_release>());
 
-    game_saving.def("game_saving_instance_release", &gkpy_shim::game_saving_exports::game_saving_instance_release);
+    game_saving.def("game_saving_instance_release", &gkpy_shim::game_saving_exports::game_saving_instance_release, py::call_guard<py::gil_scoped_release>());
 
     game_saving.def("get_all_slot_sync_statuses", &gkpy_shim::game_saving_exports::get_all_slot_sync_statuses);
+    gkpy_shim::async::def_async(game_saving, "get_all_slot_sync_statuses");
 
     game_saving.def("save_slot", &gkpy_shim::game_saving_exports::save_slot);
+    game_saving.def("save_slot", &gkpy_shim::game_saving_exports::save_slot_from_buffer,
+        py::arg("game_saving_handle"), py::arg("slot_name"), py::arg("data"), py::arg("metadata") = "", py::arg("epoch_time") = 0, py::arg("override_sync") = false, py::arg("local_slot_information_file_path") = "");
+    gkpy_shim::async::def_async(game_saving, "save_slot");
+
+    game_saving.def("load_slot", &gkpy_shim::game_saving_exports::load_slot,
+        py::arg("game_saving_handle"), py::arg("slot_name"), py::arg("into") = py::none(), py::arg("override_sync") = false, py::arg("local_slot_information_file_path") = "");
+    gkpy_shim::async::def_async(game_saving, "load_slot");
 
-    game_saving.def("delete_slot", &gkpy_shim::game_saving_exports::delete_slot);
+    game_saving.def("delete_slot", &gkpy_shim::game_saving_exports::delete_slot, py::call_guard<py::gil_scoped_release>());
+    gkpy_shim::async::def_async(game_saving, "delete_slot");
 
     py::module game_saving_models = game_saving.def_submodule("model", "Game Saving Data Models submodule");
     py::class_<gkpy_shim::game_saving_exports::models::slot>(game_saving_models, "slot")
@@ -3,6 +3,7 @@
 
 import Debug.aws_gamekit_py as gamekit
 
+import asyncio
 import os
 import pytest
 import time
@@ -149,6 +150,17 @@ class TestGamekit:
     def test_consts(self):
         assert(gamekit.GAMEKIT_SUCCESS == 0)
 
+    @pytest.mark.offline
+    def test_async_variants(self):
+        assert(callable(gamekit.core.resources_instance_create_or_update_stack_async))
+        assert(callable(gamekit.identity.identity_login_async))
+        assert(callable(gamekit.user_gameplay_data.add_user_gameplay_data_async))
+        assert(callable(gamekit.game_saving.save_slot_async))
+
+        # Awaitables are scheduled on the running event loop
+        with pytest.raises(RuntimeError):
+            gamekit.core.get_aws_account_id_async("", "")
+
     @pytest.mark.identity
     def test_login(self, identity_instance):
         assert(identity_instance is not None)
@@ -190,6 +202,28 @@ class TestGamekit:
 
         gamekit.user_gameplay_data.user_gameplay_data_instance_release(user_gameplay_data)
 
+    @pytest.mark.userdata
+    def test_userdata_async(self, identity_instance, session_manager):
+        bundle_names = ["foo{}".format(i) for i in range(4)]
+
+        # Instance handles must not be used by several threads at once, so each concurrent call gets its own
+        handles = [gamekit.user_gameplay_data.user_gameplay_data_instance_create(session_manager) for _ in bundle_names]
+
+        async def run():
+            # The calls release the GIL, so they run concurrently on the default executor
+            results = await asyncio.gather(*[gamekit.user_gameplay_data.add_user_gameplay_data_async(handle, name, [("bar", "baz")]) for handle, name in zip(handles, bundle_names)])
+            assert(all(result == gamekit.GAMEKIT_SUCCESS for result in results))
+
+            status, bundles = await gamekit.user_gameplay_data.list_user_gameplay_data_bundles_async(handles[0])
+            assert(gamekit.GAMEKIT_SUCCESS == status)
+            assert(sorted(bundles) == bundle_names)
+
+            assert(gamekit.GAMEKIT_SUCCESS == await gamekit.user_gameplay_data.delete_all_user_gameplay_data_async(handles[0]))
+
+        asyncio.run(run())
+        for handle in handles:
+            gamekit.user_gameplay_data.user_gameplay_data_instance_release(handle)
+
     @pytest.mark.gamesaving
     def test_gamesaving(self, identity_instance, game_saving_instance):
         slot_name = "test"
@@ -224,6 +258,36 @@ class TestGamekit:
         assert(gamekit.GAMEKIT_SUCCESS == status)
         assert(len(slots) == 0)
 
+    @pytest.mark.gamesaving
+    def test_gamesaving_buffers(self, identity_instance, game_saving_instance):
+        slot_name = "test_buffers"
+        content = bytearray(open(__file__, 'rb').read())
+        info_path = os.path.abspath(__file__)
+
+        # save straight from a memoryview, without converting to a list
+        result, slot_copy = gamekit.game_saving.save_slot(game_saving_instance, slot_name, memoryview(content), override_sync=True, local_slot_information_file_path=info_path)
+        assert(gamekit.GAMEKIT_SUCCESS == result)
+        assert(slot_copy.slot_name == slot_name)
+
+        # load into a bytearray sized from the cloud slot
+        status, data = gamekit.game_saving.load_slot(game_saving_instance, slot_name, override_sync=True, local_slot_information_file_path=info_path)
+        assert(gamekit.GAMEKIT_SUCCESS == status)
+        assert(isinstance(data, memoryview))
+        assert(data == content)
+
+        # load into a larger caller provided buffer, only the slot's bytes are returned
+        buffer = bytearray(len(content) + 16)
+        status, data = gamekit.game_saving.load_slot(game_saving_instance, slot_name, buffer, override_sync=True, local_slot_information_file_path=info_path)
+        assert(gamekit.GAMEKIT_SUCCESS == status)
+        assert(data == content)
+        assert(buffer[:len(content)] == content)
+
+        # read-only buffers can't be loaded into
+        with pytest.raises(BufferError):
+            gamekit.game_saving.load_slot(game_saving_instance, slot_name, bytes(len(content)), override_sync=True, local_slot_information_file_path=info_path)
+
+        assert(gamekit.GAMEKIT_SUCCESS == gamekit.game_saving.delete_slot(game_saving_instance, slot_name))
+
     @pytest.mark.slow
     def test_deploy(self, account_instance, settings_instance, main_resource_instance, identity_resource_instance, gamesaving_resource_instance, userdata_resource_instance, achievements_resource_instance):
         result = gamekit.core.account_instance_bootstrap(account_instance)
@@ -0,0 +1,45 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <memory>
+#include <string>
+
+// AWS SDK
+#include <aws/core/http/HttpRequest.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+namespace GameKit
+{
+    namespace Benchmarks
+    {
+        // Log callback that drops every message, so benchmarks measure GameKit rather than the console
+        void NoOpLog(unsigned int level, const char* message, int size);
+
+        // Directory created under the temp directory, removed with its contents when destroyed
+        class TempDirectory
+        {
+        private:
+            std::string m_path;
+
+        public:
+            explicit TempDirectory(const std::string& prefix);
+            ~TempDirectory();
+
+            TempDirectory(const TempDirectory&) = delete;
+            TempDirectory& operator=(const TempDirectory&) = delete;
+
+            inline const std::string& GetPath() const { return m_path; }
+        };
+
+        // Write fileCount files of fileSize bytes of compressible text into directory, spread over a few subdirectories
+        void WriteTestFiles(const std::string& directory, size_t fileCount, size_t fileSize);
+
+        // Build a User Gameplay Data style POST request with a JSON body of about bodySize bytes, using the fake HTTP request
+        std::shared_ptr<Aws::Http::HttpRequest> CreateJsonRequest(const std::string& bundle, size_t bodySize);
+    }
+}
@@ -0,0 +1,116 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/zipper.h>
+#include <aws/gamekit/core/utils/file_utils.h>
+
+// Benchmarks
+#include "benchmark_common.h"
+
+using namespace GameKit::Benchmarks;
+
+namespace
+{
+    static const size_t FILE_SIZE = 16 * 1024;
+
+    void zipDirectory(benchmark::State& state, const std::string& sourceDirectory, const std::string& zipFile)
+    {
+        GameKit::Zipper zipper(sourceDirectory, zipFile);
+        if (!zipper.AddDirectoryToZipFile(sourceDirectory) || !zipper.CloseZipFile())
+        {
+            state.SkipWithError("Zipper failed");
+        }
+    }
+}
+
+#pragma region Directory Hash
+// Files are unchanged between iterations, so their digests come from the cache after the first one
+static void BM_CalculateDirectoryHash_Unchanged(benchmark::State& state)
+{
+    const size_t fileCount = static_cast<size_t>(state.range(0));
+    const TempDirectory directory("gamekit-hash");
+    WriteTestFiles(directory.GetPath(), fileCount, FILE_SIZE);
+
+    for (auto _ : state)
+    {
+        std::string hash;
+        if (GameKit::Utils::FileUtils::CalculateDirectoryHash(directory.GetPath(), hash) != GAMEKIT_SUCCESS)
+        {
+            state.SkipWithError("CalculateDirectoryHash failed");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * fileCount);
+}
+BENCHMARK(BM_CalculateDirectoryHash_Unchanged)->RangeMultiplier(8)->Range(8, 512)->Unit(benchmark::kMillisecond);
+
+// Every file is rewritten between iterations, so each one is read and hashed again
+static void BM_CalculateDirectoryHash_Rewritten(benchmark::State& state)
+{
+    const size_t fileCount = static_cast<size_t>(state.range(0));
+    const TempDirectory directory("gamekit-hash");
+    size_t rewriteCount = 0;
+
+    for (auto _ : state)
+    {
+        // Alternate the size so the rewrite is detected even within the timestamp resolution of the file system
+        state.PauseTiming();
+        WriteTestFiles(directory.GetPath(), fileCount, FILE_SIZE + rewriteCount++ % 2);
+        state.ResumeTiming();
+
+        std::string hash;
+        if (GameKit::Utils::FileUtils::CalculateDirectoryHash(directory.GetPath(), hash) != GAMEKIT_SUCCESS)
+        {
+            state.SkipWithError("CalculateDirectoryHash failed");
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * fileCount * FILE_SIZE);
+}
+BENCHMARK(BM_CalculateDirectoryHash_Rewritten)->RangeMultiplier(8)->Range(8, 512)->Unit(benchmark::kMillisecond);
+#pragma endregion
+
+#pragma region Zipper
+// Every entry is deflated
+static void BM_Zipper_NoEntryCache(benchmark::State& state)
+{
+    const size_t fileCount = static_cast<size_t>(state.range(0));
+    const TempDirectory sourceDirectory("gamekit-zip-source");
+    const TempDirectory outputDirectory("gamekit-zip-output");
+    WriteTestFiles(sourceDirectory.GetPath(), fileCount, FILE_SIZE);
+    GameKit::Zipper::SetEntryCacheDirectory("");
+
+    for (auto _ : state)
+    {
+        zipDirectory(state, sourceDirectory.GetPath(), outputDirectory.GetPath() + "/layer.zip");
+    }
+
+    state.SetBytesProcessed(state.iterations() * fileCount * FILE_SIZE);
+}
+BENCHMARK(BM_Zipper_NoEntryCache)->RangeMultiplier(8)->Range(8, 512)->Unit(benchmark::kMillisecond);
+
+// Every entry is copied from the compressed entry cache, as when a layer is rebuilt without changes
+static void BM_Zipper_WarmEntryCache(benchmark::State& state)
+{
+    const size_t fileCount = static_cast<size_t>(state.range(0));
+    const TempDirectory sourceDirectory("gamekit-zip-source");
+    const TempDirectory outputDirectory("gamekit-zip-output");
+    const TempDirectory cacheDirectory("gamekit-zip-cache");
+    WriteTestFiles(sourceDirectory.GetPath(), fileCount, FILE_SIZE);
+    GameKit::Zipper::SetEntryCacheDirectory(cacheDirectory.GetPath());
+    zipDirectory(state, sourceDirectory.GetPath(), outputDirectory.GetPath() + "/layer.zip");
+
+    for (auto _ : state)
+    {
+        zipDirectory(state, sourceDirectory.GetPath(), outputDirectory.GetPath() + "/layer.zip");
+    }
+
+    GameKit::Zipper::SetEntryCacheDirectory("");
+    state.SetBytesProcessed(state.iterations() * fileCount * FILE_SIZE);
+}
+BENCHMARK(BM_Zipper_WarmEntryCache)->RangeMultiplier(8)->Range(8, 512)->Unit(benchmark::kMillisecond);
+#pragma endregion
@@ -0,0 +1,201 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+// GameKit
+#include <aws/gamekit/core/utils/gamekit_httpclient_types.h>
+#include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data_client.h>
+
+// Benchmarks
+#include "benchmark_common.h"
+#include "fake_http_client.h"
+
+using namespace GameKit::Benchmarks;
+using namespace GameKit::UserGameplayData;
+using namespace GameKit::Utils::HttpClient;
+
+namespace
+{
+    static const size_t MAX_QUEUE_SIZE = 1 << 16;
+    static const size_t REQUEST_BODY_SIZE = 512;
+
+    // Exposes the queue filtering of the User Gameplay Data client. The fake HTTP client is never called.
+    class BenchmarkHttpClient : public UserGameplayDataHttpClient
+    {
+    public:
+        BenchmarkHttpClient() :
+            UserGameplayDataHttpClient(std::make_shared<FakeHttpClient>(), [](std::shared_ptr<Aws::Http::HttpRequest>) {}, 1, std::make_shared<ConstantIntervalStrategy>(), MAX_QUEUE_SIZE, NoOpLog)
+        {}
+
+        using UserGameplayDataHttpClient::filterQueue;
+    };
+
+    // Operations on a quarter as many items as operations, so about three quarters are compacted away, with shuffled timestamps
+    OperationQueue createOperations(size_t count)
+    {
+        std::mt19937 randomEngine(42);
+        std::vector<long long> timestamps(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            timestamps[i] = static_cast<long long>(i);
+        }
+        std::shuffle(timestamps.begin(), timestamps.end(), randomEngine);
+
+        const size_t itemCount = (std::max)(count / 4, size_t(1));
+        OperationQueue operations;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t item = i % itemCount;
+            const std::string bundle = "bundle" + std::to_string(item % 8);
+            const UserGameplayDataOperationType type = i % 10 == 0 ? UserGameplayDataOperationType::Delete : UserGameplayDataOperationType::Write;
+            operations.push_back(std::make_shared<UserGameplayDataOperation>(type, bundle, "item" + std::to_string(item),
+                CreateJsonRequest(bundle, REQUEST_BODY_SIZE), Aws::Http::HttpResponseCode::CREATED, OPERATION_ATTEMPTS_NO_LIMIT, std::chrono::milliseconds(timestamps[i])));
+        }
+
+        return operations;
+    }
+
+    // Cache file in the format written by BaseHttpClient::PersistQueue()
+    void writeCacheFile(const std::string& filePath, size_t operationCount)
+    {
+        const OperationQueue operations = createOperations(operationCount);
+
+        std::ofstream cacheFile(filePath, std::ios::binary);
+        GameKit::Utils::Serialization::BinWrite(cacheFile, operations.size());
+        for (const std::shared_ptr<IOperation>& operation : operations)
+        {
+            UserGameplayDataOperation::TrySerializeBinary(cacheFile, operation);
+        }
+    }
+
+    bool serializeOperation(std::ostream& os, const std::shared_ptr<IOperation> operation, FuncLogCallback logCb)
+    {
+        return UserGameplayDataOperation::TrySerializeBinary(os, operation, logCb);
+    }
+
+    bool deserializeOperation(std::istream& is, std::shared_ptr<IOperation>& outOperation, FuncLogCallback logCb)
+    {
+        return UserGameplayDataOperation::TryDeserializeBinary(is, outOperation, logCb);
+    }
+}
+
+#pragma region Queue Filtering
+static void BM_FilterQueue(benchmark::State& state)
+{
+    const size_t operationCount = static_cast<size_t>(state.range(0));
+    BenchmarkHttpClient client;
+    const OperationQueue operations = createOperations(operationCount);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        OperationQueue queue = operations;
+        OperationQueue filtered;
+        for (const std::shared_ptr<IOperation>& operation : queue)
+        {
+            operation->Discard = false;
+        }
+        state.ResumeTiming();
+
+        client.filterQueue(&queue, &filtered);
+        benchmark::DoNotOptimize(filtered.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * operationCount);
+}
+BENCHMARK(BM_FilterQueue)->RangeMultiplier(8)->Range(8, 8 << 9)->Unit(benchmark::kMicrosecond);
+#pragma endregion
+
+#pragma region Request Serialization
+static void BM_TrySerializeRequestBinary(benchmark::State& state)
+{
+    const auto request = CreateJsonRequest("bundle", static_cast<size_t>(state.range(0)));
+    size_t serializedSize = 0;
+
+    for (auto _ : state)
+    {
+        std::ostringstream os;
+        TrySerializeRequestBinary(os, request);
+        serializedSize = static_cast<size_t>(os.tellp());
+    }
+
+    state.SetBytesProcessed(state.iterations() * serializedSize);
+}
+BENCHMARK(BM_TrySerializeRequestBinary)->RangeMultiplier(16)->Range(64, 64 << 8);
+
+static void BM_TryDeserializeRequestBinary(benchmark::State& state)
+{
+    std::ostringstream os;
+    TrySerializeRequestBinary(os, CreateJsonRequest("bundle", static_cast<size_t>(state.range(0))));
+    const std::string serialized = os.str();
+
+    for (auto _ : state)
+    {
+        std::istringstream is(serialized);
+        std::shared_ptr<Aws::Http::HttpRequest> request;
+        TryDeserializeRequestBinary(is, request);
+        benchmark::DoNotOptimize(request);
+    }
+
+    state.SetBytesProcessed(state.iterations() * serialized.size());
+}
+BENCHMARK(BM_TryDeserializeRequestBinary)->RangeMultiplier(16)->Range(64, 64 << 8);
+#pragma endregion
+
+#pragma region Offline Queue Cache
+static void BM_PersistQueue(benchmark::State& state)
+{
+    const size_t operationCount = static_cast<size_t>(state.range(0));
+    const TempDirectory directory("gamekit-persist-queue");
+    const std::string inputFile = directory.GetPath() + "/input.dat";
+    const std::string outputFile = directory.GetPath() + "/output.dat";
+    writeCacheFile(inputFile, operationCount);
+    BenchmarkHttpClient client;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        client.LoadQueue(inputFile, deserializeOperation, false);
+        state.ResumeTiming();
+
+        if (!client.PersistQueue(outputFile, serializeOperation))
+        {
+            state.SkipWithError("PersistQueue failed");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * operationCount);
+}
+BENCHMARK(BM_PersistQueue)->RangeMultiplier(8)->Range(8, 8 << 6)->Unit(benchmark::kMicrosecond);
+
+static void BM_LoadQueue(benchmark::State& state)
+{
+    const size_t operationCount = static_cast<size_t>(state.range(0));
+    const TempDirectory directory("gamekit-load-queue");
+    const std::string inputFile = directory.GetPath() + "/input.dat";
+    writeCacheFile(inputFile, operationCount);
+    BenchmarkHttpClient client;
+
+    for (auto _ : state)
+    {
+        if (!client.LoadQueue(inputFile, deserializeOperation, false))
+        {
+            state.SkipWithError("LoadQueue failed");
+            break;
+        }
+
+        state.PauseTiming();
+        client.DropAllCachedEvents();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * operationCount);
+}
+BENCHMARK(BM_LoadQueue)->RangeMultiplier(8)->Range(8, 8 << 6)->Unit(benchmark::kMicrosecond);
+#pragma endregion
@@ -0,0 +1,421 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <queue>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/model/request_metrics_snapshot.h>
+#include <aws/gamekit/core/utils/request_metrics.h>
+
+// Load Test
+#include "load_test_driver.h"
+
+using namespace GameKit::LoadTest;
+using GameKit::Utils::RequestMetrics;
+
+namespace
+{
+    static const std::string ID_TOKEN_PREFIX = "loadtest-session-";
+    static const std::string CALL_ENDPOINT_PREFIX = "LoadTest.";
+    static const char* const SLOT_NAME = "autosave";
+    static const char* const SLOT_INFORMATION_FILE = "autosave.json";
+    static const unsigned int BUNDLE_COUNT = 4;
+    static const char* const BUNDLE_ITEM_KEYS[] = { "score", "level", "coins", "position" };
+    static const size_t BUNDLE_ITEM_COUNT = sizeof(BUNDLE_ITEM_KEYS) / sizeof(BUNDLE_ITEM_KEYS[0]);
+
+    // Slot information files are discarded, every session starts without local slots
+    bool writeSlotInformation(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, const uint8_t* data, const unsigned int size)
+    {
+        return true;
+    }
+
+    bool readSlotInformation(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, uint8_t* data, unsigned int size)
+    {
+        return false;
+    }
+
+    unsigned int getSlotInformationSize(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath)
+    {
+        return 0;
+    }
+
+    void ignoreUnprocessedItem(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* responseKey, const char* responseValue)
+    {}
+
+    std::string getClientConfig()
+    {
+        const std::string baseUrl = "https://" + API_GATEWAY_HOST;
+        return GameKit::ClientSettings::Authentication::SETTINGS_IDENTITY_REGION + ": us-west-2\n" +
+            GameKit::ClientSettings::UserGameplayData::SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL + ": " + baseUrl + USER_GAMEPLAY_DATA_PATH + "\n" +
+            GameKit::ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL + ": " + baseUrl + GAME_SAVING_PATH + "\n";
+    }
+
+    double toMilliseconds(unsigned long long microseconds)
+    {
+        return static_cast<double>(microseconds) / 1000.0;
+    }
+}
+
+#pragma region Constructor/Deconstructor
+LoadTestDriver::LoadTestDriver(const LoadTestSettings& settings, std::shared_ptr<StandInServer> server, std::shared_ptr<StandInHttpClientFactory> factory) :
+    m_settings(settings), m_server(server), m_factory(factory)
+{
+    m_settings.SessionCount = (std::max)(m_settings.SessionCount, 1u);
+    m_settings.ThreadCount = (std::max)((std::min)(m_settings.ThreadCount, m_settings.SessionCount), 1u);
+    m_settings.ReportInterval = (std::max)(m_settings.ReportInterval, std::chrono::seconds(1));
+
+    // The same save data for every session, random so it doesn't compress
+    std::mt19937 randomEngine(static_cast<uint32_t>(m_settings.Seed));
+    m_slotData.resize(m_settings.SlotSize);
+    std::generate(m_slotData.begin(), m_slotData.end(), [&]() { return static_cast<uint8_t>(randomEngine()); });
+}
+
+LoadTestDriver::~LoadTestDriver()
+{
+    // Stops the retry threads before the features they process are destroyed
+    m_sessions.clear();
+}
+#pragma endregion
+
+#pragma region Public Methods
+bool LoadTestDriver::Run(std::ostream& output)
+{
+    std::ofstream csvFile;
+    if (!m_settings.CsvFile.empty())
+    {
+        csvFile.open(m_settings.CsvFile);
+        if (!csvFile)
+        {
+            output << "Unable to open " << m_settings.CsvFile << std::endl;
+            return false;
+        }
+
+        csvFile << "elapsed_seconds,endpoint,requests,failed_requests,retries,dropped,queue_depth,bytes_sent,bytes_received,"
+            "latency_mean_us,latency_p50_us,latency_p90_us,latency_p99_us,latency_max_us,queued_operations,resident_memory_bytes" << std::endl;
+    }
+
+    output << "Profile " << m_server->GetProfile().Name << ": " << m_server->GetProfile().Description << std::endl;
+    output << "Creating " << m_settings.SessionCount << " sessions..." << std::endl;
+    createSessions();
+    output << "Sessions created, resident memory " << std::fixed << std::setprecision(1) << GetResidentMemoryBytes() / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+    // Only report what happens during the run
+    std::vector<RequestMetricsSnapshot> discarded;
+    RequestMetrics::Snapshot(discarded, true);
+    StandInStatistics previousStatistics = m_server->GetStatistics();
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    const std::chrono::steady_clock::time_point endTime = startTime + m_settings.Duration;
+    for (const std::unique_ptr<Session>& session : m_sessions)
+    {
+        session->NextCallTime = startTime;
+        scheduleNextCall(*session);
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(m_settings.ThreadCount);
+    for (unsigned int i = 0; i < m_settings.ThreadCount; ++i)
+    {
+        threads.emplace_back(&LoadTestDriver::runThread, this, i, startTime, endTime);
+    }
+
+    for (std::chrono::steady_clock::time_point reportTime = startTime + m_settings.ReportInterval; reportTime <= endTime; reportTime += m_settings.ReportInterval)
+    {
+        std::this_thread::sleep_until(reportTime);
+        report(output, csvFile.is_open() ? &csvFile : nullptr, startTime, previousStatistics);
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Calls in flight at the end of the run, and whatever the retry threads sent meanwhile
+    report(output, csvFile.is_open() ? &csvFile : nullptr, startTime, previousStatistics);
+
+    return true;
+}
+
+unsigned long long LoadTestDriver::GetResidentMemoryBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.WorkingSetSize;
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+    {
+        return info.resident_size;
+    }
+#else
+    // The second field of statm is the resident set size in pages
+    std::ifstream statm("/proc/self/statm");
+    unsigned long long totalPages = 0;
+    unsigned long long residentPages = 0;
+    if (statm >> totalPages >> residentPages)
+    {
+        return residentPages * static_cast<unsigned long long>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+
+    return 0;
+}
+#pragma endregion
+
+#pragma region Private Methods
+void LoadTestDriver::createSessions()
+{
+    const std::string clientConfig = getClientConfig();
+
+    FileActions fileActions = {};
+    fileActions.fileWriteCallback = writeSlotInformation;
+    fileActions.fileReadCallback = readSlotInformation;
+    fileActions.fileSizeCallback = getSlotInformationSize;
+
+    m_sessions.reserve(m_settings.SessionCount);
+    for (unsigned int i = 0; i < m_settings.SessionCount; ++i)
+    {
+        std::unique_ptr<Session> session(new Session());
+        session->IdToken = ID_TOKEN_PREFIX + std::to_string(i);
+
+        session->SessionManager.reset(new Authentication::GameKitSessionManager("", m_settings.LogCallback));
+        session->SessionManager->ReloadConfigFromFileContents(clientConfig);
+        session->SessionManager->SetToken(TokenType::IdToken, session->IdToken);
+
+        session->UserGameplayDataFeature.reset(new UserGameplayData::UserGameplayData(session->SessionManager.get(), m_settings.LogCallback));
+        session->UserGameplayDataFeature->SetClientSettings(m_settings.ClientSettings);
+        session->UserGameplayDataFeature->StartRetryBackgroundThread();
+
+        session->GameSavingFeature.reset(new GameSaving::GameSaving(session->SessionManager.get(), m_settings.LogCallback, nullptr, 0, fileActions));
+
+        std::seed_seq seed({ static_cast<uint32_t>(m_settings.Seed), static_cast<uint32_t>(m_settings.Seed >> 32), static_cast<uint32_t>(i) });
+        session->RandomEngine.seed(seed);
+
+        m_sessions.push_back(std::move(session));
+    }
+}
+
+void LoadTestDriver::runThread(unsigned int threadIndex, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime)
+{
+    std::vector<uint8_t> loadBuffer(m_settings.SlotSize);
+
+    // This thread's sessions, the one with the earliest call on top
+    const auto isLater = [](const Session* left, const Session* right) { return left->NextCallTime > right->NextCallTime; };
+    std::priority_queue<Session*, std::vector<Session*>, decltype(isLater)> sessions(isLater);
+    for (size_t i = threadIndex; i < m_sessions.size(); i += m_settings.ThreadCount)
+    {
+        sessions.push(m_sessions[i].get());
+    }
+
+    while (!sessions.empty() && sessions.top()->NextCallTime < endTime)
+    {
+        Session* session = sessions.top();
+        sessions.pop();
+
+        std::this_thread::sleep_until(session->NextCallTime);
+
+        // Calls start late when every thread is blocked on slow calls, the load is then limited by the thread count
+        const long long lag = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - session->NextCallTime).count();
+        long long maxLag = m_maxScheduleLagMicroseconds.load(std::memory_order_relaxed);
+        while (lag > maxLag && !m_maxScheduleLagMicroseconds.compare_exchange_weak(maxLag, lag, std::memory_order_relaxed))
+        {}
+
+        makeCall(*session, loadBuffer);
+        scheduleNextCall(*session);
+        sessions.push(session);
+    }
+}
+
+void LoadTestDriver::makeCall(Session& session, std::vector<uint8_t>& loadBuffer)
+{
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const bool isGameSaving = unit(session.RandomEngine) < m_settings.GameSavingFraction;
+    const bool isFirstKind = unit(session.RandomEngine) < 0.5;
+
+    m_callsInFlight.fetch_add(1, std::memory_order_relaxed);
+    const std::chrono::steady_clock::time_point callStart = std::chrono::steady_clock::now();
+
+    std::string operation;
+    unsigned int status;
+    if (isGameSaving && isFirstKind && session.HasSavedSlot)
+    {
+        operation = "LoadSlot";
+        status = loadSlot(session, loadBuffer);
+    }
+    else if (isGameSaving)
+    {
+        operation = "SaveSlot";
+        status = saveSlot(session);
+    }
+    else if (isFirstKind)
+    {
+        operation = "AddUserGameplayData";
+        status = addUserGameplayData(session);
+    }
+    else
+    {
+        operation = "UpdateUserGameplayDataBundleItem";
+        status = updateUserGameplayDataBundleItem(session);
+    }
+
+    const std::chrono::microseconds latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - callStart);
+    m_callsInFlight.fetch_sub(1, std::memory_order_relaxed);
+    ++session.CallCount;
+
+    // Calls are recorded like requests: enqueued calls as 202 Accepted, failed calls as 500
+    Aws::Http::HttpResponseCode responseCode = Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR;
+    if (status == GAMEKIT_SUCCESS)
+    {
+        responseCode = Aws::Http::HttpResponseCode::OK;
+    }
+    else if (status == GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED)
+    {
+        responseCode = Aws::Http::HttpResponseCode::ACCEPTED;
+    }
+
+    RequestMetrics::GetEndpoint(CALL_ENDPOINT_PREFIX + operation).RecordRequest(latency, responseCode, 0, 0);
+}
+
+unsigned int LoadTestDriver::addUserGameplayData(Session& session)
+{
+    const std::string bundleName = "bundle" + std::to_string(session.CallCount % BUNDLE_COUNT);
+
+    std::string values[BUNDLE_ITEM_COUNT];
+    const char* valuePointers[BUNDLE_ITEM_COUNT];
+    for (size_t i = 0; i < BUNDLE_ITEM_COUNT; ++i)
+    {
+        values[i] = std::to_string(session.RandomEngine() % 100000);
+        valuePointers[i] = values[i].c_str();
+    }
+
+    UserGameplayDataBundle bundle = { bundleName.c_str(), BUNDLE_ITEM_KEYS, valuePointers, BUNDLE_ITEM_COUNT };
+    return session.UserGameplayDataFeature->AddUserGameplayData(bundle, nullptr, ignoreUnprocessedItem);
+}
+
+unsigned int LoadTestDriver::updateUserGameplayDataBundleItem(Session& session)
+{
+    const std::string bundleName = "bundle" + std::to_string(session.CallCount % BUNDLE_COUNT);
+    const std::string value = std::to_string(session.RandomEngine() % 100000);
+
+    UserGameplayDataBundleItemValue itemValue = { bundleName.c_str(), BUNDLE_ITEM_KEYS[session.CallCount % BUNDLE_ITEM_COUNT], value.c_str() };
+    return session.UserGameplayDataFeature->UpdateUserGameplayDataBundleItem(itemValue);
+}
+
+unsigned int LoadTestDriver::saveSlot(Session& session)
+{
+    GameSavingModel model;
+    model.slotName = SLOT_NAME;
+    model.overrideSync = true;
+    model.data = m_slotData.data();
+    model.dataSize = static_cast<unsigned int>(m_slotData.size());
+    model.localSlotInformationFilePath = SLOT_INFORMATION_FILE;
+
+    const unsigned int status = session.GameSavingFeature->SaveSlot(nullptr, nullptr, model);
+    session.HasSavedSlot |= status == GAMEKIT_SUCCESS;
+
+    return status;
+}
+
+unsigned int LoadTestDriver::loadSlot(Session& session, std::vector<uint8_t>& loadBuffer)
+{
+    GameSavingModel model;
+    model.slotName = SLOT_NAME;
+    model.overrideSync = true;
+    model.data = loadBuffer.data();
+    model.dataSize = static_cast<unsigned int>(loadBuffer.size());
+    model.localSlotInformationFilePath = SLOT_INFORMATION_FILE;
+
+    return session.GameSavingFeature->LoadSlot(nullptr, nullptr, model);
+}
+
+void LoadTestDriver::scheduleNextCall(Session& session)
+{
+    // Open loop: calls are scheduled whether or not the previous one completed on time
+    std::exponential_distribution<double> interval((std::max)(m_settings.CallsPerSessionPerSecond, 0.001));
+    session.NextCallTime += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval(session.RandomEngine)));
+}
+
+void LoadTestDriver::report(std::ostream& output, std::ostream* csv, std::chrono::steady_clock::time_point startTime, StandInStatistics& previousStatistics)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const double elapsedSeconds = std::chrono::duration<double>(now - startTime).count();
+    const double intervalSeconds = static_cast<double>(m_settings.ReportInterval.count());
+
+    std::vector<RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, true);
+
+    // Calls first, then the endpoints they called
+    std::stable_partition(snapshots.begin(), snapshots.end(), [](const RequestMetricsSnapshot& snapshot)
+    {
+        return std::string(snapshot.endpoint).compare(0, CALL_ENDPOINT_PREFIX.size(), CALL_ENDPOINT_PREFIX) == 0;
+    });
+
+    // Requests still alive after the calls that created them returned are held by retry queues
+    const long long queuedOperations = (std::max)(m_factory->GetLiveRequestCount() - m_callsInFlight.load(std::memory_order_relaxed), 0LL);
+    const unsigned long long residentMemory = GetResidentMemoryBytes();
+    const long long maxLag = m_maxScheduleLagMicroseconds.exchange(0, std::memory_order_relaxed);
+
+    const StandInStatistics statistics = m_server->GetStatistics();
+    output << std::fixed << std::setprecision(1)
+        << "[" << std::setw(6) << elapsedSeconds << " s] resident memory " << residentMemory / (1024.0 * 1024.0) << " MiB, "
+        << queuedOperations << " queued operations, max schedule lag " << toMilliseconds(static_cast<unsigned long long>(maxLag)) << " ms" << std::endl
+        << "    stand-in: " << statistics.RequestCount - previousStatistics.RequestCount << " requests, "
+        << statistics.ConnectionFailureCount - previousStatistics.ConnectionFailureCount << " lost, "
+        << statistics.TimeoutCount - previousStatistics.TimeoutCount << " timed out, "
+        << statistics.ServerErrorCount - previousStatistics.ServerErrorCount << " 503, "
+        << statistics.ThrottledCount - previousStatistics.ThrottledCount << " 429, "
+        << statistics.NotFoundCount - previousStatistics.NotFoundCount << " not found" << std::endl;
+    previousStatistics = statistics;
+
+    output << "    " << std::left << std::setw(48) << "endpoint" << std::right
+        << std::setw(9) << "req/s" << std::setw(9) << "failed" << std::setw(9) << "retries" << std::setw(9) << "dropped" << std::setw(9) << "queue"
+        << std::setw(10) << "p50 ms" << std::setw(10) << "p90 ms" << std::setw(10) << "p99 ms" << std::setw(10) << "max ms" << std::endl;
+
+    for (const RequestMetricsSnapshot& snapshot : snapshots)
+    {
+        if (snapshot.requestCount == 0 && snapshot.droppedCount == 0 && snapshot.queueDepth == 0)
+        {
+            continue;
+        }
+
+        output << "    " << std::left << std::setw(48) << snapshot.endpoint << std::right
+            << std::setw(9) << snapshot.requestCount / intervalSeconds
+            << std::setw(9) << snapshot.failedRequestCount
+            << std::setw(9) << snapshot.retryCount
+            << std::setw(9) << snapshot.droppedCount
+            << std::setw(9) << snapshot.queueDepth
+            << std::setw(10) << toMilliseconds(snapshot.latencyP50Microseconds)
+            << std::setw(10) << toMilliseconds(snapshot.latencyP90Microseconds)
+            << std::setw(10) << toMilliseconds(snapshot.latencyP99Microseconds)
+            << std::setw(10) << toMilliseconds(snapshot.latencyMaxMicroseconds) << std::endl;
+
+        if (csv != nullptr)
+        {
+            *csv << elapsedSeconds << "," << snapshot.endpoint << "," << snapshot.requestCount << "," << snapshot.failedRequestCount << ","
+                << snapshot.retryCount << "," << snapshot.droppedCount << "," << snapshot.queueDepth << ","
+                << snapshot.bytesSent << "," << snapshot.bytesReceived << "," << snapshot.latencyMeanMicroseconds << ","
+                << snapshot.latencyP50Microseconds << "," << snapshot.latencyP90Microseconds << "," << snapshot.latencyP99Microseconds << ","
+                << snapshot.latencyMaxMicroseconds << "," << queuedOperations << "," << residentMemory << std::endl;
+        }
+    }
+}
+#pragma endregion
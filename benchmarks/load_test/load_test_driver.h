@@ -0,0 +1,118 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/authentication/gamekit_session_manager.h>
+#include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/game-saving/gamekit_game_saving.h>
+#include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data.h>
+
+// Load Test
+#include "stand_in_server.h"
+
+namespace GameKit
+{
+    namespace LoadTest
+    {
+        struct LoadTestSettings
+        {
+            // Simulated game sessions, each with its own session manager, User Gameplay Data retry thread and Game Saving instance
+            unsigned int SessionCount = 1000;
+
+            // Threads making the sessions' calls. Calls block for the stand-in latency, so this bounds the calls in flight.
+            unsigned int ThreadCount = 128;
+
+            std::chrono::seconds Duration{ 60 };
+            std::chrono::seconds ReportInterval{ 5 };
+
+            // Each session calls GameKit at Poisson distributed times at this average rate
+            double CallsPerSessionPerSecond = 0.5;
+
+            // Fraction of calls that save or load a Game Saving slot, the others write User Gameplay Data
+            double GameSavingFraction = 0.1;
+            unsigned int SlotSize = 16 * 1024;
+
+            uint64_t Seed = 1;
+
+            // Zero values keep the User Gameplay Data defaults
+            UserGameplayDataClientSettings ClientSettings = {};
+
+            // If set, the per-endpoint metrics of every interval are written to this CSV file
+            std::string CsvFile;
+
+            FuncLogCallback LogCallback = nullptr;
+        };
+
+        /**
+         * @brief Drives simulated game sessions through the GameKit features against the stand-in server.
+         *
+         * @details Every interval, prints throughput, failures and latency of the game calls, requests, retries and drops
+         * of every endpoint, the operations waiting in retry queues, and the resident memory of the process. The request
+         * metrics are reset by every report, so they cover only the last interval.
+         */
+        class LoadTestDriver
+        {
+        private:
+            struct Session
+            {
+                std::string IdToken;
+                std::unique_ptr<Authentication::GameKitSessionManager> SessionManager;
+                std::unique_ptr<UserGameplayData::UserGameplayData> UserGameplayDataFeature;
+                std::unique_ptr<GameSaving::GameSaving> GameSavingFeature;
+                std::mt19937_64 RandomEngine;
+                std::chrono::steady_clock::time_point NextCallTime;
+                unsigned long long CallCount = 0;
+                bool HasSavedSlot = false;
+            };
+
+            LoadTestSettings m_settings;
+            std::shared_ptr<StandInServer> m_server;
+            std::shared_ptr<StandInHttpClientFactory> m_factory;
+            std::vector<std::unique_ptr<Session>> m_sessions;
+            std::vector<uint8_t> m_slotData;
+
+            std::atomic<long long> m_callsInFlight{ 0 };
+            std::atomic<long long> m_maxScheduleLagMicroseconds{ 0 };
+
+            void createSessions();
+            void runThread(unsigned int threadIndex, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime);
+            void makeCall(Session& session, std::vector<uint8_t>& loadBuffer);
+            unsigned int addUserGameplayData(Session& session);
+            unsigned int updateUserGameplayDataBundleItem(Session& session);
+            unsigned int saveSlot(Session& session);
+            unsigned int loadSlot(Session& session, std::vector<uint8_t>& loadBuffer);
+            void scheduleNextCall(Session& session);
+            void report(std::ostream& output, std::ostream* csv, std::chrono::steady_clock::time_point startTime, StandInStatistics& previousStatistics);
+
+        public:
+            LoadTestDriver(const LoadTestSettings& settings, std::shared_ptr<StandInServer> server, std::shared_ptr<StandInHttpClientFactory> factory);
+            ~LoadTestDriver();
+
+            LoadTestDriver(const LoadTestDriver&) = delete;
+            LoadTestDriver& operator=(const LoadTestDriver&) = delete;
+
+            /**
+             * @brief Create the sessions, run them for the configured duration and report every interval.
+             *
+             * @param output Receives the report.
+             * @returns False if the CSV file couldn't be opened.
+            */
+            bool Run(std::ostream& output);
+
+            // Resident memory of the process in bytes, 0 if it can't be read on this platform
+            static unsigned long long GetResidentMemoryBytes();
+        };
+    }
+}
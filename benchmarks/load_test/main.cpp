@@ -0,0 +1,205 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+
+// AWS SDK
+#include <aws/core/http/HttpClientFactory.h>
+
+// GameKit
+#include <aws/gamekit/core/awsclients/api_initializer.h>
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
+#include <aws/gamekit/core/logging.h>
+
+// Load Test
+#include "load_test_driver.h"
+#include "stand_in_server.h"
+
+using namespace GameKit::LoadTest;
+using namespace GameKit::Logger;
+
+namespace
+{
+    void printLog(unsigned int level, const char* message, int size)
+    {
+        static std::mutex logMutex;
+        std::lock_guard<std::mutex> lock(logMutex);
+        std::cerr << message << std::endl;
+    }
+
+    bool parseUnsigned(const std::string& value, unsigned long long& returnedValue)
+    {
+        char* end = nullptr;
+        returnedValue = std::strtoull(value.c_str(), &end, 10);
+        return !value.empty() && value[0] != '-' && *end == '\0';
+    }
+
+    bool parseUnsigned(const std::string& value, unsigned int& returnedValue)
+    {
+        unsigned long long parsed = 0;
+        if (!parseUnsigned(value, parsed) || parsed > UINT_MAX)
+        {
+            return false;
+        }
+
+        returnedValue = static_cast<unsigned int>(parsed);
+        return true;
+    }
+
+    bool parseSeconds(const std::string& value, std::chrono::seconds& returnedValue)
+    {
+        unsigned int seconds = 0;
+        if (!parseUnsigned(value, seconds))
+        {
+            return false;
+        }
+
+        returnedValue = std::chrono::seconds(seconds);
+        return true;
+    }
+
+    bool parseDouble(const std::string& value, double& returnedValue)
+    {
+        char* end = nullptr;
+        returnedValue = std::strtod(value.c_str(), &end);
+        return !value.empty() && *end == '\0' && returnedValue >= 0.0;
+    }
+
+    bool parseArgument(const std::string& name, const std::string& value, LoadTestSettings& settings, std::string& profileName)
+    {
+        UserGameplayDataClientSettings& clientSettings = settings.ClientSettings;
+
+        if (name == "--profile") { profileName = value; return true; }
+        if (name == "--sessions") return parseUnsigned(value, settings.SessionCount);
+        if (name == "--threads") return parseUnsigned(value, settings.ThreadCount);
+        if (name == "--duration") return parseSeconds(value, settings.Duration);
+        if (name == "--interval") return parseSeconds(value, settings.ReportInterval);
+        if (name == "--rate") return parseDouble(value, settings.CallsPerSessionPerSecond);
+        if (name == "--game-saving-fraction") return parseDouble(value, settings.GameSavingFraction);
+        if (name == "--slot-size") return parseUnsigned(value, settings.SlotSize);
+        if (name == "--seed")
+        {
+            unsigned long long seed = 0;
+            if (!parseUnsigned(value, seed))
+            {
+                return false;
+            }
+
+            settings.Seed = seed;
+            return true;
+        }
+        if (name == "--csv") { settings.CsvFile = value; return !value.empty(); }
+        if (name == "--client-timeout") return parseUnsigned(value, clientSettings.ClientTimeoutSeconds);
+        if (name == "--retry-interval") return parseUnsigned(value, clientSettings.RetryIntervalSeconds);
+        if (name == "--max-retry-queue-size") return parseUnsigned(value, clientSettings.MaxRetryQueueSize);
+        if (name == "--max-retries") return parseUnsigned(value, clientSettings.MaxRetries);
+        if (name == "--retry-strategy") return parseUnsigned(value, clientSettings.RetryStrategy) && clientSettings.RetryStrategy <= 1;
+        if (name == "--max-exponential-retry-threshold") return parseUnsigned(value, clientSettings.MaxExponentialRetryThreshold);
+
+        return false;
+    }
+
+    void printUsage()
+    {
+        std::cout << "Usage: gamekit-load-test [--option=value ...]" << std::endl
+            << "  --profile=<name>                      Fault profile of the stand-in server, default healthy" << std::endl
+            << "  --help                                Print this message and exit" << std::endl
+            << "  --list-profiles                       Print the fault profiles and exit" << std::endl
+            << "  --sessions=<count>                    Simulated game sessions, default 1000" << std::endl
+            << "  --threads=<count>                     Threads making the sessions' calls, default 128" << std::endl
+            << "  --duration=<seconds>                  Length of the run, default 60" << std::endl
+            << "  --interval=<seconds>                  Time between reports, default 5" << std::endl
+            << "  --rate=<calls>                        Average calls per session per second, default 0.5" << std::endl
+            << "  --game-saving-fraction=<fraction>     Fraction of calls that save or load a slot, default 0.1" << std::endl
+            << "  --slot-size=<bytes>                   Size of the saved slots, default 16384" << std::endl
+            << "  --seed=<seed>                         Seed of the calls and of the stand-in faults, default 1" << std::endl
+            << "  --csv=<file>                          Write the per-endpoint metrics of every interval to a CSV file" << std::endl
+            << "  --log                                 Print GameKit warnings and errors to stderr" << std::endl
+            << "User Gameplay Data client settings, 0 keeps the default:" << std::endl
+            << "  --client-timeout=<seconds>" << std::endl
+            << "  --retry-interval=<seconds>" << std::endl
+            << "  --max-retry-queue-size=<operations>" << std::endl
+            << "  --max-retries=<attempts>" << std::endl
+            << "  --retry-strategy=<0 exponential backoff, 1 constant interval>" << std::endl
+            << "  --max-exponential-retry-threshold=<attempts>" << std::endl;
+    }
+}
+
+// Load test entrypoint. Simulates game sessions calling User Gameplay Data and Game Saving against an
+// in-process stand-in of the GameKit backend, for example:
+// gamekit-load-test --profile=outage --sessions=2000 --duration=120 --max-retry-queue-size=64 --csv=outage.csv
+int main(int argc, char** argv)
+{
+    // Disable EC2 metadata requests, every request goes to the stand-in
+    putenv(const_cast<char*>("AWS_EC2_METADATA_DISABLED=true"));
+
+    LoadTestSettings settings;
+    std::string profileName = "healthy";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const size_t separator = argument.find('=');
+        const std::string name = argument.substr(0, separator);
+        const std::string value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+
+        if (name == "--help")
+        {
+            printUsage();
+            return 0;
+        }
+
+        if (name == "--list-profiles")
+        {
+            for (const FaultProfile& profile : FaultProfile::GetNamedProfiles())
+            {
+                std::cout << profile.Name << ": " << profile.Description << std::endl;
+            }
+            return 0;
+        }
+
+        if (name == "--log")
+        {
+            settings.LogCallback = printLog;
+            Logging::SetMinimumLevel(Level::Warning);
+            continue;
+        }
+
+        if (!parseArgument(name, value, settings, profileName))
+        {
+            std::cerr << "Invalid argument " << argument << std::endl;
+            printUsage();
+            return 1;
+        }
+    }
+
+    FaultProfile profile;
+    if (!FaultProfile::TryGetNamedProfile(profileName, profile))
+    {
+        std::cerr << "Unknown profile " << profileName << ", use --list-profiles to list them" << std::endl;
+        return 1;
+    }
+
+    GameKit::AwsApiInitializer::Initialize();
+
+    // Every client created from now on, by the AWS SDK or GameKit, sends its requests to the stand-in
+    const std::shared_ptr<StandInServer> server = std::make_shared<StandInServer>(profile, settings.Seed);
+    const std::shared_ptr<StandInHttpClientFactory> factory = std::make_shared<StandInHttpClientFactory>(server);
+    Aws::Http::SetHttpClientFactory(factory);
+    Aws::Http::InitHttp();
+    GameKit::SharedHttpClients::Clear();
+
+    bool success = false;
+    {
+        LoadTestDriver driver(settings, server, factory);
+        success = driver.Run(std::cout);
+    }
+
+    GameKit::SharedHttpClients::Clear();
+    GameKit::AwsApiInitializer::Shutdown();
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,537 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <thread>
+
+// AWS SDK
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+
+// GameKit
+#include <aws/gamekit/core/internal/platform_string.h>
+
+// Load Test
+#include "stand_in_server.h"
+
+using namespace GameKit::LoadTest;
+
+namespace
+{
+    static const char* const ALLOCATION_TAG = "GameKitLoadTest";
+    static const char* const AUTHORIZATION_HEADER = "authorization";
+    static const char* const BEARER_PREFIX = "Bearer ";
+    static const char* const S3_SHA_256_METADATA_HEADER = "x-amz-meta-hash";
+    static const char* const S3_SLOT_METADATA_HEADER = "x-amz-meta-slot_metadata";
+    static const char* const S3_EPOCH_METADATA_HEADER = "x-amz-meta-epoch";
+
+    // Clients created without a request timeout wait as long as the server takes
+    static const std::chrono::milliseconds NO_TIMEOUT = std::chrono::hours(24);
+
+    // Request created by the stand-in factory, counted while it is alive
+    class CountedHttpRequest : public Aws::Http::Standard::StandardHttpRequest
+    {
+    private:
+        std::shared_ptr<std::atomic<long long>> m_liveRequestCount;
+
+    public:
+        CountedHttpRequest(const Aws::Http::URI& uri, Aws::Http::HttpMethod method, std::shared_ptr<std::atomic<long long>> liveRequestCount) :
+            StandardHttpRequest(uri, method), m_liveRequestCount(liveRequestCount)
+        {
+            m_liveRequestCount->fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ~CountedHttpRequest() override
+        {
+            m_liveRequestCount->fetch_sub(1, std::memory_order_relaxed);
+        }
+    };
+
+    // FNV-1a, stable across platforms so a seed gives the same faults everywhere
+    uint64_t hashSessionKey(const std::string& sessionKey)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char c : sessionKey)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    std::vector<std::string> splitPath(const std::string& path)
+    {
+        std::vector<std::string> segments;
+        size_t start = 0;
+        while (start < path.size())
+        {
+            size_t end = path.find('/', start);
+            if (end == std::string::npos)
+            {
+                end = path.size();
+            }
+
+            if (end > start)
+            {
+                segments.push_back(path.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+
+        return segments;
+    }
+
+    std::string readBody(const Aws::Http::HttpRequest& request)
+    {
+        const std::shared_ptr<Aws::IOStream>& body = request.GetContentBody();
+        if (body == nullptr)
+        {
+            return std::string();
+        }
+
+        body->clear();
+        body->seekg(0, std::ios::beg);
+        std::string contents((std::istreambuf_iterator<char>(*body)), std::istreambuf_iterator<char>());
+        body->clear();
+        body->seekg(0, std::ios::beg);
+
+        return contents;
+    }
+
+    std::string getHeader(const Aws::Http::HttpRequest& request, const char* headerName)
+    {
+        return request.HasHeader(headerName) ? ToStdString(request.GetHeaderValue(headerName)) : std::string();
+    }
+}
+
+#pragma region FaultProfile
+const std::vector<FaultProfile>& FaultProfile::GetNamedProfiles()
+{
+    static const std::vector<FaultProfile> profiles = []()
+    {
+        std::vector<FaultProfile> namedProfiles;
+
+        FaultProfile healthy;
+        healthy.Name = "healthy";
+        healthy.Description = "40 ms median latency, 1% of requests take 400 ms longer, no errors";
+        healthy.TailProbability = 0.01;
+        healthy.TailLatency = std::chrono::milliseconds(400);
+        namedProfiles.push_back(healthy);
+
+        FaultProfile lossy = healthy;
+        lossy.Name = "lossy";
+        lossy.Description = "Mobile network: 80 ms median latency with a wide spread, 5% of requests lost, occasional short 503 bursts";
+        lossy.MedianLatency = std::chrono::milliseconds(80);
+        lossy.LatencySpread = 0.6;
+        lossy.TailProbability = 0.05;
+        lossy.TailLatency = std::chrono::milliseconds(1500);
+        lossy.ConnectionFailureProbability = 0.05;
+        lossy.ServerErrorProbability = 0.005;
+        lossy.ServerErrorBurstLength = 3;
+        namedProfiles.push_back(lossy);
+
+        FaultProfile degraded = healthy;
+        degraded.Name = "degraded";
+        degraded.Description = "Overloaded backend: 250 ms median latency, 10% of requests slower than the default 3 s client timeout, 2% start 503 bursts";
+        degraded.MedianLatency = std::chrono::milliseconds(250);
+        degraded.LatencySpread = 0.8;
+        degraded.TailProbability = 0.1;
+        degraded.TailLatency = std::chrono::milliseconds(4000);
+        degraded.ServerErrorProbability = 0.02;
+        degraded.ServerErrorBurstLength = 5;
+        namedProfiles.push_back(degraded);
+
+        FaultProfile throttled = healthy;
+        throttled.Name = "throttled";
+        throttled.Description = "API Gateway limited to 200 requests per second with bursts of 50, excess requests get 429 with Retry-After";
+        throttled.ThrottleRequestsPerSecond = 200.0;
+        throttled.ThrottleBurst = 50.0;
+        namedProfiles.push_back(throttled);
+
+        FaultProfile outage = healthy;
+        outage.Name = "outage";
+        outage.Description = "Healthy, except that no request connects from 20 s to 50 s into the run";
+        outage.OutageStart = std::chrono::seconds(20);
+        outage.OutageDuration = std::chrono::seconds(30);
+        namedProfiles.push_back(outage);
+
+        return namedProfiles;
+    }();
+
+    return profiles;
+}
+
+bool FaultProfile::TryGetNamedProfile(const std::string& name, FaultProfile& returnedProfile)
+{
+    const std::vector<FaultProfile>& profiles = GetNamedProfiles();
+    const auto profile = std::find_if(profiles.begin(), profiles.end(), [&](const FaultProfile& p) { return p.Name == name; });
+    if (profile == profiles.end())
+    {
+        return false;
+    }
+
+    returnedProfile = *profile;
+    return true;
+}
+#pragma endregion
+
+#pragma region StandInServer
+StandInServer::StandInServer(const FaultProfile& profile, uint64_t seed) :
+    m_profile(profile),
+    m_seed(seed),
+    m_startTime(std::chrono::steady_clock::now()),
+    m_throttleTokens(profile.ThrottleBurst),
+    m_throttleRefillTime(m_startTime)
+{}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::Serve(const std::shared_ptr<Aws::Http::HttpRequest>& request, std::chrono::milliseconds timeout)
+{
+    m_requestCount.fetch_add(1, std::memory_order_relaxed);
+
+    const std::string host = ToStdString(request->GetUri().GetAuthority());
+    const std::string path = ToStdString(request->GetUri().GetPath());
+    const bool isApiGateway = host == API_GATEWAY_HOST;
+
+    // API Gateway requests carry the session's id token, presigned S3 urls start with it
+    std::string sessionKey;
+    std::string slotName;
+    if (isApiGateway)
+    {
+        sessionKey = getHeader(*request, AUTHORIZATION_HEADER);
+        if (sessionKey.compare(0, strlen(BEARER_PREFIX), BEARER_PREFIX) == 0)
+        {
+            sessionKey = sessionKey.substr(strlen(BEARER_PREFIX));
+        }
+    }
+    else if (host == S3_HOST)
+    {
+        const std::vector<std::string> segments = splitPath(path);
+        if (segments.size() == 2)
+        {
+            sessionKey = segments[0];
+            slotName = segments[1];
+        }
+    }
+
+    if (sessionKey.empty())
+    {
+        m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+        return createResponse(request, isApiGateway ? Aws::Http::HttpResponseCode::UNAUTHORIZED : Aws::Http::HttpResponseCode::NOT_FOUND, "{\"message\":\"Unauthorized\"}");
+    }
+
+    Session& session = getSession(sessionKey);
+    Fault fault;
+    {
+        std::lock_guard<std::mutex> lock(session.Mutex);
+        fault = drawFault(session);
+    }
+
+    if (fault.Latency >= timeout)
+    {
+        std::this_thread::sleep_for(timeout);
+        m_timeoutCount.fetch_add(1, std::memory_order_relaxed);
+        return createNotMadeResponse(request, Aws::Client::CoreErrors::REQUEST_TIMEOUT, "Request timed out");
+    }
+
+    std::this_thread::sleep_for(fault.Latency);
+
+    if (fault.ConnectionFailure || isInOutage())
+    {
+        m_connectionFailureCount.fetch_add(1, std::memory_order_relaxed);
+        return createNotMadeResponse(request, Aws::Client::CoreErrors::NETWORK_CONNECTION, "Connection reset by peer");
+    }
+
+    if (fault.ServerError)
+    {
+        m_serverErrorCount.fetch_add(1, std::memory_order_relaxed);
+        return createResponse(request, Aws::Http::HttpResponseCode::SERVICE_UNAVAILABLE, "{\"message\":\"Service Unavailable\"}");
+    }
+
+    if (isApiGateway && !tryTakeThrottleToken())
+    {
+        m_throttledCount.fetch_add(1, std::memory_order_relaxed);
+        const std::shared_ptr<Aws::Http::HttpResponse> response = createResponse(request, Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS, "{\"message\":\"Too Many Requests\"}");
+        response->AddHeader("retry-after", "1");
+        return response;
+    }
+
+    if (isApiGateway && path.compare(0, USER_GAMEPLAY_DATA_PATH.size(), USER_GAMEPLAY_DATA_PATH) == 0)
+    {
+        return serveUserGameplayData(request);
+    }
+
+    if (isApiGateway && path.compare(0, GAME_SAVING_PATH.size(), GAME_SAVING_PATH) == 0)
+    {
+        return serveGameSaving(request, path.substr(GAME_SAVING_PATH.size()), sessionKey, session);
+    }
+
+    if (!isApiGateway)
+    {
+        return serveS3(request, slotName, session);
+    }
+
+    m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+    return createResponse(request, Aws::Http::HttpResponseCode::NOT_FOUND, "{\"message\":\"Not Found\"}");
+}
+
+StandInStatistics StandInServer::GetStatistics() const
+{
+    StandInStatistics statistics = {};
+    statistics.RequestCount = m_requestCount.load(std::memory_order_relaxed);
+    statistics.ConnectionFailureCount = m_connectionFailureCount.load(std::memory_order_relaxed);
+    statistics.TimeoutCount = m_timeoutCount.load(std::memory_order_relaxed);
+    statistics.ServerErrorCount = m_serverErrorCount.load(std::memory_order_relaxed);
+    statistics.ThrottledCount = m_throttledCount.load(std::memory_order_relaxed);
+    statistics.NotFoundCount = m_notFoundCount.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+StandInServer::Session& StandInServer::getSession(const std::string& sessionKey)
+{
+    std::lock_guard<std::mutex> lock(m_sessionsMutex);
+
+    std::unique_ptr<Session>& session = m_sessions[sessionKey];
+    if (session == nullptr)
+    {
+        const uint64_t sessionHash = hashSessionKey(sessionKey);
+        std::seed_seq seed({ static_cast<uint32_t>(m_seed), static_cast<uint32_t>(m_seed >> 32), static_cast<uint32_t>(sessionHash), static_cast<uint32_t>(sessionHash >> 32) });
+
+        session.reset(new Session());
+        session->RandomEngine.seed(seed);
+    }
+
+    return *session;
+}
+
+StandInServer::Fault StandInServer::drawFault(Session& session)
+{
+    // Every draw is made for every request, so a session's faults only depend on how many requests it made
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::lognormal_distribution<double> latency(std::log((std::max)(static_cast<double>(m_profile.MedianLatency.count()), 1.0)), m_profile.LatencySpread);
+
+    double latencyMicroseconds = latency(session.RandomEngine);
+    if (unit(session.RandomEngine) < m_profile.TailProbability)
+    {
+        latencyMicroseconds += static_cast<double>(m_profile.TailLatency.count());
+    }
+
+    Fault fault;
+    fault.Latency = std::chrono::microseconds(static_cast<long long>(latencyMicroseconds));
+    fault.ConnectionFailure = unit(session.RandomEngine) < m_profile.ConnectionFailureProbability;
+
+    const bool startsServerErrors = unit(session.RandomEngine) < m_profile.ServerErrorProbability;
+    if (session.ServerErrorsRemaining > 0)
+    {
+        --session.ServerErrorsRemaining;
+        fault.ServerError = true;
+    }
+    else if (startsServerErrors)
+    {
+        session.ServerErrorsRemaining = m_profile.ServerErrorBurstLength > 0 ? m_profile.ServerErrorBurstLength - 1 : 0;
+        fault.ServerError = true;
+    }
+    else
+    {
+        fault.ServerError = false;
+    }
+
+    return fault;
+}
+
+bool StandInServer::isInOutage() const
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+    return m_profile.OutageDuration.count() > 0 && elapsed >= m_profile.OutageStart && elapsed < m_profile.OutageStart + m_profile.OutageDuration;
+}
+
+bool StandInServer::tryTakeThrottleToken()
+{
+    if (m_profile.ThrottleRequestsPerSecond <= 0.0)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_throttleMutex);
+
+    // Token bucket, refilled at the throttle rate up to the burst size
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsedSeconds = std::chrono::duration<double>(now - m_throttleRefillTime).count();
+    m_throttleRefillTime = now;
+    m_throttleTokens = (std::min)(m_profile.ThrottleBurst, m_throttleTokens + elapsedSeconds * m_profile.ThrottleRequestsPerSecond);
+
+    if (m_throttleTokens < 1.0)
+    {
+        return false;
+    }
+
+    m_throttleTokens -= 1.0;
+    return true;
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::serveUserGameplayData(const std::shared_ptr<Aws::Http::HttpRequest>& request)
+{
+    // Writes are accepted without being stored, the load test never reads bundles back
+    switch (request->GetMethod())
+    {
+    case Aws::Http::HttpMethod::HTTP_POST:
+        return createResponse(request, Aws::Http::HttpResponseCode::CREATED, "{\"data\":{\"unprocessed_items\":[]}}");
+    case Aws::Http::HttpMethod::HTTP_PUT:
+    case Aws::Http::HttpMethod::HTTP_DELETE:
+        return createResponse(request, Aws::Http::HttpResponseCode::NO_CONTENT, "");
+    case Aws::Http::HttpMethod::HTTP_GET:
+        return createResponse(request, Aws::Http::HttpResponseCode::OK, "{\"data\":{}}");
+    default:
+        m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+        return createResponse(request, Aws::Http::HttpResponseCode::NOT_FOUND, "{\"message\":\"Not Found\"}");
+    }
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::serveGameSaving(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& path, const std::string& sessionKey, Session& session)
+{
+    const std::vector<std::string> segments = splitPath(path);
+    if (request->GetMethod() != Aws::Http::HttpMethod::HTTP_GET || segments.empty() || segments.size() > 2)
+    {
+        m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+        return createResponse(request, Aws::Http::HttpResponseCode::NOT_FOUND, "{\"message\":\"Not Found\"}");
+    }
+
+    const std::string& slotName = segments[0];
+
+    // GET <base>/<slot>: sync status of the slot, an empty object if it was never uploaded
+    if (segments.size() == 1)
+    {
+        std::lock_guard<std::mutex> lock(session.Mutex);
+
+        const auto slot = session.Slots.find(slotName);
+        if (slot == session.Slots.end())
+        {
+            return createResponse(request, Aws::Http::HttpResponseCode::OK, "{\"data\":{}}");
+        }
+
+        return createResponse(request, Aws::Http::HttpResponseCode::OK, "{\"data\":{\"slot_name\":\"" + slotName +
+            "\",\"metadata\":\"" + slot->second.Metadata +
+            "\",\"size\":\"" + std::to_string(slot->second.Data.size()) +
+            "\",\"last_modified\":" + std::to_string(slot->second.LastModified) + "}}");
+    }
+
+    // GET <base>/<slot>/upload_url and <base>/<slot>/download_url: presigned url of the slot
+    if (segments[1] == "upload_url" || segments[1] == "download_url")
+    {
+        return createResponse(request, Aws::Http::HttpResponseCode::OK, "{\"data\":{\"url\":\"https://" + S3_HOST + "/" + sessionKey + "/" + slotName + "\"}}");
+    }
+
+    m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+    return createResponse(request, Aws::Http::HttpResponseCode::NOT_FOUND, "{\"message\":\"Not Found\"}");
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::serveS3(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& slotName, Session& session)
+{
+    if (request->GetMethod() == Aws::Http::HttpMethod::HTTP_PUT)
+    {
+        StoredSlot slot;
+        slot.Data = readBody(*request);
+        slot.Hash = getHeader(*request, S3_SHA_256_METADATA_HEADER);
+        slot.Metadata = getHeader(*request, S3_SLOT_METADATA_HEADER);
+        const std::string epoch = getHeader(*request, S3_EPOCH_METADATA_HEADER);
+        slot.LastModified = epoch.empty() ? 0 : std::strtoll(epoch.c_str(), nullptr, 10);
+
+        std::lock_guard<std::mutex> lock(session.Mutex);
+        session.Slots[slotName] = std::move(slot);
+
+        return createResponse(request, Aws::Http::HttpResponseCode::OK, "");
+    }
+
+    if (request->GetMethod() == Aws::Http::HttpMethod::HTTP_GET)
+    {
+        std::unique_lock<std::mutex> lock(session.Mutex);
+
+        const auto slot = session.Slots.find(slotName);
+        if (slot != session.Slots.end())
+        {
+            const std::string hash = slot->second.Hash;
+            const std::string data = slot->second.Data;
+            lock.unlock();
+
+            const std::shared_ptr<Aws::Http::HttpResponse> response = createResponse(request, Aws::Http::HttpResponseCode::OK, data);
+            response->AddHeader(S3_SHA_256_METADATA_HEADER, ToAwsString(hash));
+            return response;
+        }
+    }
+
+    m_notFoundCount.fetch_add(1, std::memory_order_relaxed);
+    return createResponse(request, Aws::Http::HttpResponseCode::NOT_FOUND, "<Error><Code>NoSuchKey</Code></Error>");
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::createResponse(const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Http::HttpResponseCode responseCode, const std::string& body)
+{
+    const std::shared_ptr<Aws::Http::HttpResponse> response = Aws::MakeShared<Aws::Http::Standard::StandardHttpResponse>(ALLOCATION_TAG, request);
+    response->SetResponseCode(responseCode);
+
+    if (!body.empty())
+    {
+        response->GetResponseBody().write(body.data(), static_cast<std::streamsize>(body.size()));
+        response->AddHeader("content-length", ToAwsString(std::to_string(body.size())));
+        if (body.front() == '{')
+        {
+            response->AddHeader("content-type", "application/json");
+        }
+    }
+
+    return response;
+}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInServer::createNotMadeResponse(const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Client::CoreErrors errorType, const std::string& message)
+{
+    const std::shared_ptr<Aws::Http::HttpResponse> response = Aws::MakeShared<Aws::Http::Standard::StandardHttpResponse>(ALLOCATION_TAG, request);
+    response->SetResponseCode(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
+    response->SetClientErrorType(errorType);
+    response->SetClientErrorMessage(ToAwsString(message));
+
+    return response;
+}
+#pragma endregion
+
+#pragma region StandInHttpClient
+StandInHttpClient::StandInHttpClient(std::shared_ptr<StandInServer> server, std::chrono::milliseconds timeout) :
+    m_server(server), m_timeout(timeout)
+{}
+
+std::shared_ptr<Aws::Http::HttpResponse> StandInHttpClient::MakeRequest(const std::shared_ptr<Aws::Http::HttpRequest>& request,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    return m_server->Serve(request, m_timeout);
+}
+#pragma endregion
+
+#pragma region StandInHttpClientFactory
+StandInHttpClientFactory::StandInHttpClientFactory(std::shared_ptr<StandInServer> server) :
+    m_server(server), m_liveRequestCount(std::make_shared<std::atomic<long long>>(0))
+{}
+
+std::shared_ptr<Aws::Http::HttpClient> StandInHttpClientFactory::CreateHttpClient(const Aws::Client::ClientConfiguration& clientConfiguration) const
+{
+    const std::chrono::milliseconds timeout = clientConfiguration.requestTimeoutMs > 0 ? std::chrono::milliseconds(clientConfiguration.requestTimeoutMs) : NO_TIMEOUT;
+    return Aws::MakeShared<StandInHttpClient>(ALLOCATION_TAG, m_server, timeout);
+}
+
+std::shared_ptr<Aws::Http::HttpRequest> StandInHttpClientFactory::CreateHttpRequest(const Aws::String& uri, Aws::Http::HttpMethod method, const Aws::IOStreamFactory& streamFactory) const
+{
+    return CreateHttpRequest(Aws::Http::URI(uri), method, streamFactory);
+}
+
+std::shared_ptr<Aws::Http::HttpRequest> StandInHttpClientFactory::CreateHttpRequest(const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::IOStreamFactory& streamFactory) const
+{
+    const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::MakeShared<CountedHttpRequest>(ALLOCATION_TAG, uri, method, m_liveRequestCount);
+    request->SetResponseStreamFactory(streamFactory);
+
+    return request;
+}
+#pragma endregion
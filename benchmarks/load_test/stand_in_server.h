@@ -0,0 +1,198 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// AWS SDK
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+
+namespace GameKit
+{
+    namespace LoadTest
+    {
+        // Host and base paths served by the stand-in, used in the client configuration of every load test session
+        static const std::string API_GATEWAY_HOST = "loadtest.execute-api.local";
+        static const std::string S3_HOST = "loadtest-slots.s3.local";
+        static const std::string USER_GAMEPLAY_DATA_PATH = "/usergamedata";
+        static const std::string GAME_SAVING_PATH = "/gamesaving";
+
+        // Server behavior applied to every request the stand-in receives
+        struct FaultProfile
+        {
+            std::string Name;
+            std::string Description;
+
+            // Latency is drawn from a log-normal distribution around the median, a fraction of requests get the tail latency added
+            std::chrono::microseconds MedianLatency{ 40000 };
+            double LatencySpread = 0.3;
+            double TailProbability = 0.0;
+            std::chrono::microseconds TailLatency{ 0 };
+
+            // Probability that a request never reaches the server, as with packet loss or a reset connection
+            double ConnectionFailureProbability = 0.0;
+
+            // Probability that a request starts a run of consecutive 503 responses for its session
+            double ServerErrorProbability = 0.0;
+            unsigned int ServerErrorBurstLength = 1;
+
+            // Requests per second accepted by the API Gateway stand-in before it answers 429 with Retry-After, 0 for no limit
+            double ThrottleRequestsPerSecond = 0.0;
+            double ThrottleBurst = 0.0;
+
+            // Every request fails to connect during the outage, measured from when the stand-in was created
+            std::chrono::seconds OutageStart{ 0 };
+            std::chrono::seconds OutageDuration{ 0 };
+
+            static const std::vector<FaultProfile>& GetNamedProfiles();
+            static bool TryGetNamedProfile(const std::string& name, FaultProfile& returnedProfile);
+        };
+
+        // Server side counters, cumulative since the stand-in was created
+        struct StandInStatistics
+        {
+            unsigned long long RequestCount;
+            unsigned long long ConnectionFailureCount;
+            unsigned long long TimeoutCount;
+            unsigned long long ServerErrorCount;
+            unsigned long long ThrottledCount;
+            unsigned long long NotFoundCount;
+        };
+
+        /**
+         * @brief In-process stand-in for the GameKit API Gateway endpoints and the presigned S3 urls of Game Saving.
+         *
+         * @details Requests are routed on host and path like the deployed backend: User Gameplay Data writes are accepted,
+         * Game Saving slot status, upload and download urls are served, and uploaded slots are stored per session and returned
+         * with their SHA-256 metadata. Faults are drawn from a random engine per session, seeded from the session's token,
+         * so a given seed replays the same faults for each session's sequence of requests whatever the other sessions do.
+         * Outages and throttling depend on wall clock time.
+         */
+        class StandInServer
+        {
+        private:
+            struct StoredSlot
+            {
+                std::string Data;
+                std::string Hash;
+                std::string Metadata;
+                long long LastModified;
+            };
+
+            struct Session
+            {
+                std::mutex Mutex;
+                std::mt19937_64 RandomEngine;
+                unsigned int ServerErrorsRemaining = 0;
+                std::unordered_map<std::string, StoredSlot> Slots;
+            };
+
+            // Outcome drawn for a request before it is served
+            struct Fault
+            {
+                std::chrono::microseconds Latency;
+                bool ConnectionFailure;
+                bool ServerError;
+            };
+
+            FaultProfile m_profile;
+            uint64_t m_seed;
+            std::chrono::steady_clock::time_point m_startTime;
+
+            std::mutex m_sessionsMutex;
+            std::unordered_map<std::string, std::unique_ptr<Session>> m_sessions;
+
+            std::mutex m_throttleMutex;
+            double m_throttleTokens;
+            std::chrono::steady_clock::time_point m_throttleRefillTime;
+
+            std::atomic<unsigned long long> m_requestCount{ 0 };
+            std::atomic<unsigned long long> m_connectionFailureCount{ 0 };
+            std::atomic<unsigned long long> m_timeoutCount{ 0 };
+            std::atomic<unsigned long long> m_serverErrorCount{ 0 };
+            std::atomic<unsigned long long> m_throttledCount{ 0 };
+            std::atomic<unsigned long long> m_notFoundCount{ 0 };
+
+            Session& getSession(const std::string& sessionKey);
+            Fault drawFault(Session& session);
+            bool isInOutage() const;
+            bool tryTakeThrottleToken();
+
+            std::shared_ptr<Aws::Http::HttpResponse> serveUserGameplayData(const std::shared_ptr<Aws::Http::HttpRequest>& request);
+            std::shared_ptr<Aws::Http::HttpResponse> serveGameSaving(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& path, const std::string& sessionKey, Session& session);
+            std::shared_ptr<Aws::Http::HttpResponse> serveS3(const std::shared_ptr<Aws::Http::HttpRequest>& request, const std::string& slotName, Session& session);
+            std::shared_ptr<Aws::Http::HttpResponse> createResponse(const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Http::HttpResponseCode responseCode, const std::string& body);
+            std::shared_ptr<Aws::Http::HttpResponse> createNotMadeResponse(const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Client::CoreErrors errorType, const std::string& message);
+
+        public:
+            StandInServer(const FaultProfile& profile, uint64_t seed);
+
+            StandInServer(const StandInServer&) = delete;
+            StandInServer& operator=(const StandInServer&) = delete;
+
+            /**
+             * @brief Serve a request, blocking the calling thread for the drawn latency like a synchronous HTTP client would.
+             *
+             * @param request The request.
+             * @param timeout The client's request timeout. Requests slower than this fail with REQUEST_NOT_MADE after the timeout.
+             * @returns The response.
+            */
+            std::shared_ptr<Aws::Http::HttpResponse> Serve(const std::shared_ptr<Aws::Http::HttpRequest>& request, std::chrono::milliseconds timeout);
+
+            StandInStatistics GetStatistics() const;
+
+            inline const FaultProfile& GetProfile() const { return m_profile; }
+        };
+
+        // HTTP client sending every request to the stand-in, with the request timeout of the configuration it was created for
+        class StandInHttpClient : public Aws::Http::HttpClient
+        {
+        private:
+            std::shared_ptr<StandInServer> m_server;
+            std::chrono::milliseconds m_timeout;
+
+        public:
+            StandInHttpClient(std::shared_ptr<StandInServer> server, std::chrono::milliseconds timeout);
+
+            std::shared_ptr<Aws::Http::HttpResponse> MakeRequest(const std::shared_ptr<Aws::Http::HttpRequest>& request,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+        };
+
+        /**
+         * @brief HTTP client factory routing every AWS SDK and GameKit client to the stand-in.
+         *
+         * @details Install it with Aws::Http::SetHttpClientFactory() before any GameKit feature is created. The factory also
+         * counts the requests it created that are still alive, which after the calls in flight are the operations held in retry queues.
+         */
+        class StandInHttpClientFactory : public Aws::Http::HttpClientFactory
+        {
+        private:
+            std::shared_ptr<StandInServer> m_server;
+            std::shared_ptr<std::atomic<long long>> m_liveRequestCount;
+
+        public:
+            explicit StandInHttpClientFactory(std::shared_ptr<StandInServer> server);
+
+            std::shared_ptr<Aws::Http::HttpClient> CreateHttpClient(const Aws::Client::ClientConfiguration& clientConfiguration) const override;
+            std::shared_ptr<Aws::Http::HttpRequest> CreateHttpRequest(const Aws::String& uri, Aws::Http::HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override;
+            std::shared_ptr<Aws::Http::HttpRequest> CreateHttpRequest(const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override;
+
+            inline long long GetLiveRequestCount() const { return m_liveRequestCount->load(std::memory_order_relaxed); }
+        };
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <cstdlib>
+
+// GameKit
+#include <aws/gamekit/core/awsclients/api_initializer.h>
+
+// Benchmarks
+#include "benchmark_common.h"
+
+// Main benchmark entrypoint. Accepts the Google Benchmark arguments, for example:
+// --benchmark_filter=BM_FilterQueue --benchmark_out=results.json --benchmark_out_format=json
+int main(int argc, char** argv)
+{
+    // Disable EC2 metadata requests, no benchmark calls AWS
+    putenv(const_cast<char*>("AWS_EC2_METADATA_DISABLED=true"));
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // Deserialized requests are created through the AWS SDK HTTP client factory
+    GameKit::AwsApiInitializer::Initialize();
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    GameKit::AwsApiInitializer::Shutdown();
+    benchmark::Shutdown();
+
+    return 0;
+}
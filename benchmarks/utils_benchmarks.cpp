@@ -0,0 +1,192 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <unordered_map>
+
+// GameKit
+#include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/core/utils/template_utils.h>
+#include <aws/gamekit/core/utils/validation_utils.h>
+
+// Benchmarks
+#include "benchmark_common.h"
+
+using namespace GameKit::Benchmarks;
+using namespace GameKit::Logger;
+
+namespace
+{
+    // CloudFormation template with a resource per repetition, each referencing the usual system and feature variables
+    std::string createTemplate(size_t resourceCount)
+    {
+        std::string source = "AWSTemplateFormatVersion: 2010-09-09\nDescription: {{AWSGAMEKIT::SYS::GAMENAME}} {{AWSGAMEKIT::SYS::ENV}}\nResources:\n";
+        for (size_t i = 0; i < resourceCount; ++i)
+        {
+            source += "  Function" + std::to_string(i) + ":\n"
+                "    Type: AWS::Lambda::Function\n"
+                "    Properties:\n"
+                "      FunctionName: gamekit_{{AWSGAMEKIT::SYS::ENV}}_{{AWSGAMEKIT::SYS::GAMENAME}}_function" + std::to_string(i) + "\n"
+                "      Timeout: {{AWSGAMEKIT::VARS::lambda_timeout}}\n"
+                "      Role: arn:aws:iam::{{AWSGAMEKIT::SYS::ACCOUNTID}}:role/{{resolve:ssm:role_name}}\n";
+        }
+
+        return source;
+    }
+
+    const std::unordered_map<std::string, std::string>& getTemplateValues()
+    {
+        static const std::unordered_map<std::string, std::string> templateValues =
+        {
+            { "AWSGAMEKIT::SYS::GAMENAME", "benchmarkgame" },
+            { "AWSGAMEKIT::SYS::ENV", "dev" },
+            { "AWSGAMEKIT::SYS::ACCOUNTID", "123456789012" },
+            { "AWSGAMEKIT::VARS::lambda_timeout", "30" }
+        };
+
+        return templateValues;
+    }
+}
+
+#pragma region Templates
+static void BM_ParsedTemplate_Parse(benchmark::State& state)
+{
+    const std::string source = createTemplate(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        GameKit::Utils::ParsedTemplate parsedTemplate(source);
+        benchmark::DoNotOptimize(parsedTemplate);
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_ParsedTemplate_Parse)->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_ParsedTemplate_Render(benchmark::State& state)
+{
+    const GameKit::Utils::ParsedTemplate parsedTemplate(createTemplate(static_cast<size_t>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parsedTemplate.Render(getTemplateValues()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * parsedTemplate.GetSource().size());
+}
+BENCHMARK(BM_ParsedTemplate_Render)->RangeMultiplier(8)->Range(1, 512);
+#pragma endregion
+
+#pragma region Logging
+static void BM_Log_Synchronous(benchmark::State& state)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Synchronous);
+    const std::string message = "UserGameplayDataHttpClient::MakeRequest with operation 0, async 1, bundle bundle1, item item1";
+
+    for (auto _ : state)
+    {
+        Logging::Log(NoOpLog, Level::Info, message);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_Synchronous)->ThreadRange(1, 8);
+
+static void BM_Log_Manual(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        Logging::SetDeliveryMode(DeliveryMode::Manual);
+    }
+    const std::string message = "UserGameplayDataHttpClient::MakeRequest with operation 0, async 1, bundle bundle1, item item1";
+
+    for (auto _ : state)
+    {
+        Logging::Log(NoOpLog, Level::Info, message);
+
+        // Drain periodically like a game loop would, so records are queued rather than dropped
+        if (state.thread_index() == 0 && state.iterations() % 256 == 0)
+        {
+            Logging::FlushLogs();
+        }
+    }
+
+    if (state.thread_index() == 0)
+    {
+        Logging::SetDeliveryMode(DeliveryMode::Synchronous);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_Manual)->ThreadRange(1, 8);
+
+// Messages below the minimum level are dropped before they are built
+static void BM_Log_BelowMinimumLevel(benchmark::State& state)
+{
+    Logging::SetMinimumLevel(Level::Warning);
+    const std::string bundle = "bundle1";
+
+    for (auto _ : state)
+    {
+        GAMEKIT_LOG(NoOpLog, Level::Verbose, "UserGameplayDataHttpClient::MakeRequest with bundle " + bundle);
+    }
+
+    Logging::SetMinimumLevel(Level::None);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_BelowMinimumLevel);
+#pragma endregion
+
+#pragma region Validation
+static void BM_IsValidPrimaryIdentifier(benchmark::State& state)
+{
+    const std::string identifier(static_cast<size_t>(state.range(0)), 'a');
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(identifier));
+    }
+
+    state.SetBytesProcessed(state.iterations() * identifier.size());
+}
+BENCHMARK(BM_IsValidPrimaryIdentifier)->RangeMultiplier(8)->Range(8, 512);
+
+static void BM_IsValidUrlParam(benchmark::State& state)
+{
+    const std::string urlParam = "player-123_save.slot~1";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GameKit::Utils::ValidationUtils::IsValidUrlParam(urlParam));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsValidUrlParam);
+
+static void BM_IsValidS3KeyParam(benchmark::State& state)
+{
+    const std::string s3KeyParam = "player-123_save(1)*.dat";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GameKit::Utils::ValidationUtils::IsValidS3KeyParam(s3KeyParam));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsValidS3KeyParam);
+
+// The regex the validators used before they were table driven, as a baseline
+static void BM_IsValidString_Regex(benchmark::State& state)
+{
+    const std::string identifier(static_cast<size_t>(state.range(0)), 'a');
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GameKit::Utils::ValidationUtils::IsValidString(identifier, std::regex(GameKit::Utils::PRIMARY_IDENTIFIER_REGEX)));
+    }
+
+    state.SetBytesProcessed(state.iterations() * identifier.size());
+}
+BENCHMARK(BM_IsValidString_Regex)->RangeMultiplier(8)->Range(8, 512);
+#pragma endregion
@@ -62,6 +62,71 @@ TEST_F(GameKitSessionManagerTestFixture, KeyExists_TestAddKey_Success)
     ASSERT_EQ("xyz", token);
 }
 
+TEST_F(GameKitSessionManagerTestFixture, TokenSnapshot_TestSetToken_SnapshotUnchanged)
+{
+    // arrange
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "abc");
+    auto snapshot = gamekitSessionManagerInstance->GetTokenSnapshot();
+
+    // act
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "xyz");
+    auto newSnapshot = gamekitSessionManagerInstance->GetTokenSnapshot();
+
+    // assert
+    ASSERT_EQ("abc", snapshot->Get(GameKit::TokenType::IdToken));
+    ASSERT_EQ("xyz", newSnapshot->Get(GameKit::TokenType::IdToken));
+    ASSERT_GT(newSnapshot->Version, snapshot->Version);
+}
+
+TEST_F(GameKitSessionManagerTestFixture, TokenVersion_TestSetAndDeleteToken_VersionIncremented)
+{
+    // arrange
+    const uint64_t initialVersion = gamekitSessionManagerInstance->GetTokenVersion();
+
+    // act
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::AccessToken, "abc");
+    const uint64_t versionAfterSet = gamekitSessionManagerInstance->GetTokenVersion();
+    gamekitSessionManagerInstance->DeleteToken(GameKit::TokenType::AccessToken);
+    const uint64_t versionAfterDelete = gamekitSessionManagerInstance->GetTokenVersion();
+
+    // assert
+    ASSERT_GT(versionAfterSet, initialVersion);
+    ASSERT_GT(versionAfterDelete, versionAfterSet);
+    ASSERT_TRUE(gamekitSessionManagerInstance->GetToken(GameKit::TokenType::AccessToken).empty());
+}
+
+TEST_F(GameKitSessionManagerTestFixture, ClientSettingsSnapshot_TestConfigLoaded_WellKnownSettingsResolved)
+{
+    // act
+    auto clientSettings = gamekitSessionManagerInstance->GetClientSettingsSnapshot();
+
+    // assert
+    ASSERT_EQ("Test", clientSettings->GetUserPoolClientId());
+    ASSERT_EQ("TestRegion", clientSettings->GetIdentityRegion());
+    ASSERT_EQ("TestUrl", clientSettings->GetBaseUrl(GameKit::FeatureType::Identity));
+    ASSERT_EQ("https://domain.tld/achievements", clientSettings->GetBaseUrl(GameKit::FeatureType::Achievements));
+    ASSERT_EQ("https://domain.tld/usergamedata", clientSettings->GetBaseUrl(GameKit::FeatureType::UserGameplayData));
+    ASSERT_EQ("https://domain.tld/game_saving", clientSettings->GetBaseUrl(GameKit::FeatureType::GameStateCloudSaving));
+    ASSERT_TRUE(clientSettings->GetAchievementsIconsBaseUrl().empty());
+    ASSERT_TRUE(clientSettings->AreSettingsLoaded(GameKit::FeatureType::Identity));
+}
+
+TEST_F(GameKitSessionManagerTestFixture, ClientSettingsSnapshot_TestReloadEmptyConfig_SnapshotUnchanged)
+{
+    // arrange
+    auto clientSettings = gamekitSessionManagerInstance->GetClientSettingsSnapshot();
+
+    // act
+    gamekitSessionManagerInstance->ReloadConfigFile("");
+    auto reloadedSettings = gamekitSessionManagerInstance->GetClientSettingsSnapshot();
+
+    // assert
+    ASSERT_EQ("TestUrl", clientSettings->GetBaseUrl(GameKit::FeatureType::Identity));
+    ASSERT_TRUE(reloadedSettings->GetSettings().empty());
+    ASSERT_TRUE(reloadedSettings->GetBaseUrl(GameKit::FeatureType::Identity).empty());
+    ASSERT_FALSE(gamekitSessionManagerInstance->AreSettingsLoaded(GameKit::FeatureType::Identity));
+}
+
 TEST_F(GameKitSessionManagerTestFixture, No_RefreshToken_Abort_Success)
 {
     // arrange
@@ -78,3 +143,71 @@ TEST_F(GameKitSessionManagerTestFixture, No_RefreshToken_Abort_Success)
 
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(cognitoMock.get()));
 }
+
+TEST_F(GameKitSessionManagerTestFixture, RefreshTokensNow_TestCurrentVersion_TokensRefreshed)
+{
+    // arrange
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::RefreshToken, "refresh");
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "expired");
+    auto cognitoMock = Aws::MakeShared<GameKit::Mocks::MockCognitoIdentityProviderClient>("cognitoMock");
+    gamekitSessionManagerInstance->SetCognitoClient(cognitoMock.get());
+
+    AuthenticationResultType authResult;
+    authResult.SetIdToken("refreshed");
+    authResult.SetAccessToken("access");
+    authResult.SetExpiresIn(3600);
+    InitiateAuthResult result;
+    result.SetAuthenticationResult(authResult);
+
+    EXPECT_CALL(*cognitoMock.get(), InitiateAuth(_))
+        .WillOnce(Return(InitiateAuthOutcome(result)));
+
+    // act
+    auto staleVersion = gamekitSessionManagerInstance->GetTokenVersion();
+    auto refreshResult = gamekitSessionManagerInstance->RefreshTokensNow(staleVersion);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, refreshResult);
+    ASSERT_EQ("refreshed", gamekitSessionManagerInstance->GetToken(GameKit::TokenType::IdToken));
+    ASSERT_EQ("access", gamekitSessionManagerInstance->GetToken(GameKit::TokenType::AccessToken));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cognitoMock.get()));
+}
+
+TEST_F(GameKitSessionManagerTestFixture, RefreshTokensNow_TestStaleVersion_NoRefresh)
+{
+    // arrange
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::RefreshToken, "refresh");
+    auto staleVersion = gamekitSessionManagerInstance->GetTokenVersion();
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "refreshedByAnotherCaller");
+    auto cognitoMock = Aws::MakeShared<GameKit::Mocks::MockCognitoIdentityProviderClient>("cognitoMock");
+    gamekitSessionManagerInstance->SetCognitoClient(cognitoMock.get());
+
+    EXPECT_CALL(*cognitoMock.get(), InitiateAuth(_))
+        .Times(0);
+
+    // act
+    auto refreshResult = gamekitSessionManagerInstance->RefreshTokensNow(staleVersion);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, refreshResult);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cognitoMock.get()));
+}
+
+TEST_F(GameKitSessionManagerTestFixture, RefreshTokensNow_TestRefreshTokenRejected_Failure)
+{
+    // arrange
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::RefreshToken, "revoked");
+    auto cognitoMock = Aws::MakeShared<GameKit::Mocks::MockCognitoIdentityProviderClient>("cognitoMock");
+    gamekitSessionManagerInstance->SetCognitoClient(cognitoMock.get());
+
+    Aws::Client::AWSError<Aws::CognitoIdentityProvider::CognitoIdentityProviderErrors> error(Aws::CognitoIdentityProvider::CognitoIdentityProviderErrors::NOT_AUTHORIZED, false);
+    EXPECT_CALL(*cognitoMock.get(), InitiateAuth(_))
+        .WillOnce(Return(InitiateAuthOutcome(error)));
+
+    // act
+    auto refreshResult = gamekitSessionManagerInstance->RefreshTokensNow(gamekitSessionManagerInstance->GetTokenVersion());
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_TOKEN_REFRESH_FAILED, refreshResult);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cognitoMock.get()));
+}
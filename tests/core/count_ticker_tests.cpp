@@ -27,4 +27,9 @@ TEST_F(GameKitUtilsCountTickerTestFixture, SharedTicker_ThreadStopsAfterTickerDe
 TEST_F(GameKitUtilsCountTickerTestFixture, Ticker_StartCalledTwice_NewThreadNotStarted)
 {
     Test_Ticker_StartCalledTwice_NewThreadNotStarted();
-}
\ No newline at end of file
+}
+
+TEST_F(GameKitUtilsCountTickerTestFixture, Ticker_RescheduleNextTick_TicksAfterDelay)
+{
+    Test_Ticker_RescheduleNextTick_TicksAfterDelay();
+}
@@ -261,9 +261,12 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenNoErrors_RefreshFeatureSta
     // Arrange
     setAllFeatureStatuses(FeatureStatus::Unknown);
 
+    // A single sweep describes the stacks of all the features
+    EXPECT_CALL(*getFeatureResourcesMock(FeatureType::Main), DescribeFeatureStacks(SizeIs(availableFeatures.size()), _)).WillOnce(Return(GAMEKIT_SUCCESS));
     for (FeatureType feature : availableFeatures)
     {
-        EXPECT_CALL(*getFeatureResourcesMock(feature), GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*getFeatureResourcesMock(feature), GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*getFeatureResourcesMock(feature), GetCurrentStackStatus()).Times(0);
     }
 
     // Act
@@ -280,6 +283,55 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenNoErrors_RefreshFeatureSta
         ASSERT_EQ(dispatcher.featureStatuses[feature], FeatureStatus::Deployed);
     }
 }
+
+TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenRecentRefresh_RefreshFeatureStatuses_ReusesStatusesWithoutDescribingStacks)
+{
+    // Arrange
+    setAllFeatureStatuses(FeatureStatus::Unknown);
+
+    EXPECT_CALL(*getFeatureResourcesMock(FeatureType::Main), DescribeFeatureStacks(_, _)).WillOnce(Return(GAMEKIT_SUCCESS));
+    for (FeatureType feature : availableFeatures)
+    {
+        EXPECT_CALL(*getFeatureResourcesMock(feature), GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
+    }
+
+    // Act
+    deploymentOrchestrator->RefreshFeatureStatuses();
+    const unsigned int result = deploymentOrchestrator->RefreshFeatureStatuses(&dispatcher, deploymentResponseCallback);
+
+    // Assert
+    ASSERT_EQ(result, GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callCount, 1);
+
+    for (FeatureType feature : availableFeatures)
+    {
+        ASSERT_EQ(dispatcher.featureStatuses[feature], FeatureStatus::Deployed);
+    }
+}
+
+TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenDescribeStacksFails_RefreshFeatureStatuses_DescribesEachFeatureStack)
+{
+    // Arrange
+    setAllFeatureStatuses(FeatureStatus::Unknown);
+
+    EXPECT_CALL(*getFeatureResourcesMock(FeatureType::Main), DescribeFeatureStacks(_, _)).WillOnce(Return(GAMEKIT_ERROR_CLOUDFORMATION_DESCRIBE_STACKS_FAILED));
+    for (FeatureType feature : availableFeatures)
+    {
+        EXPECT_CALL(*getFeatureResourcesMock(feature), GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*getFeatureResourcesMock(feature), GetStackStatusFromDescription(_)).Times(0);
+    }
+
+    // Act
+    const unsigned int result = deploymentOrchestrator->RefreshFeatureStatuses(&dispatcher, deploymentResponseCallback);
+
+    // Assert
+    ASSERT_EQ(result, GAMEKIT_SUCCESS);
+
+    for (FeatureType feature : availableFeatures)
+    {
+        ASSERT_EQ(deploymentOrchestrator->GetFeatureStatus(feature), FeatureStatus::Deployed);
+    }
+}
 #pragma endregion
 
 #pragma region CanCreateFeature
@@ -678,7 +730,7 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenNoInstanceFiles_CreateFeat
     for (FeatureType feature : availableFeatures)
     {
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
-        EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("UNDEPLOYED"));
+        EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("UNDEPLOYED"));
     }
 
     setUpFeatureForDeployment(FeatureType::Main, true, false);
@@ -714,11 +766,11 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenMainStackExists_CreateFeat
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
         if (feature == FeatureType::Main)
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
         }
         else
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("UNDEPLOYED"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("UNDEPLOYED"));
         }
     }
 
@@ -755,11 +807,11 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenCannotCreateAfterStatusRef
         if (feature == FeatureType::Main)
         {
             // Main will be marked as running after status is refreshed
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("IN_PROGRESS"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("IN_PROGRESS"));
         }
         else
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("UNDEPLOYED"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("UNDEPLOYED"));
         }
     }
 
@@ -813,7 +865,7 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenFeatureResourcesThrowsAnEr
     for (FeatureType feature : availableFeatures)
     {
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
-        EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("UNDEPLOYED"));
+        EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("UNDEPLOYED"));
     }
 
     const std::shared_ptr<MockGameKitFeatureResources> mainResources = getFeatureResourcesMock(FeatureType::Main);
@@ -848,7 +900,7 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenStacksExist_RedeployFeatur
     for (FeatureType feature : availableFeatures)
     {
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
-        EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
     }
 
     setUpFeatureForDeployment(FeatureType::Main, false, true);
@@ -884,11 +936,11 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenFeatureStackInError_Redepl
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
         if (feature == FeatureType::GameStateCloudSaving)
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("FAILED"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("FAILED"));
         }
         else
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
         }
     }
 
@@ -969,11 +1021,11 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenCannotDeleteFeatureAfterSt
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
         if (feature == FeatureType::GameStateCloudSaving)
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("IN_PROGRESS"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("IN_PROGRESS"));
         }
         else
         {
-            EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+            EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
         }
     }
 
@@ -997,7 +1049,7 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenCanDeleteFeature_DeleteFea
     for (FeatureType feature : availableFeatures)
     {
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
-        EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
     }
 
     const std::shared_ptr<MockGameKitFeatureResources> gameSavingResources = getFeatureResourcesMock(FeatureType::GameStateCloudSaving);
@@ -1023,7 +1075,7 @@ TEST_F(GameKitDeploymentOrchestratorTestFixture, GivenDeleteThrowsAnError_Delete
     for (FeatureType feature : availableFeatures)
     {
         const std::shared_ptr<MockGameKitFeatureResources> featureResources = getFeatureResourcesMock(feature);
-        EXPECT_CALL(*featureResources, GetCurrentStackStatus()).WillOnce(Return("COMPLETE"));
+        EXPECT_CALL(*featureResources, GetStackStatusFromDescription(_)).WillOnce(Return("COMPLETE"));
     }
 
     const std::shared_ptr<MockGameKitFeatureResources> gameSavingResources = getFeatureResourcesMock(FeatureType::GameStateCloudSaving);
@@ -0,0 +1,126 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+// Tests
+#include "custom_test_flags.h"
+#include "feature_deployment_scheduler_tests.h"
+
+using namespace GameKit::Tests::FeatureDeploymentScheduler;
+
+void GameKitFeatureDeploymentSchedulerTestFixture::TearDown()
+{
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitFeatureDeploymentSchedulerTestFixture, DependentFeatures_DeployInDependencyOrder_UpstreamFeatureDeployedFirst)
+{
+    // arrange
+    std::mutex orderMutex;
+    std::vector<GameKit::FeatureType> deployOrder;
+    const std::unordered_set<GameKit::FeatureType> features { GameKit::FeatureType::Achievements, GameKit::FeatureType::Identity, GameKit::FeatureType::UserGameplayData };
+
+    // act
+    std::unordered_map<GameKit::FeatureType, unsigned int> results;
+    const unsigned int result = GameKit::FeatureDeploymentScheduler::DeployInDependencyOrder(features, GameKit::FEATURE_DEPENDENCIES, [&](GameKit::FeatureType feature)
+    {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        deployOrder.push_back(feature);
+        return GameKit::GAMEKIT_SUCCESS;
+    }, results);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, result);
+    ASSERT_EQ(3, deployOrder.size());
+    ASSERT_EQ(GameKit::FeatureType::Identity, deployOrder[0]);
+    ASSERT_EQ(3, results.size());
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, results[GameKit::FeatureType::Achievements]);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, results[GameKit::FeatureType::UserGameplayData]);
+}
+
+TEST_F(GameKitFeatureDeploymentSchedulerTestFixture, IndependentFeatures_DeployInDependencyOrder_DeployedConcurrently)
+{
+    // arrange
+    std::mutex startedMutex;
+    std::condition_variable featureStarted;
+    size_t startedDeployments = 0;
+    const std::unordered_set<GameKit::FeatureType> features { GameKit::FeatureType::Achievements, GameKit::FeatureType::GameStateCloudSaving, GameKit::FeatureType::UserGameplayData };
+
+    // act
+    // Each deployment only succeeds if all the others start while it is still running
+    std::unordered_map<GameKit::FeatureType, unsigned int> results;
+    const unsigned int result = GameKit::FeatureDeploymentScheduler::DeployInDependencyOrder(features, GameKit::FEATURE_DEPENDENCIES, [&](GameKit::FeatureType feature)
+    {
+        std::unique_lock<std::mutex> lock(startedMutex);
+        ++startedDeployments;
+        featureStarted.notify_all();
+
+        const bool allStarted = featureStarted.wait_for(lock, std::chrono::seconds(10), [&]() { return startedDeployments == features.size(); });
+        return allStarted ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_GENERAL;
+    }, results);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, result);
+}
+
+TEST_F(GameKitFeatureDeploymentSchedulerTestFixture, UpstreamFeatureFails_DeployInDependencyOrder_DownstreamFeaturesSkipped)
+{
+    // arrange
+    std::mutex deployedMutex;
+    std::unordered_set<GameKit::FeatureType> deployedFeatures;
+    const std::unordered_set<GameKit::FeatureType> features { GameKit::FeatureType::Identity, GameKit::FeatureType::Achievements, GameKit::FeatureType::GameStateCloudSaving, GameKit::FeatureType::UserGameplayData };
+    const GameKit::FeatureDependencies dependencies =
+    {
+        { GameKit::FeatureType::Identity, { } },
+        { GameKit::FeatureType::Achievements, { GameKit::FeatureType::Identity } },
+        { GameKit::FeatureType::GameStateCloudSaving, { GameKit::FeatureType::Achievements } },
+        { GameKit::FeatureType::UserGameplayData, { } }
+    };
+
+    // act
+    std::unordered_map<GameKit::FeatureType, unsigned int> results;
+    const unsigned int result = GameKit::FeatureDeploymentScheduler::DeployInDependencyOrder(features, dependencies, [&](GameKit::FeatureType feature)
+    {
+        std::lock_guard<std::mutex> lock(deployedMutex);
+        deployedFeatures.insert(feature);
+        return feature == GameKit::FeatureType::Identity ? GameKit::GAMEKIT_ERROR_CLOUDFORMATION_STACK_CREATION_FAILED : GameKit::GAMEKIT_SUCCESS;
+    }, results);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_CLOUDFORMATION_STACK_CREATION_FAILED, result);
+    ASSERT_EQ(std::unordered_set<GameKit::FeatureType>({ GameKit::FeatureType::Identity, GameKit::FeatureType::UserGameplayData }), deployedFeatures);
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_CLOUDFORMATION_STACK_CREATION_FAILED, results[GameKit::FeatureType::Identity]);
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED, results[GameKit::FeatureType::Achievements]);
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED, results[GameKit::FeatureType::GameStateCloudSaving]);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, results[GameKit::FeatureType::UserGameplayData]);
+}
+
+TEST_F(GameKitFeatureDeploymentSchedulerTestFixture, CircularDependencies_DeployInDependencyOrder_NothingDeployed)
+{
+    // arrange
+    const std::unordered_set<GameKit::FeatureType> features { GameKit::FeatureType::Achievements, GameKit::FeatureType::GameStateCloudSaving };
+    const GameKit::FeatureDependencies dependencies =
+    {
+        { GameKit::FeatureType::Achievements, { GameKit::FeatureType::GameStateCloudSaving } },
+        { GameKit::FeatureType::GameStateCloudSaving, { GameKit::FeatureType::Achievements } }
+    };
+    unsigned int deployCount = 0;
+
+    // act
+    std::unordered_map<GameKit::FeatureType, unsigned int> results;
+    const unsigned int result = GameKit::FeatureDeploymentScheduler::DeployInDependencyOrder(features, dependencies, [&](GameKit::FeatureType feature)
+    {
+        ++deployCount;
+        return GameKit::GAMEKIT_SUCCESS;
+    }, results);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_ORCHESTRATION_UPSTREAM_FEATURE_FAILED, result);
+    ASSERT_EQ(0, deployCount);
+    ASSERT_EQ(2, results.size());
+}
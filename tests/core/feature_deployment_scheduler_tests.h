@@ -0,0 +1,30 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GTest
+#include <gtest/gtest.h>
+
+// GameKit
+#include <aws/gamekit/core/errors.h>
+#include <aws/gamekit/core/feature_deployment_scheduler.h>
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace FeatureDeploymentScheduler
+        {
+            class GameKitFeatureDeploymentSchedulerTestFixture : public ::testing::Test
+            {
+            public:
+                GameKitFeatureDeploymentSchedulerTestFixture() {}
+                ~GameKitFeatureDeploymentSchedulerTestFixture() {}
+
+                void SetUp() override {}
+                void TearDown() override;
+            };
+        }
+    }
+}
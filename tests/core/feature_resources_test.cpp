@@ -186,6 +186,40 @@ TEST_F(GameKitFeatureResourcesTestFixture, CanGetExistingParameters)
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
 }
 
+TEST_F(GameKitFeatureResourcesTestFixture, ManyStacksInAccount_DescribeFeatureStacks_SweepCappedThenDescribedByName)
+{
+    // arrange, every page of the account's stacks has a next page and none of the feature stacks
+    namespace CfnModel = Aws::CloudFormation::Model;
+    EXPECT_CALL(*cfnMock, DescribeStacks(_)).Times(4).WillRepeatedly([](const CfnModel::DescribeStacksRequest& request)
+    {
+        CfnModel::DescribeStacksResult result;
+        if (!request.StackNameHasBeenSet())
+        {
+            result.AddStacks(CfnModel::Stack().WithStackName("other-stack").WithStackStatus(CfnModel::StackStatus::CREATE_COMPLETE));
+            result.SetNextToken("next-page");
+            return CfnModel::DescribeStacksOutcome(result);
+        }
+
+        if (request.GetStackName() == "missing-stack")
+        {
+            return CfnModel::DescribeStacksOutcome(Aws::Client::AWSError<Aws::CloudFormation::CloudFormationErrors>(Aws::CloudFormation::CloudFormationErrors::VALIDATION, false));
+        }
+
+        result.AddStacks(CfnModel::Stack().WithStackName(request.GetStackName()).WithStackStatus(CfnModel::StackStatus::UPDATE_COMPLETE));
+        return CfnModel::DescribeStacksOutcome(result);
+    });
+
+    // act
+    std::unordered_map<std::string, CfnModel::Stack> describedStacks;
+    const unsigned int result = gamekitFeatureResourcesInstance->DescribeFeatureStacks({ "found-stack", "missing-stack" }, describedStacks);
+
+    // assert, two pages are swept then each missing stack is described by name
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, result);
+    ASSERT_EQ(1, describedStacks.size());
+    ASSERT_EQ(CfnModel::StackStatus::UPDATE_COMPLETE, describedStacks["found-stack"].GetStackStatus());
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+}
+
 TEST_F(GameKitFeatureResourcesTestFixture, UpdateDashboardStatusListsStacks)
 {
     gamekitFeatureResourcesInstance->SetPluginRoot("../core/test_data/sampleplugin/base");
@@ -238,3 +272,174 @@ TEST_F(GameKitFeatureResourcesTestFixture, DeployFeatureFunctions_Success)
     // clean artifacts
     TestFileSystemUtils::DeleteDirectory(INSTANCE_FILES_DIR);
 }
+
+TEST_F(GameKitFeatureResourcesTestFixture, DeployFeatureFunctions_UploadFails_ErrorReturned)
+{
+    // arrange
+    gamekitFeatureResourcesInstance->SetPluginRoot("../core/test_data/sampleplugin/base");
+    gamekitFeatureResourcesInstance->SetGameKitRoot("../core/test_data/sampleplugin/instance");
+
+    SSMModel::PutParameterResult putParamResult;
+    putParamResult.SetVersion(1);
+    auto putParamOutcome = SSMModel::PutParameterOutcome(putParamResult);
+    EXPECT_CALL(*ssmMock.get(), PutParameter(_))
+        .WillOnce(Return(putParamOutcome));
+
+    Aws::S3::S3Error error = Aws::S3::S3Error(Aws::Client::AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::ACCESS_DENIED, false));
+    auto putObjOutcome = S3Model::PutObjectOutcome(error);
+    EXPECT_CALL(*s3Mock.get(), PutObject(_))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(putObjOutcome));
+
+    // act
+    unsigned int saveFuncResult = gamekitFeatureResourcesInstance->SaveFunctionInstances();
+    unsigned int deployResult = gamekitFeatureResourcesInstance->DeployFeatureFunctions();
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, saveFuncResult);
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED, deployResult);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(ssmMock.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(s3Mock.get()));
+    Mock::VerifyAndClearExpectations(testStackInitializer.GetMockHttpClientFactory()->GetClient().get());
+    testStackInitializer.GetMockHttpClientFactory()->GetClient().reset();
+
+    // clean artifacts
+    TestFileSystemUtils::DeleteDirectory(INSTANCE_FILES_DIR);
+}
+
+TEST_F(GameKitFeatureResourcesTestFixture, DeployFeatureLayers_LayersUnchanged_NothingPublished)
+{
+    // arrange
+    gamekitFeatureResourcesInstance->SetPluginRoot("../core/test_data/sampleplugin/base");
+    gamekitFeatureResourcesInstance->SetGameKitRoot("../core/test_data/sampleplugin/instance");
+
+    const std::string layerDirectory = std::string(INSTANCE_FILES_DIR) + "/layers/" + GameKit::GetFeatureTypeString(GameKit::FeatureType::Identity) + "/test_layer";
+    boost::filesystem::create_directories(layerDirectory);
+    GameKit::Utils::FileUtils::WriteStringToFile("print('unchanged')", layerDirectory + "/unchanged.py");
+    std::string layerHash;
+    GameKit::Utils::FileUtils::CalculateDirectoryHash(layerDirectory, layerHash);
+
+    Aws::Vector<SSMModel::Parameter> params;
+    params.push_back(SSMModel::Parameter()
+        .WithName(gamekitFeatureResourcesInstance->GetLambdaLayerHashParamName("test_layer").c_str())
+        .WithValue(layerHash.c_str())
+        .WithVersion(1));
+    params.push_back(SSMModel::Parameter()
+        .WithName(gamekitFeatureResourcesInstance->GetLambdaLayerARNParamName("test_layer").c_str())
+        .WithValue("arn:aws:lambda:us-west-2:123456789012:layer:test_layer:1")
+        .WithVersion(1));
+    SSMModel::GetParametersResult getParamsResult;
+    getParamsResult.SetParameters(params);
+
+    // a single batched read, no uploads and no writes
+    EXPECT_CALL(*ssmMock.get(), GetParameters(_))
+        .Times(1)
+        .WillOnce(Return(SSMModel::GetParametersOutcome(getParamsResult)));
+    EXPECT_CALL(*ssmMock.get(), PutParameter(_)).Times(0);
+    EXPECT_CALL(*s3Mock.get(), PutObject(_)).Times(0);
+
+    // act
+    unsigned int deployResult = gamekitFeatureResourcesInstance->DeployFeatureLayers();
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, deployResult);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(ssmMock.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(s3Mock.get()));
+
+    // clean artifacts
+    TestFileSystemUtils::DeleteDirectory(INSTANCE_FILES_DIR);
+}
+
+TEST_F(GameKitFeatureResourcesTestFixture, DeployFeatureLayers_HashMatchesAndArnPresent_ArnReadAndNothingPublished)
+{
+    // arrange
+    gamekitFeatureResourcesInstance->SetPluginRoot("../core/test_data/sampleplugin/base");
+    gamekitFeatureResourcesInstance->SetGameKitRoot("../core/test_data/sampleplugin/instance");
+
+    const std::string layerDirectory = std::string(INSTANCE_FILES_DIR) + "/layers/" + GameKit::GetFeatureTypeString(GameKit::FeatureType::Identity) + "/test_layer";
+    boost::filesystem::create_directories(layerDirectory);
+    GameKit::Utils::FileUtils::WriteStringToFile("print('deployed')", layerDirectory + "/deployed.py");
+    std::string layerHash;
+    GameKit::Utils::FileUtils::CalculateDirectoryHash(layerDirectory, layerHash);
+
+    const std::string hashParamName = gamekitFeatureResourcesInstance->GetLambdaLayerHashParamName("test_layer");
+    const std::string arnParamName = gamekitFeatureResourcesInstance->GetLambdaLayerARNParamName("test_layer");
+    Aws::Vector<SSMModel::Parameter> params;
+    params.push_back(SSMModel::Parameter().WithName(hashParamName.c_str()).WithValue(layerHash.c_str()).WithVersion(1));
+    params.push_back(SSMModel::Parameter().WithName(arnParamName.c_str()).WithValue("arn:aws:lambda:us-west-2:123456789012:layer:test_layer:1").WithVersion(1));
+    SSMModel::GetParametersResult getParamsResult;
+    getParamsResult.SetParameters(params);
+
+    // every deployment reads the deployed ARN along with the hash
+    std::vector<Aws::Vector<Aws::String>> requestedNames;
+    EXPECT_CALL(*ssmMock.get(), GetParameters(_))
+        .Times(2)
+        .WillRepeatedly([&](const SSMModel::GetParametersRequest& request)
+        {
+            requestedNames.push_back(request.GetNames());
+            return SSMModel::GetParametersOutcome(getParamsResult);
+        });
+    EXPECT_CALL(*ssmMock.get(), PutParameter(_)).Times(0);
+    EXPECT_CALL(*s3Mock.get(), PutObject(_)).Times(0);
+
+    // act
+    unsigned int firstDeployResult = gamekitFeatureResourcesInstance->DeployFeatureLayers();
+    unsigned int secondDeployResult = gamekitFeatureResourcesInstance->DeployFeatureLayers();
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, firstDeployResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, secondDeployResult);
+    ASSERT_EQ(requestedNames.size(), 2);
+    for (const Aws::Vector<Aws::String>& names : requestedNames)
+    {
+        ASSERT_THAT(names, testing::Contains(Aws::String(arnParamName.c_str())));
+    }
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(ssmMock.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(s3Mock.get()));
+
+    // clean artifacts
+    TestFileSystemUtils::DeleteDirectory(INSTANCE_FILES_DIR);
+}
+
+TEST_F(GameKitFeatureResourcesTestFixture, DeployFeatureLayers_GetParametersDenied_ParametersReadOneByOne)
+{
+    // arrange
+    gamekitFeatureResourcesInstance->SetPluginRoot("../core/test_data/sampleplugin/base");
+    gamekitFeatureResourcesInstance->SetGameKitRoot("../core/test_data/sampleplugin/instance");
+
+    const std::string layerDirectory = std::string(INSTANCE_FILES_DIR) + "/layers/" + GameKit::GetFeatureTypeString(GameKit::FeatureType::Identity) + "/test_layer";
+    boost::filesystem::create_directories(layerDirectory);
+    GameKit::Utils::FileUtils::WriteStringToFile("print('denied')", layerDirectory + "/denied.py");
+    std::string layerHash;
+    GameKit::Utils::FileUtils::CalculateDirectoryHash(layerDirectory, layerHash);
+
+    const std::string hashParamName = gamekitFeatureResourcesInstance->GetLambdaLayerHashParamName("test_layer");
+    const std::string arnParamName = gamekitFeatureResourcesInstance->GetLambdaLayerARNParamName("test_layer");
+
+    // policies written for earlier versions only allow ssm:GetParameter
+    EXPECT_CALL(*ssmMock.get(), GetParameters(_))
+        .Times(1)
+        .WillOnce(Return(SSMModel::GetParametersOutcome(Aws::Client::AWSError<Aws::SSM::SSMErrors>(Aws::SSM::SSMErrors::ACCESS_DENIED, false))));
+    EXPECT_CALL(*ssmMock.get(), GetParameter(_))
+        .Times(2)
+        .WillRepeatedly([&](const SSMModel::GetParameterRequest& request)
+        {
+            const std::string value = std::string(request.GetName().c_str()) == hashParamName ? layerHash : "arn:aws:lambda:us-west-2:123456789012:layer:test_layer:1";
+            SSMModel::GetParameterResult result;
+            result.SetParameter(SSMModel::Parameter().WithName(request.GetName()).WithValue(value.c_str()).WithVersion(1));
+            return SSMModel::GetParameterOutcome(result);
+        });
+    EXPECT_CALL(*ssmMock.get(), PutParameter(_)).Times(0);
+    EXPECT_CALL(*s3Mock.get(), PutObject(_)).Times(0);
+
+    // act
+    unsigned int deployResult = gamekitFeatureResourcesInstance->DeployFeatureLayers();
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, deployResult);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(ssmMock.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(s3Mock.get()));
+
+    // clean artifacts
+    TestFileSystemUtils::DeleteDirectory(INSTANCE_FILES_DIR);
+}
@@ -63,6 +63,23 @@ public:
 };
 
 using namespace GameKit::Tests::GameKitAccount;
+
+namespace
+{
+    // Returns a DescribeStacks action that plays the outcomes in order for each stack name separately, repeating the last outcome
+    std::function<CfnModel::DescribeStacksOutcome(const CfnModel::DescribeStacksRequest&)> describeStacksPerStack(const std::vector<CfnModel::DescribeStacksOutcome>& outcomes)
+    {
+        const auto callCountsMutex = std::make_shared<std::mutex>();
+        const auto callCounts = std::make_shared<std::unordered_map<std::string, size_t>>();
+        return [=](const CfnModel::DescribeStacksRequest& request)
+        {
+            std::lock_guard<std::mutex> lock(*callCountsMutex);
+            size_t& callCount = (*callCounts)[ToStdString(request.GetStackName())];
+            return outcomes[std::min(callCount++, outcomes.size() - 1)];
+        };
+    }
+}
+
 TEST_F(GameKitAccountTestFixture, BucketExists_TestHasbootstrapBucket_True)
 {
     // arrange
@@ -252,10 +269,13 @@ TEST_F(GameKitAccountTestFixture, ValidCredentials_TestHasValidCredentials_True)
 TEST_F(GameKitAccountTestFixture, SecretNotExist_TestSaveSecret_Create)
 {
     // arrange
-    auto describeOutcome = SecretsModel::DescribeSecretOutcome();
-    EXPECT_CALL(*accountSecretsMock.get(), DescribeSecret(_))
+    auto error = Aws::Client::AWSError<Aws::SecretsManager::SecretsManagerErrors>(Aws::SecretsManager::SecretsManagerErrors::RESOURCE_NOT_FOUND, false);
+    auto updateOutcome = SecretsModel::UpdateSecretOutcome(error);
+    EXPECT_CALL(*accountSecretsMock.get(), UpdateSecret(_))
         .Times(1)
-        .WillOnce(Return(describeOutcome));
+        .WillOnce(Return(updateOutcome));
+    EXPECT_CALL(*accountSecretsMock.get(), DescribeSecret(_))
+        .Times(0);
 
     SecretsModel::CreateSecretResult createResult;
     createResult.SetName("key");
@@ -274,19 +294,17 @@ TEST_F(GameKitAccountTestFixture, SecretNotExist_TestSaveSecret_Create)
 TEST_F(GameKitAccountTestFixture, SecretExists_TestSaveSecret_Update)
 {
     // arrange
-    SecretsModel::DescribeSecretResult describeResult;
-    describeResult.SetName("key");
-    auto describeOutcome = SecretsModel::DescribeSecretOutcome(describeResult);
     EXPECT_CALL(*accountSecretsMock.get(), DescribeSecret(_))
-        .Times(1)
-        .WillOnce(Return(describeOutcome));
+        .Times(0);
 
     SecretsModel::UpdateSecretResult updateResult;
     updateResult.SetName("key");
-    auto createOutcome = SecretsModel::UpdateSecretOutcome(updateResult);
+    auto updateOutcome = SecretsModel::UpdateSecretOutcome(updateResult);
     EXPECT_CALL(*accountSecretsMock.get(), UpdateSecret(_))
         .Times(1)
-        .WillOnce(Return(createOutcome));
+        .WillOnce(Return(updateOutcome));
+    EXPECT_CALL(*accountSecretsMock.get(), CreateSecret(_))
+        .Times(0);
 
     // act
     auto result = testGamekitAccountInstance->SaveSecret("key", "secret");
@@ -435,7 +453,7 @@ TEST_F(GameKitAccountTestFixture, MainStackDoesNotExist_TestCreateMainStack_Crea
     EXPECT_CALL(*accountCfnMock.get(), CreateStackCallable(_))
         .Times(1);
 
-    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEvents(_))
         .Times(3);
 
     // act
@@ -489,7 +507,7 @@ TEST_F(GameKitAccountTestFixture, MainStackExists_TestUpdateMainStack_Updated)
     EXPECT_CALL(*accountCfnMock.get(), UpdateStackCallable(_))
         .Times(1);
 
-    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEvents(_))
         .Times(3);
 
     // act
@@ -526,30 +544,20 @@ TEST_F(GameKitAccountTestFixture, FeatureStacksDoNotExist_TestCreateFeatureStack
     describeStackCompleteResult.SetStacks(stacks);
     auto describeStackCompleteOutcome = CfnModel::DescribeStacksOutcome(describeStackCompleteResult);
 
+    // Feature stacks are deployed concurrently, so each stack gets its own sequence of DescribeStacks outcomes
     auto describeNoResultOutcome = CfnModel::DescribeStacksOutcome();
     EXPECT_CALL(*accountCfnMock.get(), DescribeStacks(_))
-        .Times(13)
-        .WillOnce(Return(describeNoResultOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackCompleteResult))
-        .WillOnce(Return(describeNoResultOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackCompleteResult))
-        .WillOnce(Return(describeNoResultOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillRepeatedly(Return(describeStackCompleteResult));
+        .Times(12)
+        .WillRepeatedly(Invoke(describeStacksPerStack({ describeNoResultOutcome, describeStackInProgressOutcome, describeStackCompleteOutcome })));
 
     EXPECT_CALL(*accountCfnMock.get(), UpdateStackCallable(_))
-        .Times(2);
+        .Times(0);
 
     EXPECT_CALL(*accountCfnMock.get(), CreateStackCallable(_))
-        .Times(1);
+        .Times(3);
 
-    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEventsCallable(_))
-        .Times(7);
+    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEvents(_))
+        .Times(6);
 
     // act
     unsigned int saveTemplatesResult = testGamekitAccountInstance->SaveFeatureInstanceTemplates();
@@ -593,26 +601,16 @@ TEST_F(GameKitAccountTestFixture, FeatureStacksExist_TestUpdateFeatureStacks_Upd
     describeStackCompleteResult.SetStacks(stacks);
     auto describeStackCompleteOutcome = CfnModel::DescribeStacksOutcome(describeStackCompleteResult);
 
+    // Feature stacks are deployed concurrently, so each stack gets its own sequence of DescribeStacks outcomes
     EXPECT_CALL(*accountCfnMock.get(), DescribeStacks(_))
-        .Times(13)
-        .WillOnce(Return(describeStackExistsOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackCompleteResult))
-        .WillOnce(Return(describeStackExistsOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackCompleteResult))
-        .WillOnce(Return(describeStackExistsOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillOnce(Return(describeStackInProgressOutcome))
-        .WillRepeatedly(Return(describeStackCompleteResult));
+        .Times(12)
+        .WillRepeatedly(Invoke(describeStacksPerStack({ describeStackExistsOutcome, describeStackInProgressOutcome, describeStackCompleteOutcome })));
 
     EXPECT_CALL(*accountCfnMock.get(), UpdateStackCallable(_))
         .Times(3);
 
-    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEventsCallable(_))
-        .Times(7);
+    EXPECT_CALL(*accountCfnMock.get(), DescribeStackEvents(_))
+        .Times(6);
 
     // act
     unsigned int saveTemplatesResult = testGamekitAccountInstance->SaveFeatureInstanceTemplates();
@@ -245,10 +245,13 @@ TEST_F(GameKitCoreExportsTestFixture, TestGameKitAccountSaveSecret_Success)
     auto acctInstance = createAccountInstance();
     setAccountMocks(acctInstance);
 
-    auto describeOutcome = SecretsModel::DescribeSecretOutcome();
-    EXPECT_CALL(*coreSecretsMock.get(), DescribeSecret(_))
+    auto error = Aws::Client::AWSError<Aws::SecretsManager::SecretsManagerErrors>(Aws::SecretsManager::SecretsManagerErrors::RESOURCE_NOT_FOUND, false);
+    auto updateOutcome = SecretsModel::UpdateSecretOutcome(error);
+    EXPECT_CALL(*coreSecretsMock.get(), UpdateSecret(_))
         .Times(1)
-        .WillOnce(Return(describeOutcome));
+        .WillOnce(Return(updateOutcome));
+    EXPECT_CALL(*coreSecretsMock.get(), DescribeSecret(_))
+        .Times(0);
 
     SecretsModel::CreateSecretResult createResult;
     createResult.SetName("key");
@@ -380,7 +383,7 @@ TEST_F(GameKitCoreExportsTestFixture, TestGameKitAccountCreateOrUpdateMainStack_
     EXPECT_CALL(*coreCfnMock.get(), CreateStackCallable(_))
         .Times(1);
 
-    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEvents(_))
         .Times(3);
 
     // act
@@ -456,7 +459,7 @@ TEST_F(GameKitCoreExportsTestFixture, TestGameKitAccountCreateOrUpdateStacks_Suc
     EXPECT_CALL(*coreCfnMock.get(), CreateStackCallable(_))
         .Times(AtLeast(1));
 
-    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEvents(_))
         .Times(AtLeast(2));
 
     // act
@@ -564,7 +567,7 @@ TEST_F(GameKitCoreExportsTestFixture, TestGameKitFeatureResourceCreateOrUpdateSt
     EXPECT_CALL(*coreCfnMock.get(), CreateStackCallable(_))
         .Times(1);
 
-    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEvents(_))
         .Times(1);
 
     // act
@@ -614,7 +617,7 @@ TEST_F(GameKitCoreExportsTestFixture, TestGameKitFeatureResourceDeleteStack_Succ
     EXPECT_CALL(*coreCfnMock.get(), DeleteStackCallable(_))
         .Times(1);
 
-    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEventsCallable(_))
+    EXPECT_CALL(*coreCfnMock.get(), DescribeStackEvents(_))
         .Times(2);
 
     // act
@@ -37,6 +37,8 @@ public:
     void TearDown()
     {
         instance = nullptr;
+        Logging::SetMinimumLevel(Level::None);
+        Logging::SetDeliveryMode(DeliveryMode::Synchronous);
 
         TestLogger::DumpToConsoleIfTestFailed();
         TestLogger::Clear();
@@ -89,3 +91,131 @@ TEST_F(LoggingTestFixture, AllLevels_TestCallback)
     EXPECT_TRUE(FindInLog("Error"));
     EXPECT_EQ(TestLogger::GetLogLines().size(), 5);
 }
+
+TEST_F(LoggingTestFixture, MinimumLevel_TestCallback)
+{
+    Logging::SetMinimumLevel(Level::Warning);
+
+    Logging::Log(TestLogger::Log, Level::Verbose, "Verbose");
+    Logging::Log(TestLogger::Log, Level::Info, "Info");
+    Logging::Log(TestLogger::Log, Level::Warning, "Warning");
+    Logging::Log(TestLogger::Log, Level::Error, "Error");
+
+    EXPECT_FALSE(FindInLog("Verbose"));
+    EXPECT_FALSE(FindInLog("Info"));
+    EXPECT_TRUE(FindInLog("Warning"));
+    EXPECT_TRUE(FindInLog("Error"));
+    EXPECT_EQ(TestLogger::GetLogLines().size(), 2);
+}
+
+TEST_F(LoggingTestFixture, DisabledLevel_LogMacro_MessageNotBuilt)
+{
+    Logging::SetMinimumLevel(Level::Info);
+    int messagesBuilt = 0;
+    auto buildMessage = [&](const std::string& text)
+    {
+        ++messagesBuilt;
+        return text;
+    };
+
+    GAMEKIT_LOG(TestLogger::Log, Level::Verbose, buildMessage("Verbose"));
+    GAMEKIT_LOG(TestLogger::Log, Level::Info, buildMessage("Info"));
+
+    EXPECT_EQ(messagesBuilt, 1);
+    EXPECT_FALSE(FindInLog("Verbose"));
+    EXPECT_TRUE(FindInLog("Info"));
+}
+
+TEST_F(LoggingTestFixture, LongMessage_TestCallback)
+{
+    const std::string message = std::string(10000, 'a') + "end";
+    Logging::Log(TestLogger::Log, Level::Info, message, this);
+
+    ASSERT_EQ(TestLogger::GetLogLines().size(), 1);
+    EXPECT_TRUE(FindInLog(message));
+}
+
+TEST_F(LoggingTestFixture, ManualDelivery_FlushLogs_DeliveredInOrder)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Manual);
+
+    Logging::Log(TestLogger::Log, Level::Info, "first");
+    Logging::Log(TestLogger::Log, Level::Warning, "second");
+    EXPECT_EQ(TestLogger::GetLogLines().size(), 0);
+
+    EXPECT_EQ(Logging::FlushLogs(), 2);
+    ASSERT_EQ(TestLogger::GetLogLines().size(), 2);
+    EXPECT_NE(TestLogger::GetLogLines()[0].find("first"), std::string::npos);
+    EXPECT_NE(TestLogger::GetLogLines()[1].find("second"), std::string::npos);
+    EXPECT_EQ(Logging::FlushLogs(), 0);
+}
+
+TEST_F(LoggingTestFixture, ManualDelivery_QueueFull_RecordsDroppedAndCounted)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Manual);
+    const unsigned long long droppedBefore = Logging::GetDroppedCount();
+    const unsigned int logged = 10000;
+
+    for (unsigned int i = 0; i < logged; ++i)
+    {
+        Logging::Log(TestLogger::Log, Level::Info, "message");
+    }
+    const unsigned int delivered = Logging::FlushLogs();
+
+    const unsigned long long dropped = Logging::GetDroppedCount() - droppedBefore;
+    EXPECT_GT(dropped, 0);
+    EXPECT_EQ(delivered + dropped, logged);
+    EXPECT_EQ(TestLogger::GetLogLines().size(), delivered);
+}
+
+TEST_F(LoggingTestFixture, BackgroundDelivery_SwitchedToSynchronous_QueuedRecordsDelivered)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Background);
+
+    Logging::Log(TestLogger::Log, Level::Info, "queued");
+
+    // Stops the delivery thread and delivers what it didn't get to
+    Logging::SetDeliveryMode(DeliveryMode::Synchronous);
+    Logging::Log(TestLogger::Log, Level::Info, "synchronous");
+
+    ASSERT_EQ(TestLogger::GetLogLines().size(), 2);
+    EXPECT_NE(TestLogger::GetLogLines()[0].find("queued"), std::string::npos);
+    EXPECT_NE(TestLogger::GetLogLines()[1].find("synchronous"), std::string::npos);
+}
+
+namespace
+{
+    void flushingLogCallback(unsigned int level, const char* message, int size)
+    {
+        // Would wait on the drain lock of its own thread if the drain weren't re-entrant
+        Logging::FlushLogs();
+        LoggingTestFixture::TestLogger::Log(level, message, size);
+    }
+}
+
+TEST_F(LoggingTestFixture, ManualDelivery_CallbackFlushesLogs_NoDeadlock)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Manual);
+
+    Logging::Log(flushingLogCallback, Level::Info, "first");
+    Logging::Log(flushingLogCallback, Level::Info, "second");
+
+    EXPECT_EQ(Logging::FlushLogs(), 2);
+    ASSERT_EQ(TestLogger::GetLogLines().size(), 2);
+    EXPECT_NE(TestLogger::GetLogLines()[0].find("first"), std::string::npos);
+    EXPECT_NE(TestLogger::GetLogLines()[1].find("second"), std::string::npos);
+}
+
+TEST_F(LoggingTestFixture, BackgroundDelivery_Shutdown_QueuedRecordsDeliveredAndSynchronous)
+{
+    Logging::SetDeliveryMode(DeliveryMode::Background);
+
+    Logging::Log(TestLogger::Log, Level::Info, "queued");
+    Logging::Shutdown();
+    Logging::Log(TestLogger::Log, Level::Info, "synchronous");
+
+    EXPECT_EQ(Logging::GetDeliveryMode(), DeliveryMode::Synchronous);
+    ASSERT_EQ(TestLogger::GetLogLines().size(), 2);
+    EXPECT_NE(TestLogger::GetLogLines()[0].find("queued"), std::string::npos);
+    EXPECT_NE(TestLogger::GetLogLines()[1].find("synchronous"), std::string::npos);
+}
@@ -47,6 +47,8 @@ public:
         ofs.open(TEST_CREDENTIALS_FILE_LOCATION, std::ofstream::out | std::ofstream::trunc);
         ofs.close();
 
+        // write pending saves first so they can't recreate the settings file after it is removed
+        GameKitSettingsReload(instance);
         remove(instance->GetSettingsFilePath().c_str());
         GameKitSettingsInstanceRelease(instance);
         testStack.CleanupAndLog<TestLogger>();
@@ -24,8 +24,9 @@ public:
 
     void TearDown()
     {
-        // cleanup
+        // cleanup, write pending saves first so they can't recreate the file after it is removed
         auto path = gamekitSettingsInstance->GetSettingsFilePath();
+        gamekitSettingsInstance->Reload();
         boost::filesystem::remove(gamekitSettingsInstance->GetSettingsFilePath());
 
         gamekitSettingsInstance.reset();
@@ -190,4 +191,138 @@ TEST_F(GameKitSettingsTestFixture, SaveSettings_ValidateWarningExists)
     GameKit::Utils::FileUtils::ReadFileIntoString(gamekitSettingsInstance->GetSettingsFilePath(), saveInfo);
 
     ASSERT_THAT(saveInfo, testing::StartsWith(GameKit::Configuration::DO_NOT_EDIT));
-}
\ No newline at end of file
+}
+
+TEST_F(GameKitSettingsTestFixture, FileEditedExternally_NewInstance_ReadsEditedFile)
+{
+    // arrange
+    gamekitSettingsInstance->SetGameName("This is a sample game");
+    gamekitSettingsInstance->SaveSettings();
+    gamekitSettingsInstance->Reload();
+    GameKit::Utils::FileUtils::WriteStringToFile("game:\n  name: This game was renamed outside of the plugin\n", gamekitSettingsInstance->GetSettingsFilePath());
+
+    // act
+    GameKit::GameKitSettings otherInstance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+
+    // assert
+    ASSERT_EQ(otherInstance.GetGameName(), "This game was renamed outside of the plugin");
+}
+
+TEST_F(GameKitSettingsTestFixture, UnsavedChanges_NewInstance_ChangesNotShared)
+{
+    // arrange
+    gamekitSettingsInstance->SetGameName("This is a sample game");
+    gamekitSettingsInstance->SaveSettings();
+
+    // act
+    gamekitSettingsInstance->SetGameName("This name is not saved");
+    GameKit::GameKitSettings otherInstance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+
+    // assert
+    ASSERT_EQ(otherInstance.GetGameName(), "This is a sample game");
+    ASSERT_EQ(gamekitSettingsInstance->GetGameName(), "This name is not saved");
+}
+
+TEST_F(GameKitSettingsTestFixture, FileEditedExternallyWithinSameSecond_NewInstance_ReadsEditedFile)
+{
+    // arrange
+    const std::string settingsFile = gamekitSettingsInstance->GetSettingsFilePath();
+    GameKit::Utils::FileUtils::WriteStringToFile("game:\n  name: First name\n", settingsFile);
+    GameKit::GameKitSettings firstInstance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+
+    // act, same size and last write time
+    const std::time_t lastWriteTime = boost::filesystem::last_write_time(settingsFile);
+    GameKit::Utils::FileUtils::WriteStringToFile("game:\n  name: Other name\n", settingsFile);
+    boost::filesystem::last_write_time(settingsFile, lastWriteTime);
+    GameKit::GameKitSettings otherInstance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+
+    // assert
+    ASSERT_EQ(firstInstance.GetGameName(), "First name");
+    ASSERT_EQ(otherInstance.GetGameName(), "Other name");
+}
+
+TEST_F(GameKitSettingsTestFixture, SavesOfShortLivedInstances_NewInstance_LastSaveLoaded)
+{
+    // arrange
+    for (const std::string& environment : { "cd1", "cd2", "cd3" })
+    {
+        GameKit::GameKitSettings instance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+        instance.AddCustomEnvironment(environment, "Custom Env");
+        instance.SaveSettings();
+    }
+
+    // act
+    GameKit::GameKitSettings otherInstance("../core/test_data/sampleplugin/instance", "1.0.0", "testgame", "dev", TestLogger::Log);
+    const size_t loadedEnvironments = otherInstance.GetCustomEnvironments().count("cd3");
+    otherInstance.Reload();
+
+    // assert, the pending save is loaded from memory and written at the latest by Reload()
+    std::string saveInfo;
+    GameKit::Utils::FileUtils::ReadFileIntoString(otherInstance.GetSettingsFilePath(), saveInfo);
+    ASSERT_EQ(loadedEnvironments, 1);
+    ASSERT_THAT(saveInfo, testing::HasSubstr("cd3"));
+}
+
+TEST_F(GameKitSettingsTestFixture, WriteFails_FlushSettings_FailureReportedAndWriteRetried)
+{
+    // arrange, a directory in place of the settings file makes every write fail
+    const std::string settingsFile = gamekitSettingsInstance->GetSettingsFilePath();
+    gamekitSettingsInstance->FlushSettings();
+    boost::filesystem::remove(settingsFile);
+    boost::filesystem::create_directory(settingsFile);
+    gamekitSettingsInstance->SetGameName("This is a sample game");
+    gamekitSettingsInstance->SaveSettings();
+
+    // act
+    const unsigned int failedFlush = gamekitSettingsInstance->FlushSettings();
+    boost::filesystem::remove(settingsFile);
+    const unsigned int retriedFlush = gamekitSettingsInstance->FlushSettings();
+
+    // assert, the failed write stays pending until it succeeds
+    std::string saveInfo;
+    GameKit::Utils::FileUtils::ReadFileIntoString(settingsFile, saveInfo);
+    ASSERT_EQ(failedFlush, GameKit::GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED);
+    ASSERT_EQ(retriedFlush, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_THAT(saveInfo, testing::HasSubstr("This is a sample game"));
+}
+
+TEST_F(GameKitSettingsTestFixture, WriteFailed_SaveSettings_WriteRetriedAndFailureReported)
+{
+    // arrange
+    const std::string settingsFile = gamekitSettingsInstance->GetSettingsFilePath();
+    gamekitSettingsInstance->FlushSettings();
+    boost::filesystem::remove(settingsFile);
+    boost::filesystem::create_directory(settingsFile);
+    gamekitSettingsInstance->SaveSettings();
+    gamekitSettingsInstance->FlushSettings();
+
+    // act, the save right after a failed write is not debounced
+    gamekitSettingsInstance->SetGameName("This is a sample game");
+    const unsigned int failedSave = gamekitSettingsInstance->SaveSettings();
+    boost::filesystem::remove(settingsFile);
+    const unsigned int retriedSave = gamekitSettingsInstance->SaveSettings();
+
+    // assert
+    std::string saveInfo;
+    GameKit::Utils::FileUtils::ReadFileIntoString(settingsFile, saveInfo);
+    ASSERT_EQ(failedSave, GameKit::GAMEKIT_ERROR_SETTINGS_FILE_SAVE_FAILED);
+    ASSERT_EQ(retriedSave, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_THAT(saveInfo, testing::HasSubstr("This is a sample game"));
+}
+
+TEST_F(GameKitSettingsTestFixture, PendingSave_Shutdown_SettingsWritten)
+{
+    // arrange
+    gamekitSettingsInstance->SaveSettings();
+    gamekitSettingsInstance->SetGameName("This is a sample game");
+    gamekitSettingsInstance->SaveSettings();
+
+    // act
+    const unsigned int result = GameKit::GameKitSettings::Shutdown();
+
+    // assert
+    std::string saveInfo;
+    GameKit::Utils::FileUtils::ReadFileIntoString(gamekitSettingsInstance->GetSettingsFilePath(), saveInfo);
+    ASSERT_EQ(result, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_THAT(saveInfo, testing::HasSubstr("This is a sample game"));
+}
@@ -55,7 +55,7 @@ namespace GameKit
                 return describeOutcome;
             }
 
-            Aws::CloudFormation::Model::DescribeStackEventsOutcomeCallable DescribeStackEventsCallable(const Aws::CloudFormation::Model::DescribeStackEventsRequest& request) const
+            Aws::CloudFormation::Model::DescribeStackEventsOutcome DescribeStackEvents(const Aws::CloudFormation::Model::DescribeStackEventsRequest& request) const
             {
                 Aws::CloudFormation::Model::DescribeStackEventsResult eventsResult;
                 Aws::CloudFormation::Model::StackEvent stackEvent;
@@ -63,8 +63,7 @@ namespace GameKit
                 stackEvent.SetLogicalResourceId("TestResource");
                 stackEvent.SetResourceStatus(Aws::CloudFormation::Model::ResourceStatus::CREATE_COMPLETE);
                 eventsResult.AddStackEvents(stackEvent);
-                Aws::CloudFormation::Model::DescribeStackEventsOutcome eventsOutcome(eventsResult);
-                return std::async(std::launch::async, [=] { return  eventsOutcome; });
+                return Aws::CloudFormation::Model::DescribeStackEventsOutcome(eventsResult);
             }
 
             Aws::CloudFormation::Model::DeleteStackOutcomeCallable DeleteStackCallable(const Aws::CloudFormation::Model::DeleteStackRequest& request)
@@ -88,7 +87,7 @@ namespace GameKit
             MOCK_METHOD(Aws::CloudFormation::Model::DescribeStackResourceOutcome, DescribeStackResource, (const Aws::CloudFormation::Model::DescribeStackResourceRequest& request), (const, override));
             MOCK_METHOD(Aws::CloudFormation::Model::CreateStackOutcomeCallable, CreateStackCallable, (const Aws::CloudFormation::Model::CreateStackRequest& request), (const, override));
             MOCK_METHOD(Aws::CloudFormation::Model::UpdateStackOutcomeCallable, UpdateStackCallable, (const Aws::CloudFormation::Model::UpdateStackRequest& request), (const, override));
-            MOCK_METHOD(Aws::CloudFormation::Model::DescribeStackEventsOutcomeCallable, DescribeStackEventsCallable, (const Aws::CloudFormation::Model::DescribeStackEventsRequest& request), (const, override));
+            MOCK_METHOD(Aws::CloudFormation::Model::DescribeStackEventsOutcome, DescribeStackEvents, (const Aws::CloudFormation::Model::DescribeStackEventsRequest& request), (const, override));
             MOCK_METHOD(Aws::CloudFormation::Model::DeleteStackOutcomeCallable, DeleteStackCallable, (const Aws::CloudFormation::Model::DeleteStackRequest& request), (const, override));
             MOCK_METHOD(Aws::CloudFormation::Model::GetTemplateOutcome, GetTemplate, (const Aws::CloudFormation::Model::GetTemplateRequest& request), (const, override));
             MOCK_METHOD(Aws::CloudFormation::Model::ListStacksOutcome, ListStacks, (const Aws::CloudFormation::Model::ListStacksRequest&), (const, override));
@@ -106,9 +105,9 @@ namespace GameKit
                         return fake_.UpdateStackCallable(request);
                     });
 
-                ON_CALL(*this, DescribeStackEventsCallable).WillByDefault([this](const Aws::CloudFormation::Model::DescribeStackEventsRequest& request)
+                ON_CALL(*this, DescribeStackEvents).WillByDefault([this](const Aws::CloudFormation::Model::DescribeStackEventsRequest& request)
                     {
-                        return fake_.DescribeStackEventsCallable(request);
+                        return fake_.DescribeStackEvents(request);
                     });
 
                 ON_CALL(*this, DeleteStackCallable).WillByDefault([this](const Aws::CloudFormation::Model::DeleteStackRequest& request)
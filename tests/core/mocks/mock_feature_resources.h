@@ -39,6 +39,8 @@ public:
     MOCK_METHOD(unsigned int, DeployFeatureFunctions, (), (override));
 
     MOCK_METHOD(std::string, GetCurrentStackStatus, (), (override, const));
+    MOCK_METHOD(unsigned int, DescribeFeatureStacks, (const std::unordered_set<std::string>&, (std::unordered_map<std::string, Aws::CloudFormation::Model::Stack>&)), (override, const));
+    MOCK_METHOD(std::string, GetStackStatusFromDescription, (const Aws::CloudFormation::Model::Stack*), (override, const));
     MOCK_METHOD(void, UpdateDashboardDeployStatus, (std::unordered_set<FeatureType>), (override, const));
 
     MOCK_METHOD(unsigned int, CreateOrUpdateFeatureStack, (), (override));
@@ -14,6 +14,8 @@ namespace GameKit
         public:
             MockSSMClient() {}
             ~MockSSMClient() {}
+            MOCK_METHOD(Aws::SSM::Model::GetParameterOutcome, GetParameter, (const Aws::SSM::Model::GetParameterRequest& request), (const, override));
+            MOCK_METHOD(Aws::SSM::Model::GetParametersOutcome, GetParameters, (const Aws::SSM::Model::GetParametersRequest& request), (const, override));
             MOCK_METHOD(Aws::SSM::Model::PutParameterOutcome, PutParameter, (const Aws::SSM::Model::PutParameterRequest& request), (const, override));
         };
     }
@@ -0,0 +1,182 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <climits>
+#include <cstring>
+#include <thread>
+
+#include "request_metrics_tests.h"
+
+using namespace GameKit::Tests::Metrics;
+using GameKit::Utils::RequestMetrics;
+using namespace ::testing;
+
+namespace
+{
+    GameKit::RequestMetricsSnapshot findSnapshot(const std::vector<GameKit::RequestMetricsSnapshot>& snapshots, const char* endpoint)
+    {
+        for (const GameKit::RequestMetricsSnapshot& snapshot : snapshots)
+        {
+            if (strcmp(snapshot.endpoint, endpoint) == 0)
+            {
+                return snapshot;
+            }
+        }
+
+        return GameKit::RequestMetricsSnapshot();
+    }
+}
+
+void GameKitRequestMetricsTestFixture::SetUp()
+{
+    // Endpoints are shared by the whole process, start every test from empty counters
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, true);
+}
+
+void GameKitRequestMetricsTestFixture::TearDown()
+{
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, SameName_GetEndpoint_SameEndpointReturned)
+{
+    // act
+    RequestMetrics::Endpoint& first = RequestMetrics::GetEndpoint("Tests.SameName");
+    RequestMetrics::Endpoint& second = RequestMetrics::GetEndpoint(std::string("Tests.") + "SameName");
+
+    // assert
+    EXPECT_EQ(&first, &second);
+    EXPECT_NE(&first, &RequestMetrics::GetEndpoint("Tests.OtherName"));
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, LatencyBuckets_ValuesWithinBucketBounds)
+{
+    unsigned int previousIndex = 0;
+    for (unsigned long long value : { 0ULL, 1ULL, 7ULL, 8ULL, 9ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456ULL, 60000000ULL })
+    {
+        // act
+        const unsigned int index = RequestMetrics::Endpoint::GetLatencyBucketIndex(value);
+
+        // assert
+        const unsigned long long upperBound = RequestMetrics::Endpoint::GetLatencyBucketUpperBound(index);
+        const unsigned long long lowerBound = index == 0 ? 0 : RequestMetrics::Endpoint::GetLatencyBucketUpperBound(index - 1) + 1;
+        EXPECT_GE(index, previousIndex);
+        EXPECT_LE(lowerBound, value);
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - lowerBound, value / 8);
+        previousIndex = index;
+    }
+
+    EXPECT_EQ(RequestMetrics::Endpoint::GetLatencyBucketIndex(ULLONG_MAX), RequestMetrics::Endpoint::LATENCY_BUCKET_COUNT - 1);
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, RecordedRequests_Snapshot_CountsAndPercentilesReturned)
+{
+    // arrange
+    RequestMetrics::Endpoint& endpoint = RequestMetrics::GetEndpoint("Tests.Percentiles");
+    for (int i = 1; i <= 100; ++i)
+    {
+        const Aws::Http::HttpResponseCode code = i % 10 == 0 ? Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR : Aws::Http::HttpResponseCode::OK;
+        endpoint.RecordRequest(std::chrono::milliseconds(i), code, 10, 100);
+    }
+    endpoint.RecordRetry();
+    endpoint.RecordDrop();
+    endpoint.RecordCacheHit();
+    endpoint.RecordCacheHit();
+    endpoint.RecordCacheMiss();
+    endpoint.AddQueueDepth(4);
+
+    // act
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, false);
+
+    // assert
+    const GameKit::RequestMetricsSnapshot snapshot = findSnapshot(snapshots, "Tests.Percentiles");
+    EXPECT_EQ(snapshot.requestCount, 100);
+    EXPECT_EQ(snapshot.failedRequestCount, 10);
+    EXPECT_EQ(snapshot.retryCount, 1);
+    EXPECT_EQ(snapshot.droppedCount, 1);
+    EXPECT_EQ(snapshot.queueDepth, 4);
+    EXPECT_EQ(snapshot.bytesSent, 1000);
+    EXPECT_EQ(snapshot.bytesReceived, 10000);
+    EXPECT_EQ(snapshot.cacheHitCount, 2);
+    EXPECT_EQ(snapshot.cacheMissCount, 1);
+    EXPECT_EQ(snapshot.latencyMeanMicroseconds, 50500);
+    EXPECT_EQ(snapshot.latencyMaxMicroseconds, 100000);
+    EXPECT_NEAR(snapshot.latencyP50Microseconds, 50000, 50000 / 8);
+    EXPECT_NEAR(snapshot.latencyP90Microseconds, 90000, 90000 / 8);
+    EXPECT_NEAR(snapshot.latencyP99Microseconds, 99000, 99000 / 8);
+    EXPECT_LE(snapshot.latencyP99Microseconds, snapshot.latencyMaxMicroseconds);
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, ResetSnapshot_NextSnapshot_OnlyNewRequestsReturned)
+{
+    // arrange
+    RequestMetrics::Endpoint& endpoint = RequestMetrics::GetEndpoint("Tests.Reset");
+    endpoint.RecordRequest(std::chrono::milliseconds(5), Aws::Http::HttpResponseCode::OK, 0, 0);
+    endpoint.AddQueueDepth(2);
+
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, true);
+    EXPECT_EQ(findSnapshot(snapshots, "Tests.Reset").requestCount, 1);
+
+    // act
+    endpoint.RecordRequest(std::chrono::milliseconds(1), Aws::Http::HttpResponseCode::OK, 0, 0);
+    RequestMetrics::Snapshot(snapshots, true);
+
+    // assert
+    const GameKit::RequestMetricsSnapshot snapshot = findSnapshot(snapshots, "Tests.Reset");
+    EXPECT_EQ(snapshot.requestCount, 1);
+    EXPECT_EQ(snapshot.latencyMaxMicroseconds, 1000);
+    EXPECT_EQ(snapshot.queueDepth, 2);
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, QueueDepthsOfClientsSharingName_Snapshot_DepthsSummed)
+{
+    // arrange, two clients of the same name report their queues
+    RequestMetrics::Endpoint& endpoint = RequestMetrics::GetEndpoint("Tests.QueueDepth");
+    endpoint.AddQueueDepth(3);
+    endpoint.AddQueueDepth(2);
+
+    // act, the first client's queue drains
+    endpoint.AddQueueDepth(-3);
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, false);
+
+    // assert
+    EXPECT_EQ(findSnapshot(snapshots, "Tests.QueueDepth").queueDepth, 2);
+}
+
+TEST_F(GameKitRequestMetricsTestFixture, ConcurrentRecording_Snapshot_NoRequestLost)
+{
+    // arrange
+    const int threadCount = 4;
+    const int requestsPerThread = 10000;
+    std::vector<std::thread> threads;
+
+    // act
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([=]()
+        {
+            for (int request = 0; request < requestsPerThread; ++request)
+            {
+                RequestMetrics::GetEndpoint("Tests.Concurrent").RecordRequest(std::chrono::microseconds(request), Aws::Http::HttpResponseCode::OK, 1, 1);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // assert
+    std::vector<GameKit::RequestMetricsSnapshot> snapshots;
+    RequestMetrics::Snapshot(snapshots, false);
+    const GameKit::RequestMetricsSnapshot snapshot = findSnapshot(snapshots, "Tests.Concurrent");
+    EXPECT_EQ(snapshot.requestCount, threadCount * requestsPerThread);
+    EXPECT_EQ(snapshot.bytesSent, threadCount * requestsPerThread);
+    EXPECT_EQ(snapshot.latencyMaxMicroseconds, requestsPerThread - 1);
+}
@@ -0,0 +1,31 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GTest
+#include <gtest/gtest.h>
+
+// GameKit
+#include <aws/gamekit/core/utils/request_metrics.h>
+
+#include "test_common.h"
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace Metrics
+        {
+            class GameKitRequestMetricsTestFixture : public ::testing::Test
+            {
+            public:
+                GameKitRequestMetricsTestFixture() {}
+                ~GameKitRequestMetricsTestFixture() {}
+
+                void SetUp() override;
+                void TearDown() override;
+            };
+        }
+    }
+}
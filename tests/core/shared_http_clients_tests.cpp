@@ -0,0 +1,128 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "shared_http_clients_tests.h"
+
+using namespace GameKit::Tests::SharedClients;
+using GameKit::SharedHttpClients;
+using namespace ::testing;
+
+void GameKitSharedHttpClientsTestFixture::SetUp()
+{
+    SharedHttpClients::Clear();
+
+    factory = std::make_shared<CountingHttpClientFactory>();
+    Aws::Http::SetHttpClientFactory(factory);
+    Aws::Http::InitHttp();
+}
+
+void GameKitSharedHttpClientsTestFixture::TearDown()
+{
+    SharedHttpClients::Clear();
+    Aws::Http::CleanupHttp();
+    factory.reset();
+
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitSharedHttpClientsTestFixture, SameTransportSettings_Get_SameClientReturned)
+{
+    // arrange
+    Aws::Client::ClientConfiguration first;
+    first.region = "us-west-2";
+    first.connectTimeoutMs = 5000;
+    Aws::Client::ClientConfiguration second;
+    second.region = "us-east-1";
+    second.connectTimeoutMs = 5000;
+
+    // act
+    const auto firstClient = SharedHttpClients::Get(first);
+    const auto secondClient = SharedHttpClients::Get(second);
+
+    // assert
+    ASSERT_NE(nullptr, firstClient);
+    EXPECT_EQ(firstClient, secondClient);
+    EXPECT_EQ(1, factory->CreatedClients);
+    EXPECT_EQ(1, SharedHttpClients::GetClientCount());
+}
+
+TEST_F(GameKitSharedHttpClientsTestFixture, DifferentTransportSettings_Get_DifferentClientsReturned)
+{
+    // arrange
+    Aws::Client::ClientConfiguration first;
+    first.connectTimeoutMs = 5000;
+    Aws::Client::ClientConfiguration second;
+    second.connectTimeoutMs = 7000;
+    Aws::Client::ClientConfiguration third;
+    third.connectTimeoutMs = 5000;
+    third.version = Aws::Http::Version::HTTP_VERSION_1_1;
+
+    // act
+    const auto firstClient = SharedHttpClients::Get(first);
+    const auto secondClient = SharedHttpClients::Get(second);
+    const auto thirdClient = SharedHttpClients::Get(third);
+
+    // assert
+    EXPECT_NE(firstClient, secondClient);
+    EXPECT_NE(firstClient, thirdClient);
+    EXPECT_EQ(3, factory->CreatedClients);
+    EXPECT_EQ(3, SharedHttpClients::GetClientCount());
+}
+
+TEST_F(GameKitSharedHttpClientsTestFixture, Clear_Get_NewClientCreatedAndHeldClientKept)
+{
+    // arrange
+    Aws::Client::ClientConfiguration clientConfig;
+    const auto heldClient = SharedHttpClients::Get(clientConfig);
+    const std::weak_ptr<Aws::Http::HttpClient> weakClient = heldClient;
+
+    // act
+    SharedHttpClients::Clear();
+    const auto newClient = SharedHttpClients::Get(clientConfig);
+
+    // assert
+    EXPECT_FALSE(weakClient.expired());
+    EXPECT_NE(heldClient, newClient);
+    EXPECT_EQ(2, factory->CreatedClients);
+    EXPECT_EQ(1, SharedHttpClients::GetClientCount());
+}
+
+TEST_F(GameKitSharedHttpClientsTestFixture, ProxyCredentials_GetConfigurationKey_KeyedByDigestOnly)
+{
+    // arrange
+    Aws::Client::ClientConfiguration first;
+    first.proxyUserName = "proxy-user";
+    first.proxyPassword = "proxy-secret";
+    Aws::Client::ClientConfiguration second;
+    second.proxyUserName = "proxy-user";
+    second.proxyPassword = "other-secret";
+
+    // act
+    const std::string firstKey = SharedHttpClients::GetConfigurationKey(first);
+    const std::string secondKey = SharedHttpClients::GetConfigurationKey(second);
+
+    // assert
+    EXPECT_EQ(std::string::npos, firstKey.find("proxy-user"));
+    EXPECT_EQ(std::string::npos, firstKey.find("proxy-secret"));
+    EXPECT_NE(firstKey, secondKey);
+}
+
+TEST_F(GameKitSharedHttpClientsTestFixture, DifferentProxyCa_GetConfigurationKey_DifferentKeys)
+{
+    // arrange
+    Aws::Client::ClientConfiguration base;
+    Aws::Client::ClientConfiguration otherCaFile;
+    otherCaFile.proxyCaFile = "proxy-ca.pem";
+    Aws::Client::ClientConfiguration otherCaPath;
+    otherCaPath.proxyCaPath = "proxy-certs";
+
+    // act
+    const std::string baseKey = SharedHttpClients::GetConfigurationKey(base);
+    const std::string caFileKey = SharedHttpClients::GetConfigurationKey(otherCaFile);
+    const std::string caPathKey = SharedHttpClients::GetConfigurationKey(otherCaPath);
+
+    // assert
+    EXPECT_NE(baseKey, caFileKey);
+    EXPECT_NE(baseKey, caPathKey);
+    EXPECT_NE(caFileKey, caPathKey);
+}
@@ -0,0 +1,50 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GTest
+#include <gtest/gtest.h>
+
+// GameKit
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
+
+#include "test_common.h"
+#include "mocks/fake_http_client.h"
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace SharedClients
+        {
+            /*
+            Factory that creates a new fake client for every call and counts them
+            */
+            class CountingHttpClientFactory : public MockHttpClientFactory
+            {
+            public:
+                mutable int CreatedClients = 0;
+
+                std::shared_ptr<Aws::Http::HttpClient> CreateHttpClient(const Aws::Client::ClientConfiguration& clientConfiguration) const override
+                {
+                    ++CreatedClients;
+                    return std::make_shared<FakeHttpClient>();
+                }
+            };
+
+            class GameKitSharedHttpClientsTestFixture : public ::testing::Test
+            {
+            protected:
+                std::shared_ptr<CountingHttpClientFactory> factory;
+
+            public:
+                GameKitSharedHttpClientsTestFixture() {}
+                ~GameKitSharedHttpClientsTestFixture() {}
+
+                void SetUp() override;
+                void TearDown() override;
+            };
+        }
+    }
+}
@@ -0,0 +1,196 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// GameKit
+#include <aws/gamekit/core/internal/platform_string.h>
+
+#include "stack_watcher_tests.h"
+
+using namespace GameKit::Tests::StackWatcher;
+using namespace ::testing;
+
+namespace CfnModel = Aws::CloudFormation::Model;
+
+namespace
+{
+    CfnModel::DescribeStacksOutcome describeStacksOutcome(CfnModel::StackStatus status)
+    {
+        CfnModel::Stack stack;
+        stack.SetStackStatus(status);
+        CfnModel::DescribeStacksResult result;
+        result.AddStacks(stack);
+        return CfnModel::DescribeStacksOutcome(result);
+    }
+
+    CfnModel::StackEvent stackEvent(const std::string& eventId, const std::string& logicalResourceId, CfnModel::ResourceStatus status)
+    {
+        CfnModel::StackEvent event;
+        event.SetEventId(ToAwsString(eventId));
+        event.SetLogicalResourceId(ToAwsString(logicalResourceId));
+        event.SetResourceStatus(status);
+        return event;
+    }
+
+    CfnModel::DescribeStackEventsOutcome describeStackEventsOutcome(const std::vector<CfnModel::StackEvent>& events, const std::string& nextToken)
+    {
+        CfnModel::DescribeStackEventsResult result;
+        for (const CfnModel::StackEvent& event : events)
+        {
+            result.AddStackEvents(event);
+        }
+        result.SetNextToken(ToAwsString(nextToken));
+        return CfnModel::DescribeStackEventsOutcome(result);
+    }
+}
+
+void GameKitStackWatcherTestFixture::SetUp()
+{
+    testStack.Initialize();
+}
+
+void GameKitStackWatcherTestFixture::TearDown()
+{
+    testStack.CleanupAndLog<TestLogger>();
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitStackWatcherTestFixture, StackInProgress_Watch_PolledUntilTerminalState)
+{
+    // arrange
+    GameKit::StackWatcher watcher(std::chrono::milliseconds(10), std::chrono::milliseconds(40));
+    auto cfnMock = std::make_unique<GameKit::Mocks::MockCloudFormationClient>();
+    cfnMock->DelegateToFake();
+
+    EXPECT_CALL(*cfnMock, DescribeStacks(_))
+        .Times(3)
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_IN_PROGRESS)))
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_IN_PROGRESS)))
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_COMPLETE)));
+    EXPECT_CALL(*cfnMock, DescribeStackEvents(_))
+        .Times(3);
+
+    // act
+    const CfnModel::StackStatus status = watcher.Watch(cfnMock.get(), "gamekit-dev-testgame-identity", TestLogger::Log, this).get();
+
+    // assert
+    ASSERT_EQ(CfnModel::StackStatus::UPDATE_COMPLETE, status);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+}
+
+TEST_F(GameKitStackWatcherTestFixture, StackDeleted_Watch_LastStatusReturned)
+{
+    // arrange
+    GameKit::StackWatcher watcher(std::chrono::milliseconds(10), std::chrono::milliseconds(40));
+    auto cfnMock = std::make_unique<GameKit::Mocks::MockCloudFormationClient>();
+    cfnMock->DelegateToFake();
+
+    // Deleted stacks can't be described by name, the default outcome is a non-retryable error
+    EXPECT_CALL(*cfnMock, DescribeStacks(_))
+        .Times(2)
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::DELETE_IN_PROGRESS)))
+        .WillOnce(Return(CfnModel::DescribeStacksOutcome()));
+
+    // act
+    const CfnModel::StackStatus status = watcher.Watch(cfnMock.get(), "gamekit-dev-testgame-identity", TestLogger::Log, this).get();
+
+    // assert
+    ASSERT_EQ(CfnModel::StackStatus::DELETE_IN_PROGRESS, status);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+}
+
+TEST_F(GameKitStackWatcherTestFixture, PagedStackEvents_Watch_EveryNewEventLoggedOnceInOrder)
+{
+    // arrange
+    GameKit::StackWatcher watcher(std::chrono::milliseconds(10), std::chrono::milliseconds(40));
+    auto cfnMock = std::make_unique<GameKit::Mocks::MockCloudFormationClient>();
+    const std::string stackName = "gamekit-dev-testgame-identity";
+
+    CfnModel::StackEvent operationStart = stackEvent("1", stackName, CfnModel::ResourceStatus::UPDATE_IN_PROGRESS);
+    operationStart.SetResourceType("AWS::CloudFormation::Stack");
+    operationStart.SetResourceStatusReason("User Initiated");
+    const CfnModel::StackEvent previousOperation = stackEvent("0", "ResourceFromPreviousUpdate", CfnModel::ResourceStatus::CREATE_COMPLETE);
+    const CfnModel::StackEvent resourceInProgress = stackEvent("2", "ResourceA", CfnModel::ResourceStatus::UPDATE_IN_PROGRESS);
+    const CfnModel::StackEvent resourceComplete = stackEvent("3", "ResourceB", CfnModel::ResourceStatus::UPDATE_COMPLETE);
+    const CfnModel::StackEvent stackComplete = stackEvent("4", stackName, CfnModel::ResourceStatus::UPDATE_COMPLETE);
+
+    EXPECT_CALL(*cfnMock, DescribeStacks(_))
+        .Times(2)
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_IN_PROGRESS)))
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_COMPLETE)));
+
+    // First poll: two pages ending with the event that started the operation. Second poll: new events on the first page only.
+    EXPECT_CALL(*cfnMock, DescribeStackEvents(_))
+        .Times(3)
+        .WillOnce([&](const CfnModel::DescribeStackEventsRequest&) { return describeStackEventsOutcome({ resourceInProgress }, "page2"); })
+        .WillOnce([&](const CfnModel::DescribeStackEventsRequest&) { return describeStackEventsOutcome({ operationStart, previousOperation }, ""); })
+        .WillOnce([&](const CfnModel::DescribeStackEventsRequest&) { return describeStackEventsOutcome({ stackComplete, resourceComplete, resourceInProgress }, "page2"); });
+
+    // act
+    const CfnModel::StackStatus status = watcher.Watch(cfnMock.get(), stackName, TestLogger::Log, this).get();
+
+    // assert
+    ASSERT_EQ(CfnModel::StackStatus::UPDATE_COMPLETE, status);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+
+    std::vector<std::string> loggedResources;
+    for (const std::string& line : TestLogger::GetLogLines())
+    {
+        const size_t resourceStart = line.find(stackName + ": ");
+        if (resourceStart != std::string::npos)
+        {
+            const size_t idStart = resourceStart + stackName.size() + 2;
+            loggedResources.push_back(line.substr(idStart, line.find(" | ", idStart) - idStart));
+        }
+    }
+
+    const std::vector<std::string> expectedResources = { stackName, "ResourceA", "ResourceB", stackName };
+    ASSERT_EQ(expectedResources, loggedResources);
+}
+
+TEST_F(GameKitStackWatcherTestFixture, DescribeStacksAlwaysThrottled_Watch_ReportedAsFailed)
+{
+    // arrange
+    GameKit::StackWatcher watcher(std::chrono::milliseconds(10), std::chrono::milliseconds(40));
+    auto cfnMock = std::make_unique<GameKit::Mocks::MockCloudFormationClient>();
+    cfnMock->DelegateToFake();
+
+    const CfnModel::DescribeStacksOutcome throttled(Aws::Client::AWSError<Aws::CloudFormation::CloudFormationErrors>(Aws::CloudFormation::CloudFormationErrors::THROTTLING, true));
+
+    // The stack is seen updating once, then every call is throttled until the watcher gives up
+    EXPECT_CALL(*cfnMock, DescribeStacks(_))
+        .Times(21)
+        .WillOnce(Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_IN_PROGRESS)))
+        .WillRepeatedly(Return(throttled));
+
+    // act
+    std::shared_future<CfnModel::StackStatus> status = watcher.Watch(cfnMock.get(), "gamekit-dev-testgame-identity", TestLogger::Log, this);
+
+    // assert
+    ASSERT_EQ(std::future_status::ready, status.wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(CfnModel::StackStatus::UPDATE_ROLLBACK_FAILED, status.get());
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+}
+
+TEST_F(GameKitStackWatcherTestFixture, StackInProgress_Shutdown_PollerStoppedAndLastStatusReturned)
+{
+    // arrange, the next poll is far enough away to only happen if the watcher keeps running
+    GameKit::StackWatcher watcher(std::chrono::seconds(60), std::chrono::seconds(60));
+    auto cfnMock = std::make_unique<GameKit::Mocks::MockCloudFormationClient>();
+    cfnMock->DelegateToFake();
+
+    std::promise<void> polled;
+    EXPECT_CALL(*cfnMock, DescribeStacks(_))
+        .Times(1)
+        .WillOnce(DoAll(InvokeWithoutArgs([&]() { polled.set_value(); }), Return(describeStacksOutcome(CfnModel::StackStatus::UPDATE_IN_PROGRESS))));
+
+    std::shared_future<CfnModel::StackStatus> status = watcher.Watch(cfnMock.get(), "gamekit-dev-testgame-identity", TestLogger::Log, this);
+    polled.get_future().wait();
+
+    // act
+    watcher.Shutdown();
+
+    // assert
+    ASSERT_EQ(std::future_status::ready, status.wait_for(std::chrono::seconds(0)));
+    ASSERT_EQ(CfnModel::StackStatus::UPDATE_IN_PROGRESS, status.get());
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(cfnMock.get()));
+}
@@ -0,0 +1,37 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GTest
+#include <gtest/gtest.h>
+
+// GameKit
+#include <aws/gamekit/core/stack_watcher.h>
+
+#include "test_common.h"
+#include "test_log.h"
+#include "test_stack.h"
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace StackWatcher
+        {
+            class GameKitStackWatcherTestFixture : public ::testing::Test
+            {
+            protected:
+                TestStackInitializer testStack;
+                typedef TestLog<GameKitStackWatcherTestFixture> TestLogger;
+
+            public:
+                GameKitStackWatcherTestFixture() {}
+                ~GameKitStackWatcherTestFixture() {}
+
+                void SetUp() override;
+                void TearDown() override;
+            };
+        }
+    }
+}
@@ -6,6 +6,7 @@
 // GameKit
 #include "test_stack.h"
 #include <aws/gamekit/core/awsclients/api_initializer.h>
+#include <aws/gamekit/core/awsclients/shared_http_clients.h>
 
 // AWS C++ SDK
 #include <aws/core/http/HttpClientFactory.h>
@@ -42,6 +43,8 @@ void TestStackInitializer::Initialize(std::shared_ptr<Aws::Http::HttpClient> moc
 
 void TestStackInitializer::Cleanup()
 {
+    // Shared clients come from this test's factory, don't hand them to the next test
+    GameKit::SharedHttpClients::Clear();
     Aws::Http::CleanupHttp();
     Aws::Utils::Crypto::CleanupCrypto();
     testFakeClient.reset();
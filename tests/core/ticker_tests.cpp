@@ -75,4 +75,20 @@ void GameKitUtilsTickerTestFixture::Test_Ticker_StartCalledTwice_NewThreadNotSta
     // assert
     ASSERT_EQ(5, GetCallbacks1().size());
 }
+
+void GameKitUtilsTickerTestFixture::Test_Ticker_RescheduleNextTick_TicksAfterDelay()
+{
+    // arrange
+    std::unique_ptr<GameKit::Utils::Ticker> t = CreateTicker(1, std::bind(&GameKitUtilsTickerTestFixture::MockTickCallbackRescheduleNextTick, this), TestLogger::Log);
+    m_ticker = t.get();
+
+    // act
+    // the first tick happens after 1 second and schedules the second one 100 milliseconds later, the third one is a full interval later
+    t->Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1600));
+    t->Stop();
+
+    // assert
+    ASSERT_EQ(2, GetCallbacks1().size());
+}
 #pragma endregion
@@ -51,6 +51,7 @@ namespace GameKit
                 void Test_Ticker_Abort_Success();
                 void Test_SharedTicker_ThreadStopsAfterTickerDestroyed();
                 void Test_Ticker_StartCalledTwice_NewThreadNotStarted();
+                void Test_Ticker_RescheduleNextTick_TicksAfterDelay();
 #pragma  endregion
 
             public:
@@ -90,6 +91,15 @@ namespace GameKit
                     m_ticker->AbortLoop();
                 }
 
+                void MockTickCallbackRescheduleNextTick()
+                {
+                    callBacks1.push_back(true);
+                    if (callBacks1.size() == 1)
+                    {
+                        m_ticker->RescheduleNextTick(std::chrono::milliseconds(100));
+                    }
+                }
+
                 std::vector<bool> GetCallbacks1() const
                 {
                     return callBacks1;
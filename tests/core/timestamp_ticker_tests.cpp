@@ -4,11 +4,35 @@
 // GameKit
 #include "timestamp_ticker_tests.h"
 
+// Standard Library
+#include <atomic>
+#include <thread>
+
 // GTest
 #include <gtest/gtest.h>
 
 using namespace GameKit::Tests::Utils;
 
+namespace
+{
+    // Polls the condition, the timeout only guards against a hung ticker thread
+    bool waitUntil(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+}
+
 TEST_F(GameKitUtilsSystemClockTickerTestFixture, Ticker_Executecallback_Success)
 {
     Test_Ticker_ExecuteCallback_Success();
@@ -27,4 +51,65 @@ TEST_F(GameKitUtilsSystemClockTickerTestFixture, SharedTicker_ThreadStopsAfterTi
 TEST_F(GameKitUtilsSystemClockTickerTestFixture, Ticker_StartCalledTwice_NewThreadNotStarted)
 {
     Test_Ticker_StartCalledTwice_NewThreadNotStarted();
-}
\ No newline at end of file
+}
+
+TEST_F(GameKitUtilsSystemClockTickerTestFixture, Ticker_RescheduleNextTick_TicksAfterDelay)
+{
+    // arrange, the ticker's clock only moves when the test advances it
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::atomic<long long> elapsedMilliseconds(0);
+    std::atomic<int> clockReads(0);
+    std::atomic<int> clockReadsAtLastTick(0);
+    std::atomic<int> tickCount(0);
+    std::unique_ptr<GameKit::Utils::TimestampTicker> ticker;
+    ticker = std::make_unique<GameKit::Utils::TimestampTicker>(1, [&]()
+    {
+        // the first tick schedules the second one 100 milliseconds later, the third one is a full interval later
+        if (tickCount == 0)
+        {
+            ticker->RescheduleNextTick(std::chrono::milliseconds(100));
+        }
+        clockReadsAtLastTick = clockReads.load();
+        ++tickCount;
+    },
+    TestLogger::Log, [&]()
+    {
+        ++clockReads;
+        return start + std::chrono::milliseconds(elapsedMilliseconds.load());
+    });
+
+    // the ticker thread has seen the current time once it read the clock twice more, a full loop checks whether the interval is over
+    const auto advanceClockTo = [&](long long milliseconds)
+    {
+        elapsedMilliseconds = milliseconds;
+        const int reads = clockReads.load();
+        return waitUntil([&]() { return clockReads.load() >= reads + 2; });
+    };
+
+    // the next interval starts with the first clock read after a tick
+    const auto waitForTick = [&](int count)
+    {
+        return waitUntil([&]() { return tickCount.load() == count && clockReads.load() > clockReadsAtLastTick.load(); });
+    };
+
+    // act / assert
+    ticker->Start();
+    ASSERT_TRUE(waitUntil([&]() { return clockReads.load() > 0; }));
+
+    ASSERT_TRUE(advanceClockTo(999));
+    ASSERT_EQ(0, tickCount.load());
+    elapsedMilliseconds = 1000;
+    ASSERT_TRUE(waitForTick(1));
+
+    ASSERT_TRUE(advanceClockTo(1099));
+    ASSERT_EQ(1, tickCount.load());
+    elapsedMilliseconds = 1100;
+    ASSERT_TRUE(waitForTick(2));
+
+    ASSERT_TRUE(advanceClockTo(2099));
+    ASSERT_EQ(2, tickCount.load());
+    elapsedMilliseconds = 2100;
+    ASSERT_TRUE(waitForTick(3));
+
+    ticker->Stop();
+}
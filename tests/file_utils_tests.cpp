@@ -11,6 +11,8 @@
 
 #include <boost/filesystem.hpp>
 
+#include <ctime>
+
 using namespace GameKit;
 namespace fs = boost::filesystem;
 
@@ -75,6 +77,81 @@ TEST_F(GameKitUtilsFileTestFixture, DirectoryExists_HashDirectory_StringIsCorrec
     remove(filePath);
 }
 
+TEST_F(GameKitUtilsFileTestFixture, FileWithUtf8Signature_HashDirectory_SignatureIgnored)
+{
+    // arrange
+    const char* directoryPath = "../core/test_data/testFiles/fileUtilTests/HashDirTest";
+    const char* filePath = "../core/test_data/testFiles/fileUtilTests/HashDirTest/TestNewFileForHashOne.txt";
+    GameKit::Utils::FileUtils::WriteStringToFile("\xEF\xBB\xBFtest", filePath);
+
+    // act
+    std::string hashString;
+    const auto calculateHashStatus = GameKit::Utils::FileUtils::CalculateDirectoryHash(directoryPath, hashString);
+
+    // assert, same hash as a file containing "test"
+    ASSERT_EQ(calculateHashStatus, GAMEKIT_SUCCESS);
+    ASSERT_EQ(hashString, "PB0KWVxeuirXQRhJnxwt+q0sYoch1hh/EzffJJawE/M=");
+
+    // cleanup
+    remove(filePath);
+}
+
+TEST_F(GameKitUtilsFileTestFixture, FileUnchangedSinceLastHash_HashDirectory_CachedFileDigestUsed)
+{
+    // arrange
+    const char* directoryPath = "../core/test_data/testFiles/fileUtilTests/HashDirTest";
+    const char* filePath = "../core/test_data/testFiles/fileUtilTests/HashDirTest/TestNewFileForHashOne.txt";
+    const std::time_t lastWriteTime = std::time(nullptr) - 3600;
+    GameKit::Utils::FileUtils::WriteStringToFile("test", filePath);
+    fs::last_write_time(filePath, lastWriteTime);
+
+    std::string hashStringOne;
+    auto calculateHashStatus = GameKit::Utils::FileUtils::CalculateDirectoryHash(directoryPath, hashStringOne);
+    ASSERT_EQ(calculateHashStatus, GAMEKIT_SUCCESS);
+    ASSERT_EQ(hashStringOne, "PB0KWVxeuirXQRhJnxwt+q0sYoch1hh/EzffJJawE/M=");
+
+    // change the contents without changing the size or last write time, so the file looks unchanged
+    GameKit::Utils::FileUtils::WriteStringToFile("tset", filePath);
+    fs::last_write_time(filePath, lastWriteTime);
+
+    // act
+    std::string hashStringTwo;
+    calculateHashStatus = GameKit::Utils::FileUtils::CalculateDirectoryHash(directoryPath, hashStringTwo);
+
+    // assert, the file was not read again
+    ASSERT_EQ(calculateHashStatus, GAMEKIT_SUCCESS);
+    ASSERT_EQ(hashStringTwo, hashStringOne);
+
+    // cleanup
+    remove(filePath);
+}
+
+TEST_F(GameKitUtilsFileTestFixture, FileRecentlyRewrittenWithSameSize_HashDirectory_HashChanges)
+{
+    // arrange
+    const char* directoryPath = "../core/test_data/testFiles/fileUtilTests/HashDirTest";
+    const char* filePath = "../core/test_data/testFiles/fileUtilTests/HashDirTest/TestNewFileForHashOne.txt";
+    GameKit::Utils::FileUtils::WriteStringToFile("test", filePath);
+
+    std::string hashStringOne;
+    auto calculateHashStatus = GameKit::Utils::FileUtils::CalculateDirectoryHash(directoryPath, hashStringOne);
+    ASSERT_EQ(calculateHashStatus, GAMEKIT_SUCCESS);
+
+    // rewrite with the same size, likely within the same second
+    GameKit::Utils::FileUtils::WriteStringToFile("tset", filePath);
+
+    // act
+    std::string hashStringTwo;
+    calculateHashStatus = GameKit::Utils::FileUtils::CalculateDirectoryHash(directoryPath, hashStringTwo);
+
+    // assert
+    ASSERT_EQ(calculateHashStatus, GAMEKIT_SUCCESS);
+    ASSERT_NE(hashStringTwo, hashStringOne);
+
+    // cleanup
+    remove(filePath);
+}
+
 TEST_F(GameKitUtilsFileTestFixture, DirectoryDoesNotExist_HashDirectory_ReturnError)
 {
     // arrange
@@ -988,6 +988,85 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_succes
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_uploaded_body_and_hash)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    // same bytes as the download response, so the expected SHA-256 is known
+    std::string testBuffer = TEST_SLOT_DOWNLOAD_RESPONSE;
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_PUT_URL);
+
+    std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
+    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+
+    Aws::String urlRequestHash;
+    Aws::String uploadHash;
+    Aws::String uploadContentLength;
+    std::string uploadBody;
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(testResponse))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& sentRequest, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                urlRequestHash = sentRequest->GetHeaderValue("hash");
+            }), Return(testResponse2)))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& sentRequest, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                // the body streams the caller's buffer, read it while the upload is in flight
+                uploadHash = sentRequest->GetHeaderValue(TEST_SHA_256_METADATA_HEADER);
+                uploadContentLength = sentRequest->GetContentLength();
+                std::ostringstream body;
+                body << sentRequest->GetContentBody()->rdbuf();
+                uploadBody = body.str();
+            }), Return(testResponse3)));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_SHA_256, urlRequestHash);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_SHA_256, uploadHash);
+    ASSERT_EQ(std::to_string(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE), uploadContentLength.c_str());
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE, uploadBody);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
 TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upload_failed)
 {
     // arrange
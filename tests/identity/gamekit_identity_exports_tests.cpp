@@ -1,6 +1,8 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <future>
 #include <iostream>
 
 #include <gmock/gmock.h>
@@ -32,6 +34,34 @@ void responseCallback(DISPATCH_RECEIVER_HANDLE receiver, const GameKit::GetUserR
     ((GameKit::Tests::IdentityExports::Dispatcher*) receiver)->CallbackHandler(responsePayload);
 }
 
+void federatedLoginResultCallback(DISPATCH_RECEIVER_HANDLE receiver, unsigned int result)
+{
+    ((std::promise<unsigned int>*) receiver)->set_value(result);
+}
+
+// Result callback cancelling the login from the login thread. The first call waits, so a new login can be started while it runs.
+struct CancellingFederatedLoginContext
+{
+    GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance;
+    std::atomic<int> calls{ 0 };
+    std::promise<void> firstCallbackEntered;
+    std::promise<unsigned int> results[2];
+};
+
+void cancellingFederatedLoginResultCallback(DISPATCH_RECEIVER_HANDLE receiver, unsigned int result)
+{
+    CancellingFederatedLoginContext* context = (CancellingFederatedLoginContext*) receiver;
+    const int call = context->calls++;
+    if (call == 0)
+    {
+        context->firstCallbackEntered.set_value();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    GameKitCancelFederatedLogin(context->identityInstance);
+    context->results[call].set_value(result);
+}
+
 void GameKit::Tests::IdentityExports::Dispatcher::CallbackHandler(const GameKit::GetUserResponse* res)
 {
     this->email = res->email;
@@ -584,6 +614,56 @@ TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityGetUser_Success)
     GameKitIdentityInstanceRelease(instance);
 }
 
+TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityGetUser_CalledTwice_ProfileCachedUntilTokensChange)
+{
+    // arrange
+    void* instance = createIdentityInstance();
+    setIdentityMocks(instance);
+    auto identityInstance = static_cast<GameKit::Identity::Identity*>(instance);
+
+    std::shared_ptr<FakeHttpResponse> response = std::make_shared<FakeHttpResponse>();
+    response->SetResponseCode(Aws::Http::HttpResponseCode(200));
+    response->SetResponseBody(GetIdentityLambdaGetUserApiResponse());
+
+    std::shared_ptr<FakeHttpResponse> refreshedResponse = std::make_shared<FakeHttpResponse>();
+    refreshedResponse->SetResponseCode(Aws::Http::HttpResponseCode(200));
+    refreshedResponse->SetResponseBody(GetIdentityLambdaGetUserApiResponse());
+
+    std::string cognitoResponseJson = GetCognitoGetUserApiResponse();
+    const Aws::String input(cognitoResponseJson.c_str(), cognitoResponseJson.size());
+    const Aws::Utils::Json::JsonValue cognitoGetUserJsonValue(input);
+    const Aws::Http::HeaderValueCollection headers;
+    Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue> awsResult(cognitoGetUserJsonValue, headers);
+
+    GetUserResult userResult(awsResult);
+    GetUserOutcome outcome = GetUserOutcome(userResult);
+
+    EXPECT_CALL(*this->mockHttpClient.get(), MakeRequest(_, _, _)).WillOnce(Return(response)).WillOnce(Return(refreshedResponse));
+    EXPECT_CALL(*this->cognitoMock.get(), GetUser(_)).Times(2).WillRepeatedly(Return(outcome));
+
+    // act
+    GameKit::Tests::IdentityExports::Dispatcher dispatcher = GameKit::Tests::IdentityExports::Dispatcher();
+    int firstResult = GameKitIdentityGetUser(instance, dispatcher.get(), responseCallback);
+
+    GameKit::Tests::IdentityExports::Dispatcher cachedDispatcher = GameKit::Tests::IdentityExports::Dispatcher();
+    int cachedResult = GameKitIdentityGetUser(instance, cachedDispatcher.get(), responseCallback);
+
+    identityInstance->GetSessionManager()->SetToken(GameKit::TokenType::IdToken, "refreshed_token");
+    int refreshedResult = GameKitIdentityGetUser(instance, dispatcher.get(), responseCallback);
+
+    // assert
+    ASSERT_EQ(firstResult, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(cachedResult, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(refreshedResult, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_STREQ(cachedDispatcher.email.c_str(), "playerone@test.com");
+    ASSERT_STREQ(cachedDispatcher.userName.c_str(), "playerone");
+    ASSERT_STREQ(cachedDispatcher.userId.c_str(), "4f1de70d-c130-444d-af78-000000");
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->mockHttpClient.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->cognitoMock.get()));
+    GameKitIdentityInstanceRelease(instance);
+}
+
 TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityGetUser_API_Fail)
 {
     // arrange
@@ -850,3 +930,111 @@ TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityGetFbPollAndRetrive
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->mockHttpClient.get()));
     GameKitIdentityInstanceRelease(identityInstance);
 }
+
+TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityPollAndRetrieveFederatedTokensAsync_TokensRetrieved_Success)
+{
+    // arrange
+    void* instance = createIdentityInstanceWithNoSessionManagerTokens();
+    setIdentityMocks(instance);
+    GameKit::Identity::Identity* identityInstance = static_cast<GameKit::Identity::Identity*>(instance);
+
+    std::shared_ptr<FakeHttpResponse> notCompletedResponse = std::make_shared<FakeHttpResponse>();
+    notCompletedResponse->SetResponseCode(Aws::Http::HttpResponseCode::NOT_FOUND);
+
+    std::shared_ptr<FakeHttpResponse> pollForCompletionResponse = std::make_shared<FakeHttpResponse>();
+    pollForCompletionResponse->SetResponseCode(Aws::Http::HttpResponseCode(200));
+    pollForCompletionResponse->SetResponseBody("S3_file_location");
+
+    std::shared_ptr<FakeHttpResponse> retrieveTokensResponse = std::make_shared<FakeHttpResponse>();
+    retrieveTokensResponse->SetResponseCode(Aws::Http::HttpResponseCode(200));
+    retrieveTokensResponse->SetResponseBody("{\"access_token\":\"fb_access_token\", \"refresh_token\":\"fb_refresh_token\", \"id_token\":\"fb_id_token\",\"expires_in\":3600,\"token_type\":\"Bearer\",\"source_ip\":\"24.22.162.62\"}");
+
+    EXPECT_CALL(*this->mockHttpClient.get(), MakeRequest(_, _, _))
+        .WillOnce(Return(notCompletedResponse))
+        .WillOnce(Return(pollForCompletionResponse))
+        .WillOnce(Return(retrieveTokensResponse));
+
+    std::promise<unsigned int> loginResult;
+    std::future<unsigned int> loginResultFuture = loginResult.get_future();
+
+    // act
+    unsigned int result = GameKitPollAndRetrieveFederatedTokensAsync(identityInstance, GameKit::FederatedIdentityProvider::Facebook, "41669940-4b22-49b5-8a59-84c596455058", 60, &loginResult, federatedLoginResultCallback);
+
+    // assert
+    ASSERT_EQ(result, GameKit::GAMEKIT_SUCCESS);
+
+    // the second check is made well before the 5 seconds interval of a fixed poll
+    ASSERT_EQ(std::future_status::ready, loginResultFuture.wait_for(std::chrono::seconds(3)));
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, loginResultFuture.get());
+    ASSERT_EQ("fb_id_token", identityInstance->GetSessionManager()->GetToken(GameKit::TokenType::IdToken));
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->mockHttpClient.get()));
+    GameKitIdentityInstanceRelease(identityInstance);
+}
+
+TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityPollAndRetrieveFederatedTokensAsync_Cancelled_Fail)
+{
+    // arrange
+    void* instance = createIdentityInstanceWithNoSessionManagerTokens();
+    setIdentityMocks(instance);
+    GameKit::Identity::Identity* identityInstance = static_cast<GameKit::Identity::Identity*>(instance);
+
+    std::shared_ptr<FakeHttpResponse> response = std::make_shared<FakeHttpResponse>();
+    response->SetResponseCode(Aws::Http::HttpResponseCode::NOT_FOUND);
+
+    EXPECT_CALL(*this->mockHttpClient.get(), MakeRequest(_, _, _)).WillRepeatedly(Return(response));
+
+    std::promise<unsigned int> loginResult;
+    std::future<unsigned int> loginResultFuture = loginResult.get_future();
+
+    // act
+    unsigned int result = GameKitPollAndRetrieveFederatedTokensAsync(identityInstance, GameKit::FederatedIdentityProvider::Facebook, "41669940-4b22-49b5-8a59-84c596455058", 60, &loginResult, federatedLoginResultCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    GameKitCancelFederatedLogin(identityInstance);
+
+    // assert
+    ASSERT_EQ(result, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(std::future_status::ready, loginResultFuture.wait_for(std::chrono::seconds(1)));
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_REQUEST_CANCELLED, loginResultFuture.get());
+    ASSERT_EQ("", identityInstance->GetSessionManager()->GetToken(GameKit::TokenType::IdToken));
+
+    GameKitIdentityInstanceRelease(identityInstance);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->mockHttpClient.get()));
+}
+
+TEST_F(GameKitIdentityExportsTestFixture, TestGameKitIdentityPollAndRetrieveFederatedTokensAsync_CallbackCancelsDuringRestart_NoDeadlock)
+{
+    // arrange
+    void* instance = createIdentityInstanceWithNoSessionManagerTokens();
+    setIdentityMocks(instance);
+    GameKit::Identity::Identity* identityInstance = static_cast<GameKit::Identity::Identity*>(instance);
+
+    std::shared_ptr<FakeHttpResponse> response = std::make_shared<FakeHttpResponse>();
+    response->SetResponseCode(Aws::Http::HttpResponseCode::FORBIDDEN);
+
+    EXPECT_CALL(*this->mockHttpClient.get(), MakeRequest(_, _, _)).Times(2).WillRepeatedly(Return(response));
+
+    CancellingFederatedLoginContext context;
+    context.identityInstance = identityInstance;
+    std::future<void> firstCallbackEntered = context.firstCallbackEntered.get_future();
+    std::future<unsigned int> firstResult = context.results[0].get_future();
+    std::future<unsigned int> secondResult = context.results[1].get_future();
+
+    // act
+    unsigned int firstLogin = GameKitPollAndRetrieveFederatedTokensAsync(identityInstance, GameKit::FederatedIdentityProvider::Facebook, "41669940-4b22-49b5-8a59-84c596455058", 60, &context, cancellingFederatedLoginResultCallback);
+    ASSERT_EQ(std::future_status::ready, firstCallbackEntered.wait_for(std::chrono::seconds(3)));
+
+    // restarting waits for the first login, whose callback cancels the login while the restart is in progress
+    unsigned int secondLogin = GameKitPollAndRetrieveFederatedTokensAsync(identityInstance, GameKit::FederatedIdentityProvider::Facebook, "41669940-4b22-49b5-8a59-84c596455058", 60, &context, cancellingFederatedLoginResultCallback);
+
+    // assert
+    ASSERT_EQ(firstLogin, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(secondLogin, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(std::future_status::ready, firstResult.wait_for(std::chrono::seconds(1)));
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED, firstResult.get());
+    ASSERT_EQ(std::future_status::ready, secondResult.wait_for(std::chrono::seconds(3)));
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED, secondResult.get());
+
+    GameKitIdentityInstanceRelease(identityInstance);
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(this->mockHttpClient.get()));
+}
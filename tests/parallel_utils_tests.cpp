@@ -0,0 +1,93 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "parallel_utils_tests.h"
+#include "aws/gamekit/core/errors.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace GameKit;
+
+class GameKit::Tests::ParallelUtils::GameKitUtilsParallelTestFixture : public ::testing::Test
+{
+public:
+    GameKitUtilsParallelTestFixture()
+    {}
+
+    ~GameKitUtilsParallelTestFixture()
+    {}
+
+    void SetUp()
+    {}
+
+    void TearDown()
+    {
+        TestExecutionUtils::AbortOnFailureIfEnabled();
+    }
+};
+
+using namespace GameKit::Tests::ParallelUtils;
+
+TEST_F(GameKitUtilsParallelTestFixture, SuccessfulTasks_RunTasks_AllTasksRunWithinConcurrencyLimit)
+{
+    // arrange
+    std::atomic<int> completedTasks(0);
+    std::atomic<int> runningTasks(0);
+    std::atomic<int> maxRunningTasks(0);
+    std::vector<std::function<unsigned int()>> tasks;
+    for (int i = 0; i < 8; ++i)
+    {
+        tasks.push_back([&]()
+        {
+            const int running = ++runningTasks;
+            int observedMax = maxRunningTasks;
+            while (running > observedMax && !maxRunningTasks.compare_exchange_weak(observedMax, running))
+            {
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            --runningTasks;
+            ++completedTasks;
+            return GAMEKIT_SUCCESS;
+        });
+    }
+
+    // act
+    const unsigned int result = GameKit::Utils::ParallelUtils::RunTasks(tasks, 3);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_SUCCESS, result);
+    ASSERT_EQ(8, completedTasks);
+    ASSERT_LE(maxRunningTasks, 3);
+}
+
+TEST_F(GameKitUtilsParallelTestFixture, FailingTask_RunTasks_PendingTasksSkippedAndFirstErrorReturned)
+{
+    // arrange
+    std::vector<int> ranTasks;
+    std::vector<std::function<unsigned int()>> tasks =
+    {
+        [&]() { ranTasks.push_back(0); return GAMEKIT_SUCCESS; },
+        [&]() { ranTasks.push_back(1); return GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED; },
+        [&]() { ranTasks.push_back(2); return GAMEKIT_ERROR_LAYER_CREATION_FAILED; }
+    };
+
+    // act
+    const unsigned int result = GameKit::Utils::ParallelUtils::RunTasks(tasks, 1);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_ERROR_BOOTSTRAP_BUCKET_UPLOAD_FAILED, result);
+    ASSERT_EQ(std::vector<int>({ 0, 1 }), ranTasks);
+}
+
+TEST_F(GameKitUtilsParallelTestFixture, NoTasks_RunTasks_Success)
+{
+    // act
+    const unsigned int result = GameKit::Utils::ParallelUtils::RunTasks({}, 4);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_SUCCESS, result);
+}
@@ -0,0 +1,18 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <aws/gamekit/core/utils/parallel_utils.h>
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace ParallelUtils
+        {
+            class GameKitUtilsParallelTestFixture;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "template_utils_tests.h"
+#include "aws/gamekit/core/errors.h"
+#include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
+#include <aws/gamekit/core/utils/file_utils.h>
+#include <boost/filesystem.hpp>
+
+using namespace GameKit;
+
+class GameKit::Tests::TemplateUtils::GameKitUtilsTemplateTestFixture : public ::testing::Test
+{
+public:
+    GameKitUtilsTemplateTestFixture()
+    {}
+
+    ~GameKitUtilsTemplateTestFixture()
+    {}
+
+    void SetUp()
+    {}
+
+    void TearDown()
+    {
+        TestExecutionUtils::AbortOnFailureIfEnabled();
+    }
+};
+
+using namespace GameKit::Tests::TemplateUtils;
+
+TEST_F(GameKitUtilsTemplateTestFixture, TemplateWithVariables_Render_AllVariablesReplaced)
+{
+    // arrange
+    const GameKit::Utils::ParsedTemplate parsedTemplate("Name: {{AWSGAMEKIT::SYS::GAMENAME}}-{{AWSGAMEKIT::SYS::ENV}}\nEnv: {{AWSGAMEKIT::SYS::ENV}}");
+
+    // act
+    const std::string result = parsedTemplate.Render({ { "AWSGAMEKIT::SYS::GAMENAME", "testgame" }, { "AWSGAMEKIT::SYS::ENV", "dev" } });
+
+    // assert
+    ASSERT_EQ("Name: testgame-dev\nEnv: dev", result);
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, TemplateWithUnknownVariables_Render_UnknownVariablesUnchanged)
+{
+    // arrange
+    const GameKit::Utils::ParsedTemplate parsedTemplate("{{AWSGAMEKIT::VARS::max}} {{AWSGAMEKIT::SYS::ENV}} {{resolve:ssm:name}}");
+
+    // act
+    const std::string result = parsedTemplate.Render({ { "AWSGAMEKIT::SYS::ENV", "dev" } });
+
+    // assert
+    ASSERT_EQ("{{AWSGAMEKIT::VARS::max}} dev {{resolve:ssm:name}}", result);
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, ValueWithSpecialCharacters_Render_ValueInsertedVerbatim)
+{
+    // arrange
+    const GameKit::Utils::ParsedTemplate parsedTemplate("value: {{NAME}}");
+
+    // act
+    const std::string result = parsedTemplate.Render({ { "NAME", "$1 $& {{NAME}}" } });
+
+    // assert
+    ASSERT_EQ("value: $1 $& {{NAME}}", result);
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, MalformedPlaceholders_Render_OnlyWellFormedPlaceholdersReplaced)
+{
+    // arrange
+    const GameKit::Utils::ParsedTemplate parsedTemplate("{{{NAME}}} {{NAME\n}} {{}} {{NA}ME}} {{NAME");
+
+    // act
+    const std::string result = parsedTemplate.Render({ { "NAME", "x" } });
+
+    // assert
+    ASSERT_EQ("{x} {{NAME\n}} {{}} {{NA}ME}} {{NAME", result);
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, TemplateFileRewritten_LoadTemplate_NewContentsLoaded)
+{
+    // arrange
+    const std::string filePath = "../core/test_data/testFiles/templateUtilsTests/template.yml";
+    GameKit::Utils::FileUtils::WriteStringToFile("first: {{NAME}}", filePath);
+
+    // act
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> firstTemplate;
+    const unsigned int firstResult = GameKit::Utils::TemplateUtils::LoadTemplate(filePath, firstTemplate);
+
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> cachedTemplate;
+    GameKit::Utils::TemplateUtils::LoadTemplate(filePath, cachedTemplate);
+
+    GameKit::Utils::FileUtils::WriteStringToFile("other: {{NAME}}", filePath);
+    GameKit::Utils::TemplateUtils::InvalidateTemplate(filePath);
+
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> secondTemplate;
+    const unsigned int secondResult = GameKit::Utils::TemplateUtils::LoadTemplate(filePath, secondTemplate);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_SUCCESS, firstResult);
+    ASSERT_EQ(GAMEKIT_SUCCESS, secondResult);
+    ASSERT_EQ(firstTemplate, cachedTemplate);
+    ASSERT_EQ("first: x", firstTemplate->Render({ { "NAME", "x" } }));
+    ASSERT_EQ("other: x", secondTemplate->Render({ { "NAME", "x" } }));
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, TemplateFileResizedWithinSameSecond_LoadTemplate_NewContentsLoaded)
+{
+    // arrange
+    const std::string filePath = "../core/test_data/testFiles/templateUtilsTests/resized_template.yml";
+    GameKit::Utils::FileUtils::WriteStringToFile("first: {{NAME}}", filePath);
+
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> firstTemplate;
+    GameKit::Utils::TemplateUtils::LoadTemplate(filePath, firstTemplate);
+
+    // act, keep the last write time so only the size tells the versions apart
+    const std::time_t lastWriteTime = boost::filesystem::last_write_time(filePath);
+    GameKit::Utils::FileUtils::WriteStringToFile("longer: {{NAME}}", filePath);
+    boost::filesystem::last_write_time(filePath, lastWriteTime);
+
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> secondTemplate;
+    const unsigned int result = GameKit::Utils::TemplateUtils::LoadTemplate(filePath, secondTemplate);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_SUCCESS, result);
+    ASSERT_EQ("first: x", firstTemplate->Render({ { "NAME", "x" } }));
+    ASSERT_EQ("longer: x", secondTemplate->Render({ { "NAME", "x" } }));
+}
+
+TEST_F(GameKitUtilsTemplateTestFixture, MissingFile_LoadTemplate_EmptyTemplateAndError)
+{
+    // act
+    std::shared_ptr<const GameKit::Utils::ParsedTemplate> parsedTemplate;
+    const unsigned int result = GameKit::Utils::TemplateUtils::LoadTemplate("../core/test_data/testFiles/templateUtilsTests/missing.yml", parsedTemplate);
+
+    // assert
+    ASSERT_EQ(GAMEKIT_ERROR_FILE_OPEN_FAILED, result);
+    ASSERT_NE(nullptr, parsedTemplate);
+    ASSERT_EQ("", parsedTemplate->Render({}));
+}
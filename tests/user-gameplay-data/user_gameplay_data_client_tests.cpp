@@ -127,6 +127,100 @@ TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOnline_Without
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
 }
 
+TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_UnauthorizedThenRefreshed_ReplayedOnce)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<FakeHttpResponse> unauthorizedResponse = std::make_shared<FakeHttpResponse>();
+    unauthorizedResponse->SetResponseCode(Aws::Http::HttpResponseCode::UNAUTHORIZED);
+
+    std::shared_ptr<FakeHttpResponse> response = std::make_shared<FakeHttpResponse>();
+    response->SetResponseCode(Aws::Http::HttpResponseCode(201));
+
+    std::string token = "123XYZ";
+    std::vector<Aws::String> sentAuthorizations;
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& sentRequest, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                sentAuthorizations.push_back(sentRequest->GetHeaderValue(HEADER_AUTHORIZATION.c_str()));
+            }), Return(unauthorizedResponse)))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& sentRequest, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                sentAuthorizations.push_back(sentRequest->GetHeaderValue(HEADER_AUTHORIZATION.c_str()));
+            }), Return(response)));
+
+    RequestModifier refreshableAuthSetter = [&](std::shared_ptr<Aws::Http::HttpRequest> sentRequest)
+    {
+        sentRequest->SetHeaderValue(HEADER_AUTHORIZATION, ToAwsString("Bearer " + token));
+    };
+
+    int handlerCalls = 0;
+    Aws::String rejectedAuthorization;
+    UserGameplayDataHttpClient client(mockHttpClient, refreshableAuthSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.SetUnauthorizedResponseHandler([&](std::shared_ptr<const Aws::Http::HttpRequest> rejectedRequest)
+    {
+        handlerCalls++;
+        rejectedAuthorization = rejectedRequest->GetHeaderValue(HEADER_AUTHORIZATION.c_str());
+        token = "456ABC";
+        return true;
+    });
+
+    // Act
+    auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+
+    // Assert
+    ASSERT_EQ(result.ResultType, RequestResultType::RequestMadeSuccess);
+    ASSERT_EQ(handlerCalls, 1);
+    ASSERT_EQ(rejectedAuthorization, "Bearer 123XYZ");
+    ASSERT_EQ(sentAuthorizations.size(), 2);
+    ASSERT_EQ(sentAuthorizations[0], "Bearer 123XYZ");
+    ASSERT_EQ(sentAuthorizations[1], "Bearer 456ABC");
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_UnauthorizedTwice_NotReplayedAgain)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<FakeHttpResponse> unauthorizedResponse = std::make_shared<FakeHttpResponse>();
+    unauthorizedResponse->SetResponseCode(Aws::Http::HttpResponseCode::UNAUTHORIZED);
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(unauthorizedResponse));
+
+    int handlerCalls = 0;
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.SetUnauthorizedResponseHandler([&](std::shared_ptr<const Aws::Http::HttpRequest>)
+    {
+        handlerCalls++;
+        return true;
+    });
+
+    // Act
+    auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+
+    // Assert
+    ASSERT_EQ(result.ResultType, RequestResultType::RequestMadeFailure);
+    ASSERT_EQ(result.Response->GetResponseCode(), Aws::Http::HttpResponseCode::UNAUTHORIZED);
+    ASSERT_EQ(handlerCalls, 1);
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
 TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithBackgroundThread_Retry)
 {
     // Arrange
@@ -740,3 +834,77 @@ TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_DeserializeFromIn
 
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient1.get()));
 }
+
+TEST_F(UserGameplayDataClientTestFixture, ExponentialBackoff_IncreaseThreshold_RetryTimeWithinBounds)
+{
+    // Arrange, time only moves when the test advances the clock
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    ExponentialBackoffStrategy strategy(std::chrono::milliseconds(200), std::chrono::milliseconds(800), TestLogger::Log, [&]() { return now; });
+    ASSERT_TRUE(strategy.ShouldRetry());
+
+    for (int failure = 0; failure < 20; ++failure)
+    {
+        // Act
+        strategy.IncreaseThreshold();
+
+        // Assert
+        const std::chrono::milliseconds timeUntilRetry = strategy.GetTimeUntilRetry();
+        ASSERT_GE(timeUntilRetry.count(), 200);
+        ASSERT_LE(timeUntilRetry.count(), 800);
+        ASSERT_FALSE(strategy.ShouldRetry());
+
+        now += timeUntilRetry - std::chrono::milliseconds(1);
+        ASSERT_FALSE(strategy.ShouldRetry());
+        now += std::chrono::milliseconds(1);
+        ASSERT_TRUE(strategy.ShouldRetry());
+    }
+
+    strategy.Reset();
+    ASSERT_TRUE(strategy.ShouldRetry());
+    ASSERT_EQ(0, strategy.GetTimeUntilRetry().count());
+}
+
+TEST_F(UserGameplayDataClientTestFixture, ExponentialBackoff_SetRetryAfter_LongerServerDelayHonored)
+{
+    // Arrange
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    ExponentialBackoffStrategy strategy(std::chrono::milliseconds(10), std::chrono::milliseconds(20), TestLogger::Log, [&]() { return now; });
+
+    // Act
+    strategy.IncreaseThreshold();
+    strategy.SetRetryAfter(std::chrono::seconds(2));
+
+    // Assert
+    ASSERT_EQ(2000, strategy.GetTimeUntilRetry().count());
+    now += std::chrono::milliseconds(1999);
+    ASSERT_FALSE(strategy.ShouldRetry());
+    now += std::chrono::milliseconds(1);
+    ASSERT_TRUE(strategy.ShouldRetry());
+}
+
+TEST_F(UserGameplayDataClientTestFixture, GetRetryAfter_SecondsOrInvalidHeader_DelayParsed)
+{
+    // Arrange
+    std::shared_ptr<FakeHttpResponse> secondsResponse = std::make_shared<FakeHttpResponse>();
+    secondsResponse->AddHeader("retry-after", "3");
+    std::shared_ptr<FakeHttpResponse> invalidResponse = std::make_shared<FakeHttpResponse>();
+    invalidResponse->AddHeader("retry-after", "soon");
+    std::shared_ptr<FakeHttpResponse> missingResponse = std::make_shared<FakeHttpResponse>();
+
+    // Act / Assert
+    ASSERT_EQ(3000, GetRetryAfter(secondsResponse).count());
+    ASSERT_EQ(0, GetRetryAfter(invalidResponse).count());
+    ASSERT_EQ(0, GetRetryAfter(missingResponse).count());
+}
+
+TEST_F(UserGameplayDataClientTestFixture, GetRetryAfter_HttpDateHeader_DelayUntilDateParsed)
+{
+    // Arrange, 30 seconds before Wed, 21 Oct 2015 07:28:00 GMT
+    std::shared_ptr<FakeHttpResponse> dateResponse = std::make_shared<FakeHttpResponse>();
+    dateResponse->AddHeader("retry-after", "Wed, 21 Oct 2015 07:28:00 GMT");
+    const std::chrono::system_clock::time_point now(std::chrono::seconds(1445412450));
+
+    // Act / Assert
+    ASSERT_EQ(30000, GetRetryAfter(dateResponse, now).count());
+    ASSERT_EQ(0, GetRetryAfter(dateResponse, now + std::chrono::minutes(1)).count());
+}
@@ -218,3 +218,62 @@ TEST_F(GameKitUtilsValidationTestFixture, StringWith513Chars_IsValidPrimaryIdent
     ASSERT_FALSE(result);
 }
 
+TEST_F(GameKitUtilsValidationTestFixture, EverySingleChar_IsValidParam_MatchesRegex)
+{
+    // arrange
+    const std::regex urlParamPattern("[a-zA-Z0-9-_.~]+");
+    const std::regex s3KeyParamPattern("[a-zA-Z0-9-_.*'()]+");
+    const std::regex primaryIdentifierPattern(GameKit::Utils::PRIMARY_IDENTIFIER_REGEX);
+
+    for (int c = 1; c < 256; ++c)
+    {
+        // act
+        const std::string str(1, static_cast<char>(c));
+
+        // assert
+        ASSERT_EQ(std::regex_match(str, urlParamPattern), GameKit::Utils::ValidationUtils::IsValidUrlParam(str)) << "char " << c;
+        ASSERT_EQ(std::regex_match(str, s3KeyParamPattern), GameKit::Utils::ValidationUtils::IsValidS3KeyParam(str)) << "char " << c;
+        ASSERT_EQ(std::regex_match(str, primaryIdentifierPattern), GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(str)) << "char " << c;
+    }
+}
+
+TEST_F(GameKitUtilsValidationTestFixture, StringWithEmbeddedNull_IsValidPrimaryIdentifier_ReturnsFalse)
+{
+    // act
+    const std::string identifier("some\0identifier", 15);
+    auto const result = GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(identifier);
+
+    // assert
+    ASSERT_FALSE(result);
+}
+
+TEST_F(GameKitUtilsValidationTestFixture, CStringWith512Chars_IsValidPrimaryIdentifier_ReturnsTrue)
+{
+    // act
+    const std::string identifier(512, 'a');
+    auto const result = GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(identifier.c_str());
+
+    // assert
+    ASSERT_TRUE(result);
+}
+
+TEST_F(GameKitUtilsValidationTestFixture, CStringWith513Chars_IsValidPrimaryIdentifier_ReturnsFalse)
+{
+    // act
+    const std::string identifier(513, 'a');
+    auto const result = GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(identifier.c_str());
+
+    // assert
+    ASSERT_FALSE(result);
+}
+
+TEST_F(GameKitUtilsValidationTestFixture, NullCString_IsValidPrimaryIdentifier_ReturnsFalse)
+{
+    // act
+    const char* identifier = nullptr;
+    auto const result = GameKit::Utils::ValidationUtils::IsValidPrimaryIdentifier(identifier);
+
+    // assert
+    ASSERT_FALSE(result);
+}
+
@@ -190,3 +190,92 @@ TEST_F(GameKitZipperTestFixture, UTF8Paths_AddDirectoryToZipFile_True)
     // clean up
     boost::filesystem::remove_all(dirname);
 }
+
+TEST_F(GameKitZipperTestFixture, UnchangedFiles_AddDirectoryToZipFile_CachedEntriesReused)
+{
+    // arrange
+    const std::string cacheDirectory = "../core/test_data/testFiles/zipperTests/entryCache";
+    const std::string secondZipFile = "../core/test_data/testFiles/zipperTests/testZip2.zip";
+    const std::string defaultCacheDirectory = GameKit::Zipper::GetEntryCacheDirectory();
+    boost::filesystem::remove_all(cacheDirectory);
+    GameKit::Zipper::SetEntryCacheDirectory(cacheDirectory);
+
+    auto countCachedEntries = [&cacheDirectory]()
+    {
+        return std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator());
+    };
+
+    // act
+    auto firstResult = gamekitZipperInstance->AddDirectoryToZipFile("../core/test_data/testFiles/zipperTests/testFiles");
+    gamekitZipperInstance->CloseZipFile();
+    const auto entriesAfterFirstZip = countCachedEntries();
+
+    GameKit::Zipper secondZipper("../core/test_data/testFiles/zipperTests", secondZipFile);
+    auto secondResult = secondZipper.AddDirectoryToZipFile("../core/test_data/testFiles/zipperTests/testFiles");
+    auto closeResult = secondZipper.CloseZipFile();
+    const auto entriesAfterSecondZip = countCachedEntries();
+
+    // assert, one entry per test file and both archives are identical apart from when they were written
+    ASSERT_TRUE(firstResult);
+    ASSERT_TRUE(secondResult);
+    ASSERT_TRUE(closeResult);
+    ASSERT_EQ(2, entriesAfterFirstZip);
+    ASSERT_EQ(entriesAfterFirstZip, entriesAfterSecondZip);
+    ASSERT_EQ(2, gamekitZipperInstance->GetCompressedEntryCount());
+    ASSERT_EQ(0, gamekitZipperInstance->GetCachedEntryCount());
+    ASSERT_EQ(0, secondZipper.GetCompressedEntryCount());
+    ASSERT_EQ(2, secondZipper.GetCachedEntryCount());
+
+    std::string firstZipContents;
+    std::string secondZipContents;
+    GameKit::Utils::FileUtils::ReadFileIntoString("../core/test_data/testFiles/zipperTests/testZip.zip", firstZipContents);
+    GameKit::Utils::FileUtils::ReadFileIntoString(secondZipFile, secondZipContents);
+    ASSERT_EQ(firstZipContents, secondZipContents);
+
+    // clean up
+    GameKit::Zipper::SetEntryCacheDirectory(defaultCacheDirectory);
+    boost::filesystem::remove_all(cacheDirectory);
+    remove(secondZipFile.c_str());
+}
+
+TEST_F(GameKitZipperTestFixture, CorruptCachedEntries_AddDirectoryToZipFile_EntriesCompressedAgain)
+{
+    // arrange
+    const std::string cacheDirectory = "../core/test_data/testFiles/zipperTests/entryCache";
+    const std::string secondZipFile = "../core/test_data/testFiles/zipperTests/testZip2.zip";
+    const std::string defaultCacheDirectory = GameKit::Zipper::GetEntryCacheDirectory();
+    boost::filesystem::remove_all(cacheDirectory);
+    GameKit::Zipper::SetEntryCacheDirectory(cacheDirectory);
+
+    auto firstResult = gamekitZipperInstance->AddDirectoryToZipFile("../core/test_data/testFiles/zipperTests/testFiles");
+    gamekitZipperInstance->CloseZipFile();
+
+    // truncate one entry and replace the data of the other, as a partial write or a planted entry would
+    std::vector<boost::filesystem::path> entries(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator{});
+    ASSERT_EQ(2, entries.size());
+    GameKit::Utils::FileUtils::WriteStringToFile("", entries[0].string());
+    GameKit::Utils::FileUtils::WriteStringToFile(std::string("GKZ1\x01", 5) + "not deflated data", entries[1].string());
+
+    // act
+    GameKit::Zipper secondZipper("../core/test_data/testFiles/zipperTests", secondZipFile);
+    auto secondResult = secondZipper.AddDirectoryToZipFile("../core/test_data/testFiles/zipperTests/testFiles");
+    auto closeResult = secondZipper.CloseZipFile();
+
+    // assert
+    ASSERT_TRUE(firstResult);
+    ASSERT_TRUE(secondResult);
+    ASSERT_TRUE(closeResult);
+    ASSERT_EQ(2, secondZipper.GetCompressedEntryCount());
+    ASSERT_EQ(0, secondZipper.GetCachedEntryCount());
+
+    std::string firstZipContents;
+    std::string secondZipContents;
+    GameKit::Utils::FileUtils::ReadFileIntoString("../core/test_data/testFiles/zipperTests/testZip.zip", firstZipContents);
+    GameKit::Utils::FileUtils::ReadFileIntoString(secondZipFile, secondZipContents);
+    ASSERT_EQ(firstZipContents, secondZipContents);
+
+    // clean up
+    GameKit::Zipper::SetEntryCacheDirectory(defaultCacheDirectory);
+    boost::filesystem::remove_all(cacheDirectory);
+    remove(secondZipFile.c_str());
+}